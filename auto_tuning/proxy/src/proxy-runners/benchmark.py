@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+# Runs the regression benchmarks of one or several SeisSol builds and compares the results
+# against a stored baseline. Only uses the python standard library.
+#
+#   benchmark.py run ./SeisSol_benchmark_Release_hsw_4_elastic ./SeisSol_benchmark_Release_hsw_6_viscoelastic2 -o current.json
+#   benchmark.py compare baseline.json current.json
+#
+# Orders and equations are fixed at compile time, hence the matrix of configurations is given
+# by the benchmark executables of several builds.
+
+import argparse
+import json
+import math
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def run(args):
+    runs = []
+    for executable in args.executables:
+        with tempfile.TemporaryDirectory() as directory:
+            output = os.path.join(directory, 'benchmark.json')
+            command = [executable,
+                       '--cells', str(args.cells),
+                       '--timesteps', str(args.timesteps),
+                       '--repetitions', str(args.repetitions),
+                       '--output', output]
+            print(' '.join(command), file=sys.stderr)
+            subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+            with open(output) as file:
+                runs.append(json.load(file))
+
+    with open(args.output, 'w') as file:
+        json.dump({'runs': runs}, file, indent=2)
+    print(f'Wrote {args.output}', file=sys.stderr)
+
+
+def load(fileName):
+    with open(fileName) as file:
+        data = json.load(file)
+    # accept both the output of a single executable and merged runs
+    runs = data['runs'] if 'runs' in data else [data]
+    benchmarks = {}
+    for run in runs:
+        for benchmark in run['benchmarks']:
+            benchmarks[(run['build'], benchmark['name'])] = benchmark
+    return benchmarks
+
+
+def compare(args):
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    print(f'{"build":<40} {"benchmark":<28} {"baseline [s]":>12} {"current [s]":>12} {"change":>8} {"t":>7}  verdict')
+    for key in sorted(baseline.keys() | current.keys()):
+        build, name = key
+        if key not in current or key not in baseline:
+            print(f'{build:<40} {name:<28} {"missing in " + ("current" if key not in current else "baseline"):>50}')
+            continue
+        old = baseline[key]
+        new = current[key]
+
+        change = new['time_mean'] / old['time_mean'] - 1.0
+        # Welch's t statistic of the difference of the mean run times
+        error = math.sqrt(old['time_std'] ** 2 / old['repetitions'] + new['time_std'] ** 2 / new['repetitions'])
+        t = (new['time_mean'] - old['time_mean']) / error if error > 0.0 else math.copysign(math.inf, change)
+
+        verdict = ''
+        if abs(change) > args.threshold and abs(t) > args.significance:
+            verdict = 'REGRESSION' if change > 0.0 else 'improvement'
+        if verdict == 'REGRESSION':
+            regressions += 1
+        print(f'{build:<40} {name:<28} {old["time_mean"]:>12.6f} {new["time_mean"]:>12.6f} {change:>+8.1%} {t:>7.2f}  {verdict}')
+
+    if regressions > 0:
+        print(f'{regressions} regression(s) above {args.threshold:.0%}', file=sys.stderr)
+        sys.exit(1)
+
+
+parser = argparse.ArgumentParser()
+subparsers = parser.add_subparsers(dest='command', required=True)
+
+run_parser = subparsers.add_parser('run', help='run the benchmark executables of one or several builds')
+run_parser.add_argument('executables', nargs='+', help='SeisSol_benchmark_* executables')
+run_parser.add_argument('-c', '--cells', default=100000, type=int, help='num cells of the proxy kernels')
+run_parser.add_argument('-t', '--timesteps', default=10, type=int, help='num time steps of the proxy kernels')
+run_parser.add_argument('-r', '--repetitions', default=5, type=int, help='num repetitions of every benchmark')
+run_parser.add_argument('-o', '--output', default='benchmark.json', type=str, help='merged JSON results')
+run_parser.set_defaults(func=run)
+
+compare_parser = subparsers.add_parser('compare', help='compare results against a baseline')
+compare_parser.add_argument('baseline', type=str, help='JSON results of the baseline')
+compare_parser.add_argument('current', type=str, help='JSON results to check')
+compare_parser.add_argument('--threshold', default=0.05, type=float, help='relative slowdown which counts as regression')
+compare_parser.add_argument('--significance', default=3.0, type=float, help='minimum |t| of Welch\'s t statistic')
+compare_parser.set_defaults(func=compare)
+
+args = parser.parse_args()
+args.func(args)
@@ -17,6 +17,13 @@ parser = argparse.ArgumentParser()
 plotting_options = ['csv', 'json', 'matplotlib']
 parser.add_argument('-c', '--cells', default=50000, type=int, help="num cells in a time cluster")
 parser.add_argument('-t', '--timesteps', default=30, type=int, help="num time steps/repeats")
+parser.add_argument('--yield_fraction', default=0.1, type=float, help="fraction of yielding cells (plasticity)")
+parser.add_argument('--fault_faces', default=0, type=int, help="num fault faces, 0 = 4 per cell (neigh_dr, godunov_dr, all_dr)")
+parser.add_argument('--point_sources', default=1000, type=int, help="num point sources (source)")
+parser.add_argument('--receivers', default=1000, type=int, help="num receivers (receiver)")
+parser.add_argument('--lts_rate', default=2, type=int, help="time step ratio of the slow and the fast cluster (lts)")
+parser.add_argument('--lts_fraction', default=0.5, type=float, help="fraction of cells in the fast cluster (lts)")
+parser.add_argument('--mesh_file', default='', type=str, help="mesh replacing the fake data; lts_rate is the cluster rate (all, local, neigh, lts)")
 parser.add_argument('--output_type', choices=plotting_options, default='csv', help='format to save data')
 parser.add_argument('-o', '--output_dir', default='.', type=str, help="relative output directory")
 args = parser.parse_args()
@@ -24,6 +31,13 @@ args = parser.parse_args()
 config = pb.ProxyConfig()
 config.cells = args.cells
 config.timesteps = args.timesteps
+config.yield_fraction = args.yield_fraction
+config.fault_faces = args.fault_faces
+config.point_sources = args.point_sources
+config.receivers = args.receivers
+config.lts_rate = args.lts_rate
+config.lts_fraction = args.lts_fraction
+config.mesh_file = args.mesh_file
 config.verbose = False
 
 df = pd.DataFrame(columns=['kernel type', 'time', 'HW GFLOPS', 'NZ GFLOPS'])
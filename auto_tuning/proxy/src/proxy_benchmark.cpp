@@ -0,0 +1,163 @@
+#include <utils/args.h>
+#include "proxy_common.hpp"
+#include <Initializer/MemoryManager.h>
+#include <Solver/time_stepping/MiniSeisSol.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifdef USE_MPI
+#include <Parallel/MPI.h>
+#endif
+
+#ifndef SEISSOL_BENCHMARK_BUILD
+#define SEISSOL_BENCHMARK_BUILD "unknown"
+#endif
+
+namespace {
+// fixed matrix of proxy kernels; results are only comparable if it does not change
+const std::vector<Kernel> benchmarkKernels{
+    Kernel::local, Kernel::neigh, Kernel::ader, Kernel::all, Kernel::neigh_dr, Kernel::godunov_dr,
+    Kernel::plasticity, Kernel::source, Kernel::receiver, Kernel::lts};
+
+struct BenchmarkResult {
+  std::string name;
+  std::vector<double> times;
+  double nonZeroGFlop{-1.0};
+  double hardwareGFlop{-1.0};
+  double gib{-1.0};
+};
+
+std::string formatDouble(double value) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+  return buffer;
+}
+
+void writeResult(std::ostream& out, const BenchmarkResult& result) {
+  const auto n = static_cast<double>(result.times.size());
+  double mean = 0.0;
+  for (auto time : result.times) {
+    mean += time;
+  }
+  mean /= n;
+  double variance = 0.0;
+  for (auto time : result.times) {
+    variance += (time - mean) * (time - mean);
+  }
+  variance = result.times.size() > 1 ? variance / (n - 1.0) : 0.0;
+
+  out << "    {\"name\": \"" << result.name << "\", \"repetitions\": " << result.times.size()
+      << ", \"time_mean\": " << formatDouble(mean)
+      << ", \"time_std\": " << formatDouble(std::sqrt(variance))
+      << ", \"time_min\": " << formatDouble(*std::min_element(result.times.begin(), result.times.end()))
+      << ", \"times\": [";
+  for (std::size_t i = 0; i < result.times.size(); ++i) {
+    out << (i > 0 ? ", " : "") << formatDouble(result.times[i]);
+  }
+  out << "]";
+  // MiniSeisSol does not count flops and bytes
+  if (result.nonZeroGFlop >= 0.0) {
+    out << ", \"gflop_non_zero\": " << formatDouble(result.nonZeroGFlop)
+        << ", \"gflop_hardware\": " << formatDouble(result.hardwareGFlop)
+        << ", \"gib\": " << formatDouble(result.gib)
+        << ", \"gflops_hardware\": " << formatDouble(result.hardwareGFlop / mean)
+        << ", \"gib_per_second\": " << formatDouble(result.gib / mean);
+  }
+  out << "}";
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+  utils::Args args;
+  args.addOption("cells", 'c', "Number of cells of the proxy kernels", utils::Args::Required, false);
+  args.addOption("timesteps", 't', "Number of timesteps of the proxy kernels", utils::Args::Required, false);
+  args.addOption("repetitions", 'r', "Number of repetitions of every benchmark", utils::Args::Required, false);
+  args.addOption("output", 'o', "JSON output file (default: benchmark.json)", utils::Args::Required, false);
+
+  if (args.parse(argc, argv) != utils::Args::Success) {
+    return -1;
+  }
+
+  ProxyConfig config{};
+  config.cells = args.getArgument<unsigned>("cells", config.cells);
+  config.timesteps = args.getArgument<unsigned>("timesteps", config.timesteps);
+  config.verbose = false;
+  const auto repetitions = std::max(args.getArgument<unsigned>("repetitions", 5), 2u);
+  // the proxy writes to stdout, hence the results go to a file
+  const auto outputFile = args.getArgument<std::string>("output", "benchmark.json");
+
+  std::vector<BenchmarkResult> results;
+  for (auto kernel : benchmarkKernels) {
+    config.kernel = kernel;
+    BenchmarkResult result{"proxy/" + Aux::kernel2str(kernel)};
+    try {
+      for (unsigned r = 0; r < repetitions; ++r) {
+        const auto output = runProxy(config);
+        result.times.push_back(output.time);
+        result.nonZeroGFlop = output.actualNonZeroGFlop;
+        result.hardwareGFlop = output.actualHardwareGFlop;
+        result.gib = output.gib;
+      }
+    }
+    catch (std::runtime_error& error) {
+      // e.g. kernels which are not available on devices
+      std::cerr << "Skipping " << result.name << ": " << error.what() << std::endl;
+      continue;
+    }
+    std::cerr << "Finished " << result.name << std::endl;
+    results.push_back(result);
+  }
+
+#ifndef ACL_DEVICE
+  // MiniSeisSol only estimates the performance of CPUs
+  seissol::initializers::MemoryManager memoryManager;
+  memoryManager.initialize();
+  for (bool usePlasticity : {false, true}) {
+    BenchmarkResult result{std::string("miniseissol/") + (usePlasticity ? "plasticity" : "elastic")};
+    for (unsigned r = 0; r < repetitions; ++r) {
+      result.times.push_back(seissol::miniSeisSol(memoryManager, usePlasticity));
+    }
+    std::cerr << "Finished " << result.name << std::endl;
+    results.push_back(result);
+  }
+#endif
+
+  std::ostringstream json;
+  int threads = 1;
+#ifdef _OPENMP
+  threads = omp_get_max_threads();
+#endif
+  json << "{\n  \"build\": \"" << SEISSOL_BENCHMARK_BUILD << "\",\n"
+       << "  \"cells\": " << config.cells << ",\n"
+       << "  \"timesteps\": " << config.timesteps << ",\n"
+       << "  \"threads\": " << threads << ",\n"
+       << "  \"benchmarks\": [\n";
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    writeResult(json, results[i]);
+    json << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  json << "  ]\n}\n";
+
+  std::ofstream out(outputFile);
+  if (!out) {
+    std::cerr << "Could not open " << outputFile << std::endl;
+    return -1;
+  }
+  out << json.str();
+
+#ifdef USE_MPI
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if (initialized) {
+    seissol::MPI::mpi.finalize();
+  }
+#endif
+  return 0;
+}
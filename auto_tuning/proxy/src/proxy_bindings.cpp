@@ -13,6 +13,11 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .value("localwoader", Kernel::localwoader)
       .value("neigh_dr", Kernel::neigh_dr)
       .value("godunov_dr", Kernel::godunov_dr)
+      .value("all_dr", Kernel::all_dr)
+      .value("plasticity", Kernel::plasticity)
+      .value("source", Kernel::source)
+      .value("receiver", Kernel::receiver)
+      .value("lts", Kernel::lts)
       .export_values();
 
   py::class_<ProxyConfig>(module, "ProxyConfig")
@@ -20,7 +25,14 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .def_readwrite("cells", &ProxyConfig::cells)
       .def_readwrite("timesteps", &ProxyConfig::timesteps)
       .def_readwrite("kernel", &ProxyConfig::kernel)
-      .def_readwrite("verbose", &ProxyConfig::verbose);
+      .def_readwrite("verbose", &ProxyConfig::verbose)
+      .def_readwrite("yield_fraction", &ProxyConfig::yieldFraction)
+      .def_readwrite("fault_faces", &ProxyConfig::faultFaces)
+      .def_readwrite("point_sources", &ProxyConfig::pointSources)
+      .def_readwrite("receivers", &ProxyConfig::receivers)
+      .def_readwrite("lts_rate", &ProxyConfig::ltsRate)
+      .def_readwrite("lts_fraction", &ProxyConfig::ltsFraction)
+      .def_readwrite("mesh_file", &ProxyConfig::meshFile);
 
   py::class_<ProxyOutput>(module, "ProxyOutput")
       .def(py::init<>())
@@ -13,7 +13,12 @@ enum Kernel {
   ader,
   localwoader,
   neigh_dr,
-  godunov_dr
+  godunov_dr,
+  all_dr,
+  plasticity,
+  source,
+  receiver,
+  lts
 };
 
 struct ProxyConfig {
@@ -21,6 +26,20 @@ struct ProxyConfig {
   unsigned timesteps{10};
   Kernel kernel{Kernel::all};
   bool verbose{true};
+  //! fraction of the cells whose stress state exceeds the yield criterion (plasticity)
+  double yieldFraction{0.1};
+  //! number of dynamic rupture faces; 0 means 4 faces per cell (neigh_dr, godunov_dr, all_dr)
+  unsigned faultFaces{0};
+  //! number of point sources (source)
+  unsigned pointSources{1000};
+  //! number of receivers (receiver)
+  unsigned receivers{1000};
+  //! ratio of the time step widths of the slow and the fast cluster (lts), cluster rate with a mesh
+  unsigned ltsRate{2};
+  //! fraction of the cells in the fast cluster (lts)
+  double ltsFraction{0.5};
+  //! mesh whose connectivity and clustered layout replace the random fake data (all, local, neigh, lts)
+  std::string meshFile{};
 };
 
 struct ProxyOutput{
@@ -99,7 +118,12 @@ protected:
       {Kernel::ader,        "ader"},
       {Kernel::localwoader, "localwoader"},
       {Kernel::neigh_dr,    "neigh_dr"},
-      {Kernel::godunov_dr,  "godunov_dr"}
+      {Kernel::godunov_dr,  "godunov_dr"},
+      {Kernel::all_dr,      "all_dr"},
+      {Kernel::plasticity,  "plasticity"},
+      {Kernel::source,      "source"},
+      {Kernel::receiver,    "receiver"},
+      {Kernel::lts,         "lts"}
   };
 
   inline static std::unordered_map<std::string, Kernel> invMap{
@@ -109,7 +133,12 @@ protected:
       {"ader", Kernel::ader},
       {"localwoader", Kernel::localwoader},
       {"neigh_dr", Kernel::neigh_dr},
-      {"godunov_dr", Kernel::godunov_dr}
+      {"godunov_dr", Kernel::godunov_dr},
+      {"all_dr", Kernel::all_dr},
+      {"plasticity", Kernel::plasticity},
+      {"source", Kernel::source},
+      {"receiver", Kernel::receiver},
+      {"lts", Kernel::lts}
   };
 };
 
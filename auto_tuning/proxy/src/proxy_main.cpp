@@ -1,6 +1,9 @@
 #include <utils/args.h>
 #include "proxy_common.hpp"
 #include <iostream>
+#ifdef USE_MPI
+#include <Parallel/MPI.h>
+#endif
 
 
 int main(int argc, char* argv[]) {
@@ -15,6 +18,13 @@ int main(int argc, char* argv[]) {
   args.addAdditionalOption("cells", "Number of cells");
   args.addAdditionalOption("timesteps", "Number of timesteps");
   args.addAdditionalOption("kernel", kernelHelp.str());
+  args.addOption("yield-fraction", 0, "Fraction of yielding cells (plasticity)", utils::Args::Required, false);
+  args.addOption("fault-faces", 0, "Number of fault faces, 0 = 4 per cell (neigh_dr, godunov_dr, all_dr)", utils::Args::Required, false);
+  args.addOption("point-sources", 0, "Number of point sources (source)", utils::Args::Required, false);
+  args.addOption("receivers", 0, "Number of receivers (receiver)", utils::Args::Required, false);
+  args.addOption("lts-rate", 0, "Time step ratio of the slow and the fast cluster (lts)", utils::Args::Required, false);
+  args.addOption("lts-fraction", 0, "Fraction of cells in the fast cluster (lts)", utils::Args::Required, false);
+  args.addOption("mesh", 0, "Mesh replacing the fake data, lts-rate is the cluster rate (all, local, neigh, lts)", utils::Args::Required, false);
 
   if (args.parse(argc, argv) != utils::Args::Success) {
     return -1;
@@ -24,6 +34,13 @@ int main(int argc, char* argv[]) {
   config.cells = args.getAdditionalArgument<unsigned>("cells");
   config.timesteps = args.getAdditionalArgument<unsigned>("timesteps");
   auto kernelStr = args.getAdditionalArgument<std::string>("kernel");
+  config.yieldFraction = args.getArgument<double>("yield-fraction", config.yieldFraction);
+  config.faultFaces = args.getArgument<unsigned>("fault-faces", config.faultFaces);
+  config.pointSources = args.getArgument<unsigned>("point-sources", config.pointSources);
+  config.receivers = args.getArgument<unsigned>("receivers", config.receivers);
+  config.ltsRate = args.getArgument<unsigned>("lts-rate", config.ltsRate);
+  config.ltsFraction = args.getArgument<double>("lts-fraction", config.ltsFraction);
+  config.meshFile = args.getArgument<std::string>("mesh", config.meshFile);
 
   try {
     config.kernel = Aux::str2kernel(kernelStr);
@@ -35,5 +52,14 @@ int main(int argc, char* argv[]) {
 
   auto output = runProxy(config);
   Aux::displayOutput(output, kernelStr);
+
+#ifdef USE_MPI
+  // MPI is only initialized when a mesh is read
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if (initialized) {
+    seissol::MPI::mpi.finalize();
+  }
+#endif
   return 0;
 }
@@ -83,10 +83,12 @@ extern long long pspamm_num_total_flops;
 #include <Kernels/DynamicRupture.h>
 #include "utils/logger.h"
 #include <cassert>
+#include <stdexcept>
 
 // seissol_kernel includes
 #include "proxy_seissol_tools.hpp"
 #include "proxy_seissol_allocator.hpp"
+#include "proxy_seissol_mesh.hpp"
 #include "proxy_seissol_flops.hpp"
 #include "proxy_seissol_bytes.hpp"
 #include "proxy_seissol_integrators.hpp"
@@ -100,6 +102,14 @@ using namespace proxy::device;
 using namespace proxy::cpu;
 #endif
 
+void testMeshKernel(unsigned kernel, unsigned timesteps) {
+  const bool withLocal = (kernel != neigh);
+  const bool withNeighboring = (kernel != local);
+  for (unsigned t = 0; t < timesteps; ++t) {
+    proxy::cpu::computeClusteredIntegration(withLocal, withNeighboring);
+  }
+}
+
 void testKernel(unsigned kernel, unsigned timesteps) {
   unsigned t = 0;
   switch (kernel) {
@@ -135,6 +145,32 @@ void testKernel(unsigned kernel, unsigned timesteps) {
         computeDynRupGodunovState();
       }
       break;
+    case all_dr:
+      for (; t < timesteps; ++t) {
+        computeDynRupGodunovState();
+        computeNeighboringIntegration();
+      }
+      break;
+    case plasticity:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computePlasticity();
+      }
+      break;
+    case source:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeSourceIntegration(t);
+      }
+      break;
+    case receiver:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeReceivers(t);
+      }
+      break;
+    case lts:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeClusteredIntegration(true, true);
+      }
+      break;
     default:
       break;
   }
@@ -147,18 +183,32 @@ ProxyOutput runProxy(ProxyConfig config) {
   registerMarkers();
 
   bool enableDynamicRupture = false;
-  if (config.kernel == neigh_dr || config.kernel == godunov_dr) {
+  if (config.kernel == neigh_dr || config.kernel == godunov_dr || config.kernel == all_dr) {
     enableDynamicRupture = true;
   }
 
+  const bool useMesh = !config.meshFile.empty();
+  if (useMesh && config.kernel != all && config.kernel != local && config.kernel != neigh && config.kernel != lts) {
+    throw std::runtime_error("kernel " + Aux::kernel2str(config.kernel) + " does not support meshes");
+  }
+
 #ifdef ACL_DEVICE
+  if (config.kernel == plasticity || config.kernel == source || config.kernel == receiver || config.kernel == lts) {
+    throw std::runtime_error("kernel " + Aux::kernel2str(config.kernel) + " is not available on devices");
+  }
+  if (!config.meshFile.empty()) {
+    throw std::runtime_error("meshes are not supported on devices");
+  }
+
   deviceT &device = deviceT::getInstance();
   device.api->setDevice(0);
   device.api->initialize();
   device.api->allocateStackMem();
 #endif
 
-  m_ltsTree = new seissol::initializers::LTSTree;
+  if (!useMesh) {
+    m_ltsTree = new seissol::initializers::LTSTree;
+  }
   m_dynRupTree = new seissol::initializers::LTSTree;
   m_allocator = new seissol::memory::ManagedAllocator;
 
@@ -168,7 +218,30 @@ ProxyOutput runProxy(ProxyConfig config) {
     printf("Allocating fake data...\n");
 
   initGlobalData();
-  config.cells = initDataStructures(config.cells, enableDynamicRupture);
+  if (useMesh) {
+    config.cells = initMeshDataStructures(config.meshFile, config.ltsRate);
+    if (config.verbose) {
+      printf("Derived %u time clusters with %u cells from %s\n",
+             static_cast<unsigned>(m_clusterSteps.size()), config.cells, config.meshFile.c_str());
+    }
+  } else if (config.kernel == lts) {
+    config.cells = initLtsDataStructures(config.cells, config.ltsRate, config.ltsFraction);
+  } else {
+    config.cells = initDataStructures(config.cells, enableDynamicRupture, config.kernel == plasticity, config.faultFaces);
+  }
+  switch (config.kernel) {
+    case plasticity:
+      initPlasticity(config.yieldFraction);
+      break;
+    case source:
+      initPointSources(config.pointSources, config.timesteps);
+      break;
+    case receiver:
+      initReceivers(config.receivers);
+      break;
+    default:
+      break;
+  }
 #ifdef ACL_DEVICE
   initDataStructuresOnDevice(enableDynamicRupture);
 #endif // ACL_DEVICE
@@ -184,17 +257,20 @@ ProxyOutput runProxy(ProxyConfig config) {
   double total_cycles = 0.0;
 
   // init OpenMP and LLC
-  testKernel(config.kernel, 1);
+  auto* kernelFun = useMesh ? &testMeshKernel : &testKernel;
+  (*kernelFun)(config.kernel, 1);
   
   libxsmm_num_total_flops = 0;
   pspamm_num_total_flops = 0;
+  m_numberOfPlasticityCandidates = 0;
+  m_numberOfYieldingCells = 0;
 
   gettimeofday(&start_time, NULL);
 #ifdef __USE_RDTSC
   cycles_start = __rdtsc();
 #endif
 
-  testKernel(config.kernel, config.timesteps);
+  (*kernelFun)(config.kernel, config.timesteps);
 
 #ifdef __USE_RDTSC  
   cycles_end = __rdtsc();
@@ -234,8 +310,44 @@ ProxyOutput runProxy(ProxyConfig config) {
       break;
     case godunov_dr:
       flop_fun = &flops_drgod_actual;
-      bytes_fun = &noestimate;
+      bytes_fun = &bytes_drgod;
+      break;
+    case all_dr:
+      flop_fun = &flops_alldr_actual;
+      bytes_fun = &bytes_alldr;
+      break;
+    case plasticity:
+      flop_fun = &flops_plasticity_actual;
+      bytes_fun = &bytes_plasticity;
+      break;
+    case source:
+      flop_fun = &flops_source_actual;
+      bytes_fun = &bytes_source;
       break;
+    case receiver:
+      flop_fun = &flops_receiver_actual;
+      bytes_fun = &bytes_receiver;
+      break;
+    case lts:
+      flop_fun = &flops_lts_actual;
+      bytes_fun = &bytes_lts;
+      break;
+  }
+  if (useMesh) {
+    switch (config.kernel) {
+      case local:
+        flop_fun = &flops_lts_local_actual;
+        bytes_fun = &bytes_lts_local;
+        break;
+      case neigh:
+        flop_fun = &flops_lts_neigh_actual;
+        bytes_fun = &bytes_lts_neigh;
+        break;
+      default:
+        flop_fun = &flops_lts_actual;
+        bytes_fun = &bytes_lts;
+        break;
+    }
   }
  
 
@@ -261,7 +373,16 @@ ProxyOutput runProxy(ProxyConfig config) {
   output.hardwareGFlops = (static_cast<double>(actual_flops.d_hardwareFlops) * 1.e-9)/total;
   output.gibPerSecond = (bytes_estimate/(1024.0*1024.0*1024.0))/total;
 
-  delete m_ltsTree;
+  freePointSources();
+  delete m_receiverCluster;
+  m_receiverCluster = nullptr;
+  m_plasticityCandidates.clear();
+
+  if (useMesh) {
+    freeMeshDataStructures();
+  } else {
+    delete m_ltsTree;
+  }
   delete m_dynRupTree;
   delete m_allocator;
 
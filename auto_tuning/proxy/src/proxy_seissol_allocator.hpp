@@ -61,8 +61,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Initializer/DynamicRupture.h>
 #include <Initializer/GlobalData.h>
 #include <Solver/time_stepping/MiniSeisSol.cpp>
+#include <Kernels/Plasticity.h>
+#include <Kernels/Receiver.h>
+#include <SourceTerm/typedefs.hpp>
+#include <SourceTerm/PointSource.h>
 #include <yateto.h>
+#include <algorithm>
+#include <numeric>
 #include <unordered_set>
+#include <vector>
 
 #ifdef ACL_DEVICE
 #include <device.h>
@@ -88,6 +95,25 @@ seissol::kernels::DynamicRupture m_dynRupKernel;
 
 seissol::memory::ManagedAllocator *m_allocator{nullptr};
 
+// plasticity
+seissol::kernels::Plasticity::NodalBounds m_plasticityBounds;
+std::vector<unsigned> m_plasticityCandidates;
+long long m_numberOfPlasticityCandidates = 0;
+long long m_numberOfYieldingCells = 0;
+
+// point sources
+seissol::sourceterm::PointSources* m_pointSources{nullptr};
+std::vector<seissol::sourceterm::CellToPointSourcesMapping> m_cellToPointSources;
+
+// receivers
+constexpr unsigned ReceiverSamplesPerTimeStep = 4;
+seissol::kernels::ReceiverCluster* m_receiverCluster{nullptr};
+
+// clustered local time stepping; number of time steps and time step width of each cluster
+// per time step of the slowest cluster
+std::vector<unsigned> m_clusterSteps;
+std::vector<double> m_clusterTimeStepWidths;
+
 namespace tensor = seissol::tensor;
 
 void initGlobalData() {
@@ -110,10 +136,13 @@ void initGlobalData() {
   m_dynRupKernel.setGlobalData(globalData);
 }
 
-unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture) {
+unsigned int initDataStructures(unsigned int i_cells,
+                                bool enableDynamicRupture,
+                                bool enablePlasticity,
+                                unsigned int i_faultFaces) {
   // init RNG
   srand48(i_cells);
-  m_lts.addTo(*m_ltsTree, false); // proxy does not use plasticity
+  m_lts.addTo(*m_ltsTree, enablePlasticity);
   m_ltsTree->setNumberOfTimeClusters(1);
   m_ltsTree->fixate();
   
@@ -137,7 +166,8 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
     seissol::initializers::TimeCluster& cluster = m_dynRupTree->child(0);
     cluster.child<Ghost>().setNumberOfCells(0);
     cluster.child<Copy>().setNumberOfCells(0);
-    cluster.child<Interior>().setNumberOfCells(4*i_cells); /// Every face is a potential dynamic rupture face
+    /// Every face is a potential dynamic rupture face by default
+    cluster.child<Interior>().setNumberOfCells((i_faultFaces > 0) ? i_faultFaces : 4*i_cells);
   
     m_dynRupTree->allocateVariables();
     m_dynRupTree->touchVariables();
@@ -192,12 +222,240 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
       faceInformation[face].plusSide = (unsigned int)lrand48() % 4;
       faceInformation[face].minusSide = (unsigned int)lrand48() % 4;
       faceInformation[face].faceRelation = (unsigned int)lrand48() % 3;
+      faceInformation[face].plusSideSlower = false;
+      faceInformation[face].minusSideSlower = false;
     }
   }
   
   return i_cells;
 }
 
+/** Sets up a stress state which violates the yield criterion in a fraction
+ *  yieldFraction of the cells. The remaining cells keep the small stresses of fakeData. */
+void initPlasticity(double yieldFraction) {
+  auto& layer = m_ltsTree->child(0).child<Interior>();
+  PlasticityData* plasticity = layer.var(m_lts.plasticity);
+  real (*dofs)[tensor::Q::size()] = layer.var(m_lts.dofs);
+  real (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = layer.var(m_lts.pstrain);
+
+  m_plasticityBounds = seissol::kernels::Plasticity::computeNodalBounds(&m_globalDataOnHost);
+  m_plasticityCandidates.resize(layer.getNumberOfCells());
+
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    plasticity[cell].initialLoading[0] = -5.0e7;
+    plasticity[cell].initialLoading[1] = -6.0e7;
+    plasticity[cell].initialLoading[2] = -7.0e7;
+    plasticity[cell].initialLoading[3] = 0.0;
+    plasticity[cell].initialLoading[4] = 0.0;
+    plasticity[cell].initialLoading[5] = 0.0;
+    plasticity[cell].cohesionTimesCosAngularFriction = 1.0e6;
+    plasticity[cell].sinAngularFriction = 0.5;
+    plasticity[cell].mufactor = 1.0 / (2.0 * 3.0e10);
+    std::fill_n(pstrain[cell], 7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS, 0.0);
+
+    if (drand48() < yieldFraction) {
+      // strong shear in the xy-plane
+      dofs[cell][0 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = 1.0e8;
+      dofs[cell][1 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = -1.0e8;
+    }
+  }
+}
+
+/** Distributes numberOfSources FSRM point sources randomly over the cells.
+ *  Every source is active during the whole run of i_timesteps time steps. */
+void initPointSources(unsigned numberOfSources, unsigned i_timesteps) {
+  constexpr unsigned TensorSize = seissol::sourceterm::PointSources::TensorSize;
+  constexpr unsigned SamplesPerTimeStep = 4;
+
+  auto& layer = m_ltsTree->child(0).child<Interior>();
+  real (*dofs)[tensor::Q::size()] = layer.var(m_lts.dofs);
+
+  std::vector<unsigned> sourceCells(numberOfSources);
+  for (auto& cell : sourceCells) {
+    cell = (unsigned int)lrand48() % layer.getNumberOfCells();
+  }
+  std::sort(sourceCells.begin(), sourceCells.end());
+
+  m_pointSources = new seissol::sourceterm::PointSources;
+  auto& sources = *m_pointSources;
+  sources.mode = seissol::sourceterm::PointSources::FSRM;
+  sources.numberOfSources = numberOfSources;
+  sources.mInvJInvPhisAtSources = static_cast<real (*)[tensor::mInvJInvPhisAtSources::size()]>(
+      m_allocator->allocateMemory(numberOfSources * tensor::mInvJInvPhisAtSources::size() * sizeof(real), ALIGNMENT, MEMKIND_GLOBAL));
+  sources.tensor = static_cast<real (*)[TensorSize]>(
+      m_allocator->allocateMemory(numberOfSources * TensorSize * sizeof(real), ALIGNMENT, MEMKIND_GLOBAL));
+  sources.A.resize(numberOfSources);
+  sources.stiffnessTensor.resize(numberOfSources);
+  sources.slipRates.resize(numberOfSources);
+  sources.nrfMoments.resize(numberOfSources);
+  sources.onsetTime.resize(numberOfSources);
+  sources.endTime.resize(numberOfSources);
+
+  const double samplingInterval = seissol::miniSeisSolTimeStep / SamplesPerTimeStep;
+  std::vector<real> samples(SamplesPerTimeStep * (i_timesteps + 1) + 1);
+  for (unsigned source = 0; source < numberOfSources; ++source) {
+    for (unsigned k = 0; k < tensor::mInvJInvPhisAtSources::size(); ++k) {
+      sources.mInvJInvPhisAtSources[source][k] = (real)drand48();
+    }
+    for (unsigned q = 0; q < TensorSize; ++q) {
+      sources.tensor[source][q] = (real)drand48();
+    }
+    for (auto& sample : samples) {
+      sample = (real)drand48();
+    }
+    seissol::sourceterm::samplesToPiecewiseLinearFunction1D(samples.data(), samples.size(), 0.0, samplingInterval, &sources.slipRates[source][0]);
+    sources.onsetTime[source] = 0.0;
+    sources.endTime[source] = (samples.size() - 1) * samplingInterval;
+  }
+
+  // the sources are ordered by cells
+  m_cellToPointSources.clear();
+  for (unsigned source = 0; source < numberOfSources; ++source) {
+    if (source == 0 || sourceCells[source] != sourceCells[source-1]) {
+      seissol::sourceterm::CellToPointSourcesMapping mapping;
+      mapping.dofs = &dofs[sourceCells[source]];
+      mapping.pointSourcesOffset = source;
+      m_cellToPointSources.push_back(mapping);
+    }
+    ++m_cellToPointSources.back().numberOfPointSources;
+  }
+}
+
+void freePointSources() {
+  if (m_pointSources != nullptr) {
+    // the memory is owned by m_allocator
+    m_pointSources->mInvJInvPhisAtSources = nullptr;
+    m_pointSources->tensor = nullptr;
+    delete m_pointSources;
+    m_pointSources = nullptr;
+  }
+  m_cellToPointSources.clear();
+}
+
+/** Places numberOfReceivers receivers at random points of random cells. */
+void initReceivers(unsigned numberOfReceivers) {
+  auto& layer = m_ltsTree->child(0).child<Interior>();
+
+  std::vector<unsigned> quantities(9);
+  std::iota(quantities.begin(), quantities.end(), 0);
+  m_receiverCluster = new seissol::kernels::ReceiverCluster(&m_globalDataOnHost,
+                                                            quantities,
+                                                            seissol::miniSeisSolTimeStep / ReceiverSamplesPerTimeStep,
+                                                            seissol::miniSeisSolTimeStep);
+
+  seissol::kernels::LocalData::Loader loader;
+  loader.load(m_lts, layer);
+  for (unsigned receiver = 0; receiver < numberOfReceivers; ++receiver) {
+    double xi, eta, zeta;
+    do {
+      xi = drand48();
+      eta = drand48();
+      zeta = drand48();
+    } while (xi + eta + zeta > 1.0);
+    unsigned cell = (unsigned int)lrand48() % layer.getNumberOfCells();
+    m_receiverCluster->addReceiver(receiver, xi, eta, zeta, loader.entry(cell));
+  }
+}
+
+/** Two time clusters with a time step ratio of i_rate. A fraction i_fastFraction of the cells
+ *  is in the fast cluster and the face neighbors are drawn from all cells.
+ *  Slow cells provide derivatives to their fast neighbors. Fast cells adjacent to the slow
+ *  cluster accumulate their buffers over the slow time step and provide derivatives to their
+ *  fast neighbors (GTS relation). */
+unsigned int initLtsDataStructures(unsigned int i_cells, unsigned int i_rate, double i_fastFraction) {
+  constexpr unsigned derivativesSize = yateto::computeFamilySize<tensor::dQ>();
+
+  // init RNG
+  srand48(i_cells);
+  i_rate = std::max(i_rate, 1u);
+  m_clusterSteps = {i_rate, 1};
+  m_clusterTimeStepWidths = {seissol::miniSeisSolTimeStep, i_rate * seissol::miniSeisSolTimeStep};
+  m_lts.addTo(*m_ltsTree, false);
+  m_ltsTree->setNumberOfTimeClusters(2);
+  m_ltsTree->fixate();
+
+  unsigned numberOfCells[2];
+  numberOfCells[0] = std::min(i_cells, std::max(1u, static_cast<unsigned>(i_fastFraction * i_cells)));
+  numberOfCells[1] = i_cells - numberOfCells[0];
+
+  for (unsigned tc = 0; tc < 2; ++tc) {
+    seissol::initializers::TimeCluster& cluster = m_ltsTree->child(tc);
+    cluster.child<Ghost>().setNumberOfCells(0);
+    cluster.child<Copy>().setNumberOfCells(0);
+    cluster.child<Interior>().setNumberOfCells(numberOfCells[tc]);
+    cluster.child<Interior>().setBucketSize(m_lts.buffersDerivatives, sizeof(real) * (tensor::I::size() + derivativesSize) * numberOfCells[tc]);
+  }
+
+  m_ltsTree->allocateVariables();
+  m_ltsTree->touchVariables();
+  m_ltsTree->allocateBuckets();
+
+  seissol::initializers::Layer* layers[2] = {&m_ltsTree->child(0).child<Interior>(), &m_ltsTree->child(1).child<Interior>()};
+  real* buckets[2];
+  for (unsigned tc = 0; tc < 2; ++tc) {
+    seissol::fakeData(m_lts, *layers[tc]);
+    buckets[tc] = static_cast<real*>(layers[tc]->bucket(m_lts.buffersDerivatives));
+  }
+  // buffers come first in the bucket, followed by the derivatives
+  auto buffersOf = [&](unsigned tc, unsigned cell) { return buckets[tc] + cell * tensor::I::size(); };
+  auto derivativesOf = [&](unsigned tc, unsigned cell) {
+    return buckets[tc] + numberOfCells[tc] * tensor::I::size() + cell * derivativesSize;
+  };
+
+  // neighbors are global ids; cell g is in the fast cluster iff g < numberOfCells[0]
+  std::vector<unsigned> neighbors(4 * i_cells);
+  for (auto& neighbor : neighbors) {
+    neighbor = (unsigned int)lrand48() % i_cells;
+  }
+  std::vector<bool> accumulates(numberOfCells[0], false);
+  for (unsigned cell = 0; cell < i_cells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      unsigned neighbor = neighbors[4 * cell + face];
+      if (cell < numberOfCells[0] && neighbor >= numberOfCells[0]) {
+        accumulates[cell] = true;
+      } else if (cell >= numberOfCells[0] && neighbor < numberOfCells[0]) {
+        accumulates[neighbor] = true;
+      }
+    }
+  }
+
+  for (unsigned tc = 0; tc < 2; ++tc) {
+    real** buffers = layers[tc]->var(m_lts.buffers);
+    real** derivatives = layers[tc]->var(m_lts.derivatives);
+    real* (*faceNeighbors)[4] = layers[tc]->var(m_lts.faceNeighbors);
+    CellLocalInformation* cellInformation = layers[tc]->var(m_lts.cellInformation);
+
+    for (unsigned cell = 0; cell < numberOfCells[tc]; ++cell) {
+      const unsigned globalCell = tc * numberOfCells[0] + cell;
+      const bool accumulatesBuffers = (tc == 0) && accumulates[cell];
+      const bool providesDerivatives = (tc == 1) || accumulatesBuffers;
+
+      unsigned short ltsSetup = (1 << 8);
+      ltsSetup |= providesDerivatives ? (1 << 9) : 0;
+      ltsSetup |= accumulatesBuffers ? (1 << 10) : 0;
+      buffers[cell] = buffersOf(tc, cell);
+      derivatives[cell] = providesDerivatives ? derivativesOf(tc, cell) : nullptr;
+
+      for (unsigned face = 0; face < 4; ++face) {
+        const unsigned neighbor = neighbors[4 * globalCell + face];
+        const unsigned neighborCluster = (neighbor < numberOfCells[0]) ? 0 : 1;
+        const unsigned neighborCell = neighbor - neighborCluster * numberOfCells[0];
+        const bool neighborAccumulates = (neighborCluster == 0) && accumulates[neighborCell];
+        if (tc == 0 && (neighborCluster == 1 || neighborAccumulates)) {
+          ltsSetup |= (1 << face);
+          ltsSetup |= (neighborCluster == 0) ? (1 << (face + 4)) : 0;
+          faceNeighbors[cell][face] = derivativesOf(neighborCluster, neighborCell);
+        } else {
+          faceNeighbors[cell][face] = buffersOf(neighborCluster, neighborCell);
+        }
+      }
+      cellInformation[cell].ltsSetup = ltsSetup;
+    }
+  }
+
+  return i_cells;
+}
+
 #ifdef ACL_DEVICE
 void initDataStructuresOnDevice(bool enableDynamicRupture) {
 
@@ -49,6 +49,102 @@ double bytes_all(unsigned int i_timesteps) {
   return bytes_local(i_timesteps) + bytes_neigh(i_timesteps);
 }
 
+double bytes_drgod(unsigned int i_timesteps) {
+  unsigned nrOfFaces = m_dynRupTree->child(0).child<Interior>().getNumberOfCells();
+
+  // derivatives of both sides and the interpolated states of both sides
+  double bytes = sizeof(real) * (2.0 * yateto::computeFamilySize<tensor::dQ>()
+                                 + 2.0 * CONVERGENCE_ORDER * tensor::QInterpolated::size());
+  double elems = static_cast<double>(nrOfFaces);
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return elems * timesteps * bytes;
+}
+
+double bytes_alldr(unsigned int i_timesteps) {
+  return bytes_drgod(i_timesteps) + bytes_neigh(i_timesteps);
+}
+
+double bytes_plasticity(unsigned int i_timesteps) {
+  unsigned nrOfCells = m_ltsTree->child(0).child<Interior>().getNumberOfCells();
+
+  // the pre-check reads the DOFs, candidates read and write DOFs and plastic strain
+  double preCheckBytes = sizeof(real) * tensor::Q::size() + sizeof(PlasticityData);
+  double candidateBytes = sizeof(real) * 2.0 * (tensor::Q::size() + 7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS);
+  double elems = static_cast<double>(nrOfCells);
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return elems * timesteps * preCheckBytes + static_cast<double>(m_numberOfPlasticityCandidates) * candidateBytes;
+}
+
+double bytes_source(unsigned int i_timesteps) {
+  // source data per source and read/write of the DOFs per cell with sources
+  double sourceBytes = sizeof(real) * (tensor::mInvJInvPhisAtSources::size() + seissol::sourceterm::PointSources::TensorSize);
+  double cellBytes = sizeof(real) * 2.0 * tensor::Q::size();
+  double sources = static_cast<double>(m_pointSources->numberOfSources);
+  double cells = static_cast<double>(m_cellToPointSources.size());
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return timesteps * (sources * sourceBytes + cells * cellBytes);
+}
+
+double bytes_receiver(unsigned int i_timesteps) {
+  // the Taylor expansion reads the derivatives in every sample
+  double bytes = static_cast<double>(m_timeKernel.bytesAder())
+               + ReceiverSamplesPerTimeStep * sizeof(real) * yateto::computeFamilySize<tensor::dQ>();
+  double receivers = static_cast<double>(std::distance(m_receiverCluster->begin(), m_receiverCluster->end()));
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return receivers * timesteps * bytes;
+}
+
+double bytes_clustered(unsigned int i_timesteps, bool local, bool neighboring) {
+  double bytes = 0.0;
+  double cellBytes = 0.0;
+  if (local) {
+    cellBytes += static_cast<double>(m_timeKernel.bytesAder() + m_localKernel.bytesIntegral());
+  }
+  if (neighboring) {
+    cellBytes += static_cast<double>(m_neighborKernel.bytesNeighborsIntegral());
+  }
+  double derivativesBytes = sizeof(real) * yateto::computeFamilySize<tensor::dQ>();
+
+  for (unsigned tc = 0; tc < m_clusterSteps.size(); ++tc) {
+    auto& cluster = m_ltsTree->child(tc);
+    double steps = static_cast<double>(m_clusterSteps[tc]);
+
+    for (auto* layer : {&cluster.child<Copy>(), &cluster.child<Interior>()}) {
+      CellLocalInformation* cellInformation = layer->var(m_lts.cellInformation);
+
+      for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
+        double bytesCell = cellBytes;
+        for (unsigned face = 0; face < 4 && neighboring; ++face) {
+          if ((cellInformation[cell].ltsSetup >> face) % 2 == 1
+              && cellInformation[cell].faceTypes[face] != FaceType::outflow
+              && cellInformation[cell].faceTypes[face] != FaceType::dynamicRupture) {
+            bytesCell += derivativesBytes;
+          }
+        }
+        bytes += steps * bytesCell;
+      }
+    }
+  }
+
+  return static_cast<double>(i_timesteps) * bytes;
+}
+
+double bytes_lts_local(unsigned int i_timesteps) {
+  return bytes_clustered(i_timesteps, true, false);
+}
+
+double bytes_lts_neigh(unsigned int i_timesteps) {
+  return bytes_clustered(i_timesteps, false, true);
+}
+
+double bytes_lts(unsigned int i_timesteps) {
+  return bytes_clustered(i_timesteps, true, true);
+}
+
 double noestimate(unsigned) {
   return 0.0;
 }
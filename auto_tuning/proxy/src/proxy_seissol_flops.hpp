@@ -25,6 +25,8 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <generated_code/kernel.h>
+
 typedef struct seissol_flops {
   long long d_nonZeroFlops;
   long long d_hardwareFlops;
@@ -148,4 +150,141 @@ seissol_flops flops_all_actual(unsigned int i_timesteps) {
   return ret;
 }
 
+seissol_flops flops_alldr_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+  seissol_flops tmp;
+
+  tmp = flops_drgod_actual(i_timesteps);
+  ret.d_nonZeroFlops = tmp.d_nonZeroFlops;
+  ret.d_hardwareFlops = tmp.d_hardwareFlops;
+
+  tmp = flops_neigh_actual(i_timesteps);
+  ret.d_nonZeroFlops += tmp.d_nonZeroFlops;
+  ret.d_hardwareFlops += tmp.d_hardwareFlops;
+
+  return ret;
+}
+
+seissol_flops flops_plasticity_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+  long long nonZeroFlopsPreCheck, hardwareFlopsPreCheck;
+  long long nonZeroFlopsCheck, hardwareFlopsCheck, nonZeroFlopsYield, hardwareFlopsYield;
+  seissol::kernels::Plasticity::flopsYieldPreCheck(nonZeroFlopsPreCheck, hardwareFlopsPreCheck);
+  seissol::kernels::Plasticity::flopsPlasticity(nonZeroFlopsCheck, hardwareFlopsCheck, nonZeroFlopsYield, hardwareFlopsYield);
+
+  // candidates and yielding cells are counted while the proxy runs
+  long long nrOfCells = m_ltsTree->child(0).child<Interior>().getNumberOfCells();
+  ret.d_nonZeroFlops = i_timesteps * nrOfCells * nonZeroFlopsPreCheck
+                     + m_numberOfPlasticityCandidates * nonZeroFlopsCheck
+                     + m_numberOfYieldingCells * nonZeroFlopsYield;
+  ret.d_hardwareFlops = i_timesteps * nrOfCells * hardwareFlopsPreCheck
+                      + m_numberOfPlasticityCandidates * hardwareFlopsCheck
+                      + m_numberOfYieldingCells * hardwareFlopsYield;
+
+  return ret;
+}
+
+seissol_flops flops_source_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+
+  // moment tensor scaling and rank-1 update per source, all sources are active
+  long long nrOfSources = m_pointSources->numberOfSources;
+  ret.d_nonZeroFlops = i_timesteps * nrOfSources * (seissol::sourceterm::PointSources::TensorSize + seissol::kernel::sourceFSRM::NonZeroFlops);
+  ret.d_hardwareFlops = i_timesteps * nrOfSources * (seissol::sourceterm::PointSources::TensorSize + seissol::kernel::sourceFSRM::HardwareFlops);
+
+  return ret;
+}
+
+seissol_flops flops_receiver_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+  unsigned int aderNonZeroFlops, aderHardwareFlops;
+  long long taylorNonZeroFlops, taylorHardwareFlops;
+  m_timeKernel.flopsAder(aderNonZeroFlops, aderHardwareFlops);
+  m_timeKernel.flopsTaylorExpansion(taylorNonZeroFlops, taylorHardwareFlops);
+
+  long long nrOfReceivers = std::distance(m_receiverCluster->begin(), m_receiverCluster->end());
+  ret.d_nonZeroFlops = i_timesteps * nrOfReceivers * (aderNonZeroFlops
+                     + ReceiverSamplesPerTimeStep * (taylorNonZeroFlops + seissol::kernel::evaluateDOFSAtPoint::NonZeroFlops));
+  ret.d_hardwareFlops = i_timesteps * nrOfReceivers * (aderHardwareFlops
+                      + ReceiverSamplesPerTimeStep * (taylorHardwareFlops + seissol::kernel::evaluateDOFSAtPoint::HardwareFlops));
+
+  return ret;
+}
+
+seissol_flops flops_clustered(unsigned int i_timesteps, bool local, bool neighboring) {
+  seissol_flops ret;
+  ret.d_nonZeroFlops = 0.0;
+  ret.d_hardwareFlops = 0.0;
+
+  unsigned int aderNonZeroFlops, aderHardwareFlops;
+  long long integralNonZeroFlops, integralHardwareFlops;
+  m_timeKernel.flopsAder(aderNonZeroFlops, aderHardwareFlops);
+  // the time integration of derivatives evaluates the same kernels as the Taylor expansion
+  m_timeKernel.flopsTaylorExpansion(integralNonZeroFlops, integralHardwareFlops);
+
+  for (unsigned tc = 0; tc < m_clusterSteps.size(); ++tc) {
+    auto& cluster = m_ltsTree->child(tc);
+    const long long steps = m_clusterSteps[tc];
+    // buffers are reset in the first time step of the next slower cluster and accumulated otherwise
+    const long long accumulatingSteps = (tc + 1 < m_clusterSteps.size()) ? steps - m_clusterSteps[tc+1] : 0;
+
+    for (auto* layer : {&cluster.child<Copy>(), &cluster.child<Interior>()}) {
+      unsigned              nrOfCells       = layer->getNumberOfCells();
+      CellLocalInformation* cellInformation = layer->var(m_lts.cellInformation);
+      CellDRMapping        (*drMapping)[4]  = layer->var(m_lts.drMapping);
+
+      for (unsigned cell = 0; cell < nrOfCells; ++cell) {
+        unsigned int l_nonZeroFlops, l_hardwareFlops;
+        long long l_drNonZeroFlops, l_drHardwareFlops;
+        long long cellNonZeroFlops = 0;
+        long long cellHardwareFlops = 0;
+
+        if (local) {
+          m_localKernel.flopsIntegral(cellInformation[cell].faceTypes, l_nonZeroFlops, l_hardwareFlops);
+          cellNonZeroFlops += aderNonZeroFlops + l_nonZeroFlops;
+          cellHardwareFlops += aderHardwareFlops + l_hardwareFlops;
+
+          if ((cellInformation[cell].ltsSetup >> 10) % 2 == 1) {
+            ret.d_nonZeroFlops += accumulatingSteps * tensor::I::size();
+            ret.d_hardwareFlops += accumulatingSteps * tensor::I::size();
+          }
+        }
+
+        if (neighboring) {
+          m_neighborKernel.flopsNeighborsIntegral( cellInformation[cell].faceTypes, cellInformation[cell].faceRelations, drMapping[cell], l_nonZeroFlops, l_hardwareFlops, l_drNonZeroFlops, l_drHardwareFlops );
+          cellNonZeroFlops += l_nonZeroFlops + l_drNonZeroFlops;
+          cellHardwareFlops += l_hardwareFlops + l_drHardwareFlops;
+
+          for (unsigned face = 0; face < 4; ++face) {
+            if ((cellInformation[cell].ltsSetup >> face) % 2 == 1
+                && cellInformation[cell].faceTypes[face] != FaceType::outflow
+                && cellInformation[cell].faceTypes[face] != FaceType::dynamicRupture) {
+              cellNonZeroFlops += integralNonZeroFlops;
+              cellHardwareFlops += integralHardwareFlops;
+            }
+          }
+        }
+
+        ret.d_nonZeroFlops += steps * cellNonZeroFlops;
+        ret.d_hardwareFlops += steps * cellHardwareFlops;
+      }
+    }
+  }
+
+  ret.d_nonZeroFlops *= i_timesteps;
+  ret.d_hardwareFlops *= i_timesteps;
+
+  return ret;
+}
+
+seissol_flops flops_lts_local_actual(unsigned int i_timesteps) {
+  return flops_clustered(i_timesteps, true, false);
+}
 
+seissol_flops flops_lts_neigh_actual(unsigned int i_timesteps) {
+  return flops_clustered(i_timesteps, false, true);
+}
+
+seissol_flops flops_lts_actual(unsigned int i_timesteps) {
+  return flops_clustered(i_timesteps, true, true);
+}
@@ -26,6 +26,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <generated_code/tensor.h>
+#include <cmath>
 
 namespace tensor = seissol::tensor;
 namespace kernels = seissol::kernels;
@@ -37,6 +38,9 @@ void registerMarkers() {
         LIKWID_MARKER_REGISTER("localwoader");
         LIKWID_MARKER_REGISTER("local");
         LIKWID_MARKER_REGISTER("neighboring");
+        LIKWID_MARKER_REGISTER("source");
+        LIKWID_MARKER_REGISTER("lts_local");
+        LIKWID_MARKER_REGISTER("lts_neighboring");
     }
 }
 
@@ -239,4 +243,192 @@ namespace proxy::cpu {
                                               timeDerivativeMinus[prefetchFace] );
     }
   }
+
+  void computePlasticity() {
+    auto&     layer     = m_ltsTree->child(0).child<Interior>();
+    // the relaxation time is large compared to the time step such that the yielding cells keep on yielding
+    const double T_v = 100.0 * seissol::miniSeisSolTimeStep;
+    const double oneMinusIntegratingFactor = 1.0 - exp(-seissol::miniSeisSolTimeStep / T_v);
+
+    unsigned numberOfCandidates = 0;
+    m_numberOfYieldingCells += seissol::kernels::Plasticity::computePlasticityLayer(oneMinusIntegratingFactor,
+                                                                                    seissol::miniSeisSolTimeStep,
+                                                                                    T_v,
+                                                                                    &m_globalDataOnHost,
+                                                                                    m_plasticityBounds,
+                                                                                    layer.getNumberOfCells(),
+                                                                                    layer.var(m_lts.plasticity),
+                                                                                    layer.var(m_lts.dofs),
+                                                                                    layer.var(m_lts.pstrain),
+                                                                                    m_plasticityCandidates.data(),
+                                                                                    numberOfCandidates);
+    m_numberOfPlasticityCandidates += numberOfCandidates;
+  }
+
+  void computeSourceIntegration(unsigned timestep) {
+    const double fromTime = timestep * seissol::miniSeisSolTimeStep;
+    const double toTime = fromTime + seissol::miniSeisSolTimeStep;
+    const unsigned numberOfMappings = m_cellToPointSources.size();
+
+  #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    LIKWID_MARKER_START("source");
+    #pragma omp for schedule(static)
+  #endif
+    for (unsigned mapping = 0; mapping < numberOfMappings; ++mapping) {
+      auto const& cellToSources = m_cellToPointSources[mapping];
+      seissol::sourceterm::addTimeIntegratedPointSources(*m_pointSources,
+                                                         cellToSources.pointSourcesOffset,
+                                                         cellToSources.numberOfPointSources,
+                                                         fromTime,
+                                                         toTime,
+                                                         *cellToSources.dofs);
+    }
+  #ifdef _OPENMP
+    LIKWID_MARKER_STOP("source");
+    }
+  #endif
+  }
+
+  void computeReceivers(unsigned timestep) {
+    const double time = timestep * seissol::miniSeisSolTimeStep;
+    m_receiverCluster->calcReceivers(time, time, seissol::miniSeisSolTimeStep);
+    // the output is written to disk at sync points in SeisSol
+    for (auto& receiver : *m_receiverCluster) {
+      receiver.output.clear();
+    }
+  }
+
+  void computeClusterLocalIntegration(unsigned timeCluster, double timeStepWidth, bool resetBuffers) {
+    auto& cluster = m_ltsTree->child(timeCluster);
+    for (auto* layer : {&cluster.child<Copy>(), &cluster.child<Interior>()}) {
+      unsigned              nrOfCells       = layer->getNumberOfCells();
+      real**                buffers                       = layer->var(m_lts.buffers);
+      real**                derivatives                   = layer->var(m_lts.derivatives);
+
+      kernels::LocalData::Loader loader;
+      loader.load(m_lts, *layer);
+
+    #ifdef _OPENMP
+      #pragma omp parallel
+      {
+      LIKWID_MARKER_START("lts_local");
+      kernels::LocalTmp tmp;
+      alignas(ALIGNMENT) real integrationBuffer[tensor::I::size()];
+      #pragma omp for schedule(static)
+    #else
+      kernels::LocalTmp tmp;
+      alignas(ALIGNMENT) real integrationBuffer[tensor::I::size()];
+    #endif
+      for( unsigned int l_cell = 0; l_cell < nrOfCells; l_cell++ ) {
+        auto data = loader.entry(l_cell);
+        const bool accumulate = !resetBuffers && (data.cellInformation.ltsSetup >> 10) % 2 == 1;
+        real* bufferPointer = accumulate ? integrationBuffer : buffers[l_cell];
+
+        m_timeKernel.computeAder(      timeStepWidth,
+                                       data,
+                                       tmp,
+                                       bufferPointer,
+                                       derivatives[l_cell] );
+        m_localKernel.computeIntegral(bufferPointer,
+                                      data,
+                                      tmp,
+                                      nullptr,
+                                      nullptr,
+                                      0,
+                                      0);
+
+        if (accumulate) {
+          for (unsigned dof = 0; dof < tensor::I::size(); ++dof) {
+            buffers[l_cell][dof] += integrationBuffer[dof];
+          }
+        }
+      }
+    #ifdef _OPENMP
+      LIKWID_MARKER_STOP("lts_local");
+      }
+    #endif
+    }
+  }
+
+  void computeClusterNeighboringIntegration(unsigned timeCluster, double subTimeStart, double timeStepWidth) {
+    auto& cluster = m_ltsTree->child(timeCluster);
+    for (auto* layer : {&cluster.child<Copy>(), &cluster.child<Interior>()}) {
+      unsigned                  nrOfCells                       = layer->getNumberOfCells();
+      real*                     (*faceNeighbors)[4]             = layer->var(m_lts.faceNeighbors);
+      CellDRMapping             (*drMapping)[4]                 = layer->var(m_lts.drMapping);
+      CellLocalInformation*       cellInformation               = layer->var(m_lts.cellInformation);
+
+      kernels::NeighborData::Loader loader;
+      loader.load(m_lts, *layer);
+
+      real *l_timeIntegrated[4];
+
+    #ifdef _OPENMP
+      #pragma omp parallel private(l_timeIntegrated)
+      {
+      LIKWID_MARKER_START("lts_neighboring");
+      #pragma omp for schedule(static)
+    #endif
+      for( unsigned l_cell = 0; l_cell < nrOfCells; l_cell++ ) {
+        auto data = loader.entry(l_cell);
+        seissol::kernels::TimeCommon::computeIntegrals( m_timeKernel,
+                                                        cellInformation[l_cell].ltsSetup,
+                                                        cellInformation[l_cell].faceTypes,
+                                                        subTimeStart,
+                                                        timeStepWidth,
+                                                        faceNeighbors[l_cell],
+    #ifdef _OPENMP
+                                                        *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost.integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
+    #else
+                                                        *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalDataOnHost.integrationBufferLTS),
+    #endif
+                                                        l_timeIntegrated );
+
+        m_neighborKernel.computeNeighborsIntegral( data,
+                                                   drMapping[l_cell],
+    #ifdef ENABLE_MATRIX_PREFETCH
+                                                   l_timeIntegrated, faceNeighbors[l_cell]
+    #else
+                                                   l_timeIntegrated
+    #endif
+                                                   );
+      }
+
+    #ifdef _OPENMP
+      LIKWID_MARKER_STOP("lts_neighboring");
+      }
+    #endif
+    }
+  }
+
+  /** One time step of the slowest cluster. Time is counted in ticks, i.e., time steps of the
+   *  fastest cluster. At every tick the clusters whose time step ends are corrected before the
+   *  clusters whose time step starts are predicted, from the fastest to the slowest cluster. */
+  void computeClusteredIntegration(bool local, bool neighboring) {
+    const unsigned numberOfClusters = m_clusterSteps.size();
+    const unsigned numberOfTicks = m_clusterSteps[0];
+
+    for (unsigned tick = 0; tick <= numberOfTicks; ++tick) {
+      for (unsigned tc = 0; tc < numberOfClusters && neighboring; ++tc) {
+        const unsigned ticksPerStep = numberOfTicks / m_clusterSteps[tc];
+        if (tick > 0 && tick % ticksPerStep == 0) {
+          // derivatives of the next slower cluster are expanded at the start of its time step
+          const unsigned stepStart = tick - ticksPerStep;
+          const unsigned ticksPerSlowerStep = (tc + 1 < numberOfClusters) ? numberOfTicks / m_clusterSteps[tc+1] : numberOfTicks;
+          const double subTimeStart = (stepStart % ticksPerSlowerStep) / ticksPerStep * m_clusterTimeStepWidths[tc];
+          computeClusterNeighboringIntegration(tc, subTimeStart, m_clusterTimeStepWidths[tc]);
+        }
+      }
+      for (unsigned tc = 0; tc < numberOfClusters && local && tick < numberOfTicks; ++tc) {
+        const unsigned ticksPerStep = numberOfTicks / m_clusterSteps[tc];
+        if (tick % ticksPerStep == 0) {
+          // buffers are accumulated over the time step of the next slower cluster
+          const bool resetBuffers = (tc + 1 == numberOfClusters) || tick % (numberOfTicks / m_clusterSteps[tc+1]) == 0;
+          computeClusterLocalIntegration(tc, m_clusterTimeStepWidths[tc], resetBuffers);
+        }
+      }
+    }
+  }
 } // namespace proxy::cpu
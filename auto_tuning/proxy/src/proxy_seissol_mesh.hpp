@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2023, SeisSol Group
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ **/
+
+
+#include <Geometry/MeshReader.h>
+#include <Geometry/MeshTools.h>
+#ifdef USE_NETCDF
+#include <Geometry/NetcdfReader.h>
+#endif
+#if defined(USE_METIS) && defined(USE_HDF) && defined(USE_MPI)
+#include <Geometry/PUMLReader.h>
+#endif
+#include <Initializer/MemoryManager.h>
+#include <Initializer/time_stepping/LtsLayout.h>
+#include <Initializer/time_stepping/common.hpp>
+#include <Parallel/MPI.h>
+#include <cmath>
+#include <limits>
+#include <string>
+
+// the mesh, the layout derived from it and the memory manager owning m_ltsTree in mesh mode
+MeshReader*                  m_meshReader{nullptr};
+seissol::initializers::time_stepping::LtsLayout* m_ltsLayout{nullptr};
+seissol::initializers::MemoryManager* m_memoryManager{nullptr};
+// referenced by the memory manager; like SeisSol, the proxy keeps it for the lifetime of the process
+MeshStructure*                        m_meshStructure{nullptr};
+
+// p-wave speed and CFL number used to derive the time step widths of the mesh cells
+constexpr double ProxyMeshWaveSpeed = 6000.0;
+constexpr double ProxyMeshCfl = 0.5;
+
+void initMeshMpi() {
+#ifdef USE_MPI
+  // the Python bindings do not go through proxy_main
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if (!initialized) {
+    int argc = 0;
+    char** argv = nullptr;
+    seissol::MPI::mpi.init(argc, argv);
+  }
+#endif
+}
+
+MeshReader* readProxyMesh(const std::string& meshFile) {
+  const bool isNetcdf = meshFile.size() > 3 && meshFile.compare(meshFile.size() - 3, 3, ".nc") == 0;
+  if (isNetcdf) {
+#ifdef USE_NETCDF
+    return new NetcdfReader(seissol::MPI::mpi.rank(), seissol::MPI::mpi.size(), meshFile.c_str());
+#else
+    logError() << "The proxy was compiled without NetCDF support, cannot read" << meshFile;
+#endif
+  }
+#if defined(USE_METIS) && defined(USE_HDF) && defined(USE_MPI)
+  return new seissol::PUMLReader(meshFile.c_str(), std::numeric_limits<double>::infinity(), "");
+#else
+  logError() << "The proxy was compiled without PUML support, cannot read" << meshFile;
+  return nullptr;
+#endif
+}
+
+/** CFL time step width of an element, using the distance of the barycenter to the closest face. */
+double proxyTimeStepWidth(const Element& element, const std::vector<Vertex>& vertices) {
+  VrtxCoords barycenter;
+  MeshTools::center(element, vertices, barycenter);
+
+  double minDistance = std::numeric_limits<double>::max();
+  for (int face = 0; face < 4; ++face) {
+    VrtxCoords faceCenter;
+    VrtxCoords normal;
+    VrtxCoords diff;
+    MeshTools::center(element, face, vertices, faceCenter);
+    MeshTools::normal(element, face, vertices, normal);
+    MeshTools::sub(faceCenter, barycenter, diff);
+    minDistance = std::min(minDistance, std::abs(MeshTools::dot(diff, normal)) / MeshTools::norm(normal));
+  }
+
+  return ProxyMeshCfl * 2.0 * minDistance / (ProxyMeshWaveSpeed * (2.0 * (CONVERGENCE_ORDER - 1) + 1.0));
+}
+
+/**
+ * Sets up m_ltsTree from the connectivity and the clustered LTS layout of a mesh, as SeisSol does.
+ * Dynamic rupture faces are integrated as regular faces and all boundary conditions as free
+ * surface since the proxy evaluates neither friction laws nor boundary data.
+ *
+ * @return number of copy and interior cells.
+ **/
+unsigned int initMeshDataStructures(const std::string& meshFile, unsigned int clusterRate) {
+  using namespace seissol::initializers;
+
+  initMeshMpi();
+  if (seissol::MPI::mpi.size() > 1) {
+    logWarning() << "The proxy does not communicate, ghost layers are filled once and never updated.";
+  }
+
+  m_meshReader = readProxyMesh(meshFile);
+  const auto& elements = m_meshReader->getElements();
+  const auto& vertices = m_meshReader->getVertices();
+
+  m_ltsLayout = new time_stepping::LtsLayout;
+  m_ltsLayout->setMesh(*m_meshReader);
+  for (unsigned cell = 0; cell < elements.size(); ++cell) {
+    m_ltsLayout->setTimeStepWidth(cell, proxyTimeStepWidth(elements[cell], vertices));
+  }
+  if (clusterRate <= 1) {
+    m_ltsLayout->deriveLayout(single, 1);
+  } else {
+    m_ltsLayout->deriveLayout(multiRate, clusterRate);
+  }
+
+  TimeStepping timeStepping;
+  m_ltsLayout->getMeshStructure(m_meshStructure);
+  m_ltsLayout->getCrossClusterTimeStepping(timeStepping);
+
+  unsigned* ltsToFace = nullptr;
+  unsigned* numberOfDRCopyFaces = nullptr;
+  unsigned* numberOfDRInteriorFaces = nullptr;
+  m_ltsLayout->getDynamicRuptureInformation(ltsToFace, numberOfDRCopyFaces, numberOfDRInteriorFaces);
+
+  m_memoryManager = new MemoryManager;
+  // a memory dry run (SEISSOL_MEMORY_DRY_RUN) leaves the trees unallocated
+  if (!m_memoryManager->fixateLtsTree(timeStepping, m_meshStructure, numberOfDRCopyFaces, numberOfDRInteriorFaces, false)) {
+    logError() << "The proxy cannot run without memory, unset SEISSOL_MEMORY_DRY_RUN.";
+  }
+  delete[] ltsToFace;
+  delete[] numberOfDRCopyFaces;
+  delete[] numberOfDRInteriorFaces;
+
+  m_ltsTree = m_memoryManager->getLtsTree();
+  m_lts = *m_memoryManager->getLts();
+
+  unsigned* ltsToMesh = nullptr;
+  unsigned numberOfMeshCells = 0;
+  CellLocalInformation* cellInformation = m_ltsTree->var(m_lts.cellInformation);
+  m_ltsLayout->getCellInformation(cellInformation, ltsToMesh, numberOfMeshCells);
+  delete[] ltsToMesh;
+
+  for (unsigned cell = 0; cell < m_ltsTree->getNumberOfCells(); ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      switch (cellInformation[cell].faceTypes[face]) {
+        case FaceType::dynamicRupture:
+          cellInformation[cell].faceTypes[face] = FaceType::regular;
+          break;
+        case FaceType::freeSurfaceGravity:
+        case FaceType::dirichlet:
+        case FaceType::analytical:
+          cellInformation[cell].faceTypes[face] = FaceType::freeSurface;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  time_stepping::deriveLtsSetups(timeStepping.numberOfLocalClusters, m_meshStructure, cellInformation);
+  m_memoryManager->initializeMemoryLayout(false);
+
+  // without communication, the buffers and derivatives received by the ghost layers are filled once
+  for (unsigned tc = 0; tc < m_ltsTree->numChildren(); ++tc) {
+    Layer& ghost = m_ltsTree->child(tc).child<Ghost>();
+    seissol::fillWithStuff(static_cast<real*>(ghost.bucket(m_lts.buffersDerivatives)),
+                           ghost.getBucketSize(m_lts.buffersDerivatives) / sizeof(real));
+  }
+
+  for (auto it = m_ltsTree->beginLeaf(Ghost); it != m_ltsTree->endLeaf(); ++it) {
+    const unsigned numberOfCells = it->getNumberOfCells();
+    seissol::fillWithStuff(reinterpret_cast<real*>(it->var(m_lts.dofs)), tensor::Q::size() * numberOfCells);
+    seissol::fillWithStuff(reinterpret_cast<real*>(it->var(m_lts.localIntegration)),
+                           sizeof(LocalIntegrationData) / sizeof(real) * numberOfCells);
+    seissol::fillWithStuff(reinterpret_cast<real*>(it->var(m_lts.neighboringIntegration)),
+                           sizeof(NeighboringIntegrationData) / sizeof(real) * numberOfCells);
+#ifdef USE_POROELASTIC
+    LocalIntegrationData* localIntegration = it->var(m_lts.localIntegration);
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      localIntegration[cell].specific.typicalTimeStepWidth = seissol::miniSeisSolTimeStep;
+    }
+#endif
+  }
+
+  // clusters are sorted from fast to slow; all of them run at the CFL time step width of their cluster
+  const unsigned numberOfClusters = timeStepping.numberOfLocalClusters;
+  m_clusterSteps.resize(numberOfClusters);
+  m_clusterTimeStepWidths.resize(numberOfClusters);
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    m_clusterTimeStepWidths[tc] = timeStepping.globalCflTimeStepWidths[timeStepping.clusterIds[tc]];
+  }
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    m_clusterSteps[tc] = static_cast<unsigned>(std::lround(m_clusterTimeStepWidths.back() / m_clusterTimeStepWidths[tc]));
+  }
+
+  delete[] timeStepping.globalCflTimeStepWidths;
+  delete[] timeStepping.globalTimeStepRates;
+  delete[] timeStepping.clusterIds;
+
+  return m_ltsTree->getNumberOfCells(Ghost);
+}
+
+void freeMeshDataStructures() {
+  // m_ltsTree is owned by the memory manager
+  m_ltsTree = nullptr;
+  delete m_memoryManager;
+  delete m_ltsLayout;
+  delete m_meshReader;
+  m_memoryManager = nullptr;
+  m_ltsLayout = nullptr;
+  m_meshReader = nullptr;
+  m_clusterSteps.clear();
+  m_clusterTimeStepWidths.clear();
+}
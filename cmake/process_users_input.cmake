@@ -6,6 +6,7 @@ option(MINI_SEISSOL "Use MiniSeisSol to compute node weights for load balancing"
 option(OPENMP "Use OpenMP parallelization" ON)
 option(ASAGI "Use asagi for material input" OFF)
 option(MEMKIND "Use memkind library for hbw memory support" OFF)
+option(NUMA_LOCAL_MEMORY "Place LTS data by first touch per NUMA domain, optionally on huge pages" OFF)
 option(USE_IMPALA_JIT_LLVM "Use llvm version of impalajit" OFF)
 option(LIKWID "Link with the likwid marker interface for proxy" OFF)
 
@@ -129,6 +129,17 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		param.backend = m_backend;
 		param.numBndGP = numBndGP;
 		param.loaded = exists;
+		param.background = utils::Env::get<bool>("SEISSOL_CHECKPOINT_ASYNC", false);
+		if (param.background && m_backend == MPIO_ASYNC) {
+			logWarning(seissol::MPI::mpi.rank()) << "SEISSOL_CHECKPOINT_ASYNC is ignored, the mpio_async back-end writes asynchronously already.";
+			param.background = false;
+		}
+		CPU_ZERO(&param.backgroundCpus);
+		if (param.background) {
+			param.backgroundCpus = SeisSol::main.getPinning().getFreeCPUsMask();
+			logInfo(seissol::MPI::mpi.rank()) << "Writing checkpoints in a background thread with affinity:"
+				<< parallel::Pinning::maskToString(param.backgroundCpus);
+		}
 		callInit(param);
 
 		removeBuffer(FILENAME);
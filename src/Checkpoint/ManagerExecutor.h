@@ -40,9 +40,15 @@
 #ifndef CHECKPOINT_MANAGER_EXECUTOR_H
 #define CHECKPOINT_MANAGER_EXECUTOR_H
 
+#include <sched.h>
+
+#include <cstring>
+#include <thread>
+
 #include "async/ExecInfo.h"
 
 #include "Backend.h"
+#include "Initializer/MemoryAllocator.h"
 #include "Monitoring/Stopwatch.h"
 
 namespace seissol
@@ -67,6 +73,10 @@ struct CheckpointInitParam
 	Backend backend;
 	unsigned int numBndGP;
 	bool loaded;
+	/** Write checkpoints from staging buffers in a background thread */
+	bool background;
+	/** CPUs of the background thread (empty to keep the affinity) */
+	cpu_set_t backgroundCpus;
 };
 
 /**
@@ -90,11 +100,33 @@ private:
 	/** Stopwatch for checkpoint backend */
 	Stopwatch m_stopwatch;
 
+	/** Write checkpoints in a background thread? */
+	bool m_background;
+
+	/** CPUs of the background thread */
+	cpu_set_t m_backgroundCpus;
+
+	/** Background thread writing the last checkpoint */
+	std::thread m_writer;
+
+	/** Stopwatch for the background thread */
+	Stopwatch m_writerStopwatch;
+
+	/** Staging buffers of the background thread (header, DOFs, DR DOFs) */
+	void* m_staging[3 + 8];
+
+	/** Sizes of the staging buffers */
+	size_t m_stagingSize[3 + 8];
+
 public:
 	ManagerExecutor()
 		: m_waveField(0L),
-		  m_fault(0L)
-	{ }
+		  m_fault(0L),
+		  m_background(false),
+		  m_staging{}, m_stagingSize{}
+	{
+		CPU_ZERO(&m_backgroundCpus);
+	}
 
 	virtual ~ManagerExecutor()
 	{ }
@@ -119,10 +151,20 @@ public:
 			m_fault->setLoaded();
 		}
 
-		const real* dofs = static_cast<const real*>(info.buffer(DOFS));
+		m_background = param.background;
+		m_backgroundCpus = param.backgroundCpus;
+		if (m_background) {
+			// The backends read from the staging buffers, the ASYNC buffers are reused while writing
+			for (unsigned int i = HEADER; i < DR_DOFS0 + 8; i++) {
+				m_stagingSize[i] = info.bufferSize(i);
+				m_staging[i] = seissol::memory::allocate(m_stagingSize[i], PAGESIZE_HEAP);
+			}
+		}
+
+		const real* dofs = static_cast<const real*>(buffer(info, DOFS));
 		const double* drDofs[8];
 		for (unsigned int i = 0; i < 8; i++)
-			drDofs[i] = static_cast<const double*>(info.buffer(DR_DOFS0 + i));
+			drDofs[i] = static_cast<const double*>(buffer(info, DR_DOFS0 + i));
 
 		m_waveField->initLate(dofs);
 		m_fault->initLate(drDofs[0], drDofs[1], drDofs[2], drDofs[3], drDofs[4], drDofs[5],
@@ -136,16 +178,24 @@ public:
 	{
 		m_stopwatch.start();
 
-		m_waveField->write(info.buffer(HEADER), info.bufferSize(HEADER));
-		m_fault->write(param.faultTimeStep);
+		if (m_background) {
+			// The staging buffers still belong to the last checkpoint until it is written
+			waitForWriter();
 
-		// Update both links at the "same" time
-		m_waveField->updateLink();
-		m_fault->updateLink();
+			for (unsigned int i = HEADER; i < DR_DOFS0 + 8; i++)
+				memcpy(m_staging[i], info.buffer(i), m_stagingSize[i]);
 
-		// Prepare next checkpoint (only for async checkpoints)
-		m_waveField->writePrepare(info.buffer(HEADER), info.bufferSize(HEADER));
-		m_fault->writePrepare(param.faultTimeStep);
+			m_writer = std::thread([this, param]() {
+				if (CPU_COUNT(&m_backgroundCpus) > 0)
+					sched_setaffinity(0, sizeof(cpu_set_t), &m_backgroundCpus);
+
+				m_writerStopwatch.start();
+				write(m_staging[HEADER], m_stagingSize[HEADER], param.faultTimeStep);
+				m_writerStopwatch.pause();
+			});
+		} else {
+			write(info.buffer(HEADER), info.bufferSize(HEADER), param.faultTimeStep);
+		}
 
 		m_stopwatch.pause();
 	}
@@ -153,7 +203,16 @@ public:
 	void finalize()
 	{
 		if (m_waveField) {
+			waitForWriter();
+
 			m_stopwatch.printTime("Time checkpoint backend:");
+			if (m_background) {
+				m_writerStopwatch.printTime("Time checkpoint background writer:");
+				for (unsigned int i = HEADER; i < DR_DOFS0 + 8; i++) {
+					seissol::memory::free(m_staging[i]);
+					m_staging[i] = 0L;
+				}
+			}
 
 			m_waveField->close();
 			m_fault->close();
@@ -164,6 +223,38 @@ public:
 			m_fault = 0L;
 		}
 	}
+
+private:
+	const void* buffer(const async::ExecInfo &info, unsigned int id) const
+	{
+		if (m_background)
+			return m_staging[id];
+		return info.buffer(id);
+	}
+
+	/**
+	 * Writes a checkpoint and switches the links afterwards, such that they always point to
+	 * a complete checkpoint
+	 */
+	void write(const void* header, size_t headerSize, int faultTimeStep)
+	{
+		m_waveField->write(header, headerSize);
+		m_fault->write(faultTimeStep);
+
+		// Update both links at the "same" time
+		m_waveField->updateLink();
+		m_fault->updateLink();
+
+		// Prepare next checkpoint (only for async checkpoints)
+		m_waveField->writePrepare(header, headerSize);
+		m_fault->writePrepare(faultTimeStep);
+	}
+
+	void waitForWriter()
+	{
+		if (m_writer.joinable())
+			m_writer.join();
+	}
 };
 
 }
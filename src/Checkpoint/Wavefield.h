@@ -93,7 +93,15 @@ public:
 		  m_dofsPerIteration((1ul<<30) / sizeof(real))
 	{}
 
-	virtual ~Wavefield() {}
+	virtual ~Wavefield()
+	{
+#ifdef USE_MPI
+		// Free the duplicate communicator of init(), the executor deletes the back-ends before MPI is finalized
+		MPI_Comm waveFieldComm = comm();
+		if (waveFieldComm != MPI_COMM_NULL)
+			MPI_Comm_free(&waveFieldComm);
+#endif // USE_MPI
+	}
 
 	/**
 	 * Set the header for loading checkpoints.
@@ -124,7 +132,10 @@ public:
 
 #ifdef USE_MPI
 		// Setup rank, partitions, ...
-		setComm(seissol::MPI::mpi.comm());
+		// (on a separate communicator, checkpoints might be written by a background thread)
+		MPI_Comm comm;
+		MPI_Comm_dup(seissol::MPI::mpi.comm(), &comm);
+		setComm(comm);
 #endif // USE_MPI
 
 		logInfo(rank()) << "Initializing check pointing";
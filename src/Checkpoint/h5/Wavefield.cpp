@@ -277,7 +277,7 @@ hid_t seissol::checkpoint::h5::Wavefield::initFile(int odd, const char* filename
 			checkH5Err(H5Pset_alignment(h5plist, 1, align));
 #ifdef USE_MPI
 		MPIInfo info;
-		checkH5Err(H5Pset_fapl_mpio(h5plist, seissol::MPI::mpi.comm(), info.get()));
+		checkH5Err(H5Pset_fapl_mpio(h5plist, comm(), info.get()));
 #endif // USE_MPI
 
 		h5file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, h5plist);
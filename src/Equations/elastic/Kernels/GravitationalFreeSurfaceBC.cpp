@@ -1,12 +1,47 @@
 #include "GravitationalFreeSurfaceBC.h"
 #include "SeisSol.h"
 
+#include <cmath>
+
 namespace seissol {
 
 double getGravitationalAcceleration() {
   return SeisSol::main.getGravitationSetup().acceleration;
 }
 
+GravityFace GravitationalFreeSurfaceBc::prepareFace(unsigned faceIdx,
+                                                    const CellBoundaryMapping& boundaryMapping,
+                                                    real* derivatives,
+                                                    [[maybe_unused]] const CellMaterialData& materialData) {
+  assert(boundaryMapping.nodes != nullptr);
+  assert(boundaryMapping.TinvData != nullptr);
+  assert(boundaryMapping.TData != nullptr);
+
+  GravityFace gravityFace{};
+  gravityFace.TinvData = boundaryMapping.TinvData;
+  gravityFace.derivatives = derivatives;
+  gravityFace.face = faceIdx;
+
+  // Extract part that rotates velocity from T
+  auto Tinv = init::Tinv::view::create(boundaryMapping.TinvData);
+  auto T = init::Tinv::view::create(boundaryMapping.TData);
+  auto rotateDisplacementToFaceNormal = init::displacementRotationMatrix::view::create(gravityFace.rotateDisplacementToFaceNormal);
+  auto rotateDisplacementToGlobal = init::displacementRotationMatrix::view::create(gravityFace.rotateDisplacementToGlobal);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      rotateDisplacementToFaceNormal(i, j) = Tinv(i + 6, j + 6);
+      rotateDisplacementToGlobal(i, j) = T(i + 6, j + 6);
+    }
+  }
+
+#ifdef USE_ELASTIC
+  gravityFace.rho = materialData.local.rho;
+  gravityFace.impedance = std::sqrt(materialData.local.lambda * gravityFace.rho);
+#endif
+
+  return gravityFace;
+}
+
 std::pair<long long, long long>
 GravitationalFreeSurfaceBc::getFlopsDisplacementFace(unsigned int face, FaceType faceType) {
   long long hardwareFlops = 0;
@@ -10,18 +10,49 @@
 #include "Numerical_aux/Quadrature.h"
 #include "Numerical_aux/ODEInt.h"
 
+#include <algorithm>
+#include <cassert>
+
 namespace seissol {
 
 // Used to avoid including SeisSo.h here as this leads to all sorts of issues
 double getGravitationalAcceleration();
 
+/**
+ * Precomputed data of a face with gravitational free surface boundary condition,
+ * see GravitationalFreeSurfaceBc::evaluateBatch.
+ */
+struct GravityFace {
+  //! rotation of the displacement to the face-aligned and to the global coordinate system
+  alignas(ALIGNMENT) real rotateDisplacementToFaceNormal[init::displacementRotationMatrix::Size];
+  alignas(ALIGNMENT) real rotateDisplacementToGlobal[init::displacementRotationMatrix::Size];
+
+  real* TinvData;
+
+  //! time derivatives of the cell, valid after the ADER step of the cell
+  real* derivatives;
+
+  unsigned face;
+
+  double rho;
+  double impedance;
+};
+
 class GravitationalFreeSurfaceBc {
 public:
+  //! number of faces which are integrated together
+  static constexpr unsigned BatchSize = 16;
+
   GravitationalFreeSurfaceBc() = default;
 
   static std::pair<long long, long long> getFlopsDisplacementFace(unsigned face,
                                                                   [[maybe_unused]] FaceType faceType);
 
+  static GravityFace prepareFace(unsigned faceIdx,
+                                 const CellBoundaryMapping& boundaryMapping,
+                                 real* derivatives,
+                                 const CellMaterialData& materialData);
+
   template<typename TimeKrnl, typename MappingKrnl>
   void evaluate(unsigned faceIdx,
                 MappingKrnl&& projectKernelPrototype,
@@ -34,6 +65,30 @@ public:
                 double timeStepWidth,
                 CellMaterialData& materialData,
                 FaceType faceType) {
+    const GravityFace gravityFace = prepareFace(faceIdx, boundaryMapping, derivatives, materialData);
+    evaluateBatch(projectKernelPrototype,
+                  timeKernel,
+                  &gravityFace,
+                  1,
+                  displacementNodalData,
+                  integratedDisplacementNodalData,
+                  timeStepWidth);
+  }
+
+  /**
+   * Advances the displacements of numberOfFaces faces by one time step and computes the
+   * integrals of their normal displacements over the time step.
+   * The displacements (tensor faceDisplacement) and the integrals (tensor averageNormalDisplacement)
+   * of the faces are stored contiguously.
+   */
+  template<typename TimeKrnl, typename MappingKrnl>
+  static void evaluateBatch(MappingKrnl&& projectKernelPrototype,
+                            TimeKrnl& timeKernel,
+                            const GravityFace* faces,
+                            unsigned numberOfFaces,
+                            real* displacements,
+                            real* integratedDisplacements,
+                            double timeStepWidth) {
     // This function does two things:
     // 1: Compute eta (for all three dimensions) at the end of the timestep
     // 2: Compute the integral of eta in normal direction over the timestep
@@ -44,125 +99,133 @@ public:
     // and substituting the previous coefficient eta_t
     // This implementation sums up the Taylor series directly without storing
     // all coefficients.
-
-    // Prepare kernel that projects volume data to face and rotates it to face-nodal basis.
-    assert(boundaryMapping.nodes != nullptr);
-    assert(boundaryMapping.TinvData != nullptr);
-    assert(boundaryMapping.TData != nullptr);
-    auto Tinv = init::Tinv::view::create(boundaryMapping.TinvData);
-    auto T = init::Tinv::view::create(boundaryMapping.TData);
-    auto projectKernel = projectKernelPrototype;
-    projectKernel.Tinv = Tinv.data();
-
-    // Prepare projection of displacement/velocity to face-nodal basis.
-    alignas(ALIGNMENT) real rotateDisplacementToFaceNormalData[init::displacementRotationMatrix::Size];
-    auto rotateDisplacementToFaceNormal = init::displacementRotationMatrix::view::create(rotateDisplacementToFaceNormalData);
-    alignas(ALIGNMENT) real rotateDisplacementToGlobalData[init::displacementRotationMatrix::Size];
-    auto rotateDisplacementToGlobal = init::displacementRotationMatrix::view::create(rotateDisplacementToGlobalData);
-    for (int i = 0; i < 3; ++i) {
-      for (int j = 0; j < 3; ++j) {
-        // Extract part that rotates velocity from T
-        rotateDisplacementToFaceNormal(i, j) = Tinv(i + 6, j + 6);
-        rotateDisplacementToGlobal(i,j) = T(i+6, j+6);
-      }
-    }
+    // The faces are processed in batches of BatchSize, such that the order loop runs over all
+    // faces of a batch and the per-face setup is hoisted out of the time integration.
+    constexpr auto numberOfNodes = nodal::tensor::nodes2D::Shape[0];
+    constexpr auto alignedSize = [](std::size_t size) {
+      return ((size * sizeof(real) + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT / sizeof(real);
+    };
+    constexpr auto rotatedStride = alignedSize(init::rotatedFaceDisplacement::Size);
+    constexpr auto nodalStride = alignedSize(tensor::INodal::size());
+    constexpr auto coefficientStride = alignedSize(numberOfNodes);
     static_assert(init::rotatedFaceDisplacement::Size == init::faceDisplacement::Size);
-    alignas(ALIGNMENT) real rotatedFaceDisplacementData[init::rotatedFaceDisplacement::Size];
 
-    auto integratedDisplacementNodal = init::averageNormalDisplacement::view::create(integratedDisplacementNodalData);
-    auto rotatedFaceDisplacement = init::faceDisplacement::view::create(rotatedFaceDisplacementData);
+    // Rotated face displacements, nodal face dofs and nodal face coefficients of a batch
+    alignas(ALIGNMENT) real rotatedFaceDisplacementData[BatchSize * rotatedStride];
+    alignas(ALIGNMENT) real dofsFaceNodalStorage[BatchSize * nodalStride];
+    alignas(ALIGNMENT) real prevCoefficients[BatchSize * coefficientStride];
 
-    // Rotate face displacement to face-normal coordinate system in which the computation is
-    // more convenient.
+    auto* derivativesOffsets = timeKernel.getDerivativesOffsets();
     auto rotateFaceDisplacementKrnl = kernel::rotateFaceDisplacement();
-    rotateFaceDisplacementKrnl.faceDisplacement = displacementNodalData;
-    rotateFaceDisplacementKrnl.displacementRotationMatrix = rotateDisplacementToFaceNormalData;
-    rotateFaceDisplacementKrnl.rotatedFaceDisplacement = rotatedFaceDisplacementData;
-    rotateFaceDisplacementKrnl.execute();
-
-    // Temporary buffer to store dofs at some time t
-    alignas(ALIGNMENT) real dofsVolumeInteriorModalStorage[tensor::I::size()];
-    auto dofsVolumeInteriorModal = init::I::view::create(dofsVolumeInteriorModalStorage);
-
-    // Temporary buffer to store nodal face dofs at some time t
-    alignas(ALIGNMENT) real dofsFaceNodalStorage[tensor::INodal::size()];
-    auto dofsFaceNodal = init::INodal::view::create(dofsFaceNodalStorage);
-
-    // Temporary buffer to store nodal face coefficients at some time t
-    alignas(ALIGNMENT) std::array<real, nodal::tensor::nodes2D::Shape[0]> prevCoefficients;
 
     const double deltaT = timeStepWidth;
     const double deltaTInt = timeStepWidth;
-
-    // Initialize first component of Taylor series
-    for (unsigned int i = 0; i < nodal::tensor::nodes2D::Shape[0]; ++i) {
-      prevCoefficients[i] = rotatedFaceDisplacement(i, 0);
-      // This is clearly a zeroth order approximation of the integral!
-      integratedDisplacementNodal(i) = deltaTInt * rotatedFaceDisplacement(i, 0); // 1 FLOP
-    }
-
-    // Coefficients for Taylor series
-    double factorEvaluated = 1;
-    double factorInt = deltaTInt;
-
-    auto* derivativesOffsets = timeKernel.getDerivativesOffsets();
-    projectKernel.INodal = dofsFaceNodal.data();
-    for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::dQ>(); ++i) {
-      projectKernel.dQ(i) = derivatives + derivativesOffsets[i];
-    }
-
 #ifdef USE_ELASTIC
-    const double rho = materialData.local.rho;
     const double g = getGravitationalAcceleration(); // [m/s^2]
-    const double Z = std::sqrt(materialData.local.lambda * rho) ;
 #endif
 
-    // Note: Probably need to increase CONVERGENCE_ORDER by 1 here!
-    for (int order = 1; order < CONVERGENCE_ORDER+1; ++order) {
-      dofsVolumeInteriorModal.setZero();
-      dofsFaceNodal.setZero();
-
-      projectKernel.execute(order - 1, faceIdx);
+    for (unsigned first = 0; first < numberOfFaces; first += BatchSize) {
+      const unsigned batchSize = std::min(BatchSize, numberOfFaces - first);
+
+      for (unsigned b = 0; b < batchSize; ++b) {
+        const GravityFace& face = faces[first + b];
+        assert(face.TinvData != nullptr);
+        real* rotatedData = rotatedFaceDisplacementData + b * rotatedStride;
+
+        // Rotate face displacement to face-normal coordinate system in which the computation is
+        // more convenient.
+        rotateFaceDisplacementKrnl.faceDisplacement = displacements + (first + b) * tensor::faceDisplacement::size();
+        rotateFaceDisplacementKrnl.displacementRotationMatrix = face.rotateDisplacementToFaceNormal;
+        rotateFaceDisplacementKrnl.rotatedFaceDisplacement = rotatedData;
+        rotateFaceDisplacementKrnl.execute();
+
+        auto rotatedFaceDisplacement = init::faceDisplacement::view::create(rotatedData);
+        auto integratedDisplacementNodal = init::averageNormalDisplacement::view::create(
+            integratedDisplacements + (first + b) * tensor::averageNormalDisplacement::size());
+
+        // Initialize first component of Taylor series
+        for (unsigned int i = 0; i < numberOfNodes; ++i) {
+          prevCoefficients[b * coefficientStride + i] = rotatedFaceDisplacement(i, 0);
+          // This is clearly a zeroth order approximation of the integral!
+          integratedDisplacementNodal(i) = deltaTInt * rotatedFaceDisplacement(i, 0); // 1 FLOP
+        }
+      }
 
-      factorEvaluated *= deltaT / (1.0 * order);
-      factorInt *= deltaTInt / (order + 1.0);
+      // Coefficients for Taylor series
+      double factorEvaluated = 1;
+      double factorInt = deltaTInt;
+
+      // Note: Probably need to increase CONVERGENCE_ORDER by 1 here!
+      for (int order = 1; order < CONVERGENCE_ORDER+1; ++order) {
+        factorEvaluated *= deltaT / (1.0 * order);
+        factorInt *= deltaTInt / (order + 1.0);
+
+        // Project volume data to face and rotate it to face-nodal basis.
+        for (unsigned b = 0; b < batchSize; ++b) {
+          const GravityFace& face = faces[first + b];
+          auto dofsFaceNodal = init::INodal::view::create(dofsFaceNodalStorage + b * nodalStride);
+          dofsFaceNodal.setZero();
+
+          auto projectKernel = projectKernelPrototype;
+          projectKernel.Tinv = face.TinvData;
+          projectKernel.INodal = dofsFaceNodal.data();
+          for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::dQ>(); ++i) {
+            projectKernel.dQ(i) = face.derivatives + derivativesOffsets[i];
+          }
+          projectKernel.execute(order - 1, face.face);
+        }
+
+        for (unsigned b = 0; b < batchSize; ++b) {
+          auto dofsFaceNodal = init::INodal::view::create(dofsFaceNodalStorage + b * nodalStride);
+          auto rotatedFaceDisplacement = init::faceDisplacement::view::create(rotatedFaceDisplacementData + b * rotatedStride);
+          auto integratedDisplacementNodal = init::averageNormalDisplacement::view::create(
+              integratedDisplacements + (first + b) * tensor::averageNormalDisplacement::size());
+          real* coefficients = prevCoefficients + b * coefficientStride;
+#ifdef USE_ELASTIC
+          const double rho = faces[first + b].rho;
+          const double Z = faces[first + b].impedance;
+#endif
 
 #pragma omp simd
-      for (unsigned int i = 0; i < nodal::tensor::nodes2D::Shape[0]; ++i) {
-        // Derivatives of interior variables
-        constexpr int pIdx = 0;
-        constexpr int uIdx = 6;
+          for (unsigned int i = 0; i < numberOfNodes; ++i) {
+            // Derivatives of interior variables
+            constexpr int pIdx = 0;
+            constexpr int uIdx = 6;
 
-        const auto uInside = dofsFaceNodal(i, uIdx + 0);
-        const auto vInside = dofsFaceNodal(i, uIdx + 1);
-        const auto wInside = dofsFaceNodal(i, uIdx + 2);
-        const auto pressureInside = dofsFaceNodal(i, pIdx);
+            const auto uInside = dofsFaceNodal(i, uIdx + 0);
+            const auto vInside = dofsFaceNodal(i, uIdx + 1);
+            const auto wInside = dofsFaceNodal(i, uIdx + 2);
+            const auto pressureInside = dofsFaceNodal(i, pIdx);
 
 #ifdef USE_ELASTIC
-        const double curCoeff = uInside - (1.0/Z) * (rho * g * prevCoefficients[i] + pressureInside);
-        // Basically uInside - C_1 * (c_2 * prevCoeff[i] + pressureInside)
-        // 2 add, 2 mul = 4 flops
+            const double curCoeff = uInside - (1.0/Z) * (rho * g * coefficients[i] + pressureInside);
+            // Basically uInside - C_1 * (c_2 * prevCoeff[i] + pressureInside)
+            // 2 add, 2 mul = 4 flops
 #else
-        const double curCoeff = uInside;
+            const double curCoeff = uInside;
 #endif
-        prevCoefficients[i] = curCoeff;
+            coefficients[i] = curCoeff;
 
-        // 2 * 3 = 6 flops for updating displacement
-        rotatedFaceDisplacement(i, 0) += factorEvaluated * curCoeff;
-        rotatedFaceDisplacement(i, 1) += factorEvaluated * vInside;
-        rotatedFaceDisplacement(i, 2) += factorEvaluated * wInside;
+            // 2 * 3 = 6 flops for updating displacement
+            rotatedFaceDisplacement(i, 0) += factorEvaluated * curCoeff;
+            rotatedFaceDisplacement(i, 1) += factorEvaluated * vInside;
+            rotatedFaceDisplacement(i, 2) += factorEvaluated * wInside;
 
-        // 2 flops for updating integral of displacement
-        integratedDisplacementNodal(i) += factorInt * curCoeff;
+            // 2 flops for updating integral of displacement
+            integratedDisplacementNodal(i) += factorInt * curCoeff;
+          }
+        }
       }
-    }
 
-    // Rotate face displacement back to global coordinate system which we use as storage
-    // coordinate system
-    rotateFaceDisplacementKrnl.faceDisplacement = rotatedFaceDisplacementData;
-    rotateFaceDisplacementKrnl.displacementRotationMatrix = rotateDisplacementToGlobalData;
-    rotateFaceDisplacementKrnl.rotatedFaceDisplacement = displacementNodalData;
-    rotateFaceDisplacementKrnl.execute();
+      // Rotate face displacement back to global coordinate system which we use as storage
+      // coordinate system
+      for (unsigned b = 0; b < batchSize; ++b) {
+        rotateFaceDisplacementKrnl.faceDisplacement = rotatedFaceDisplacementData + b * rotatedStride;
+        rotateFaceDisplacementKrnl.displacementRotationMatrix = faces[first + b].rotateDisplacementToGlobal;
+        rotateFaceDisplacementKrnl.rotatedFaceDisplacement = displacements + (first + b) * tensor::faceDisplacement::size();
+        rotateFaceDisplacementKrnl.execute();
+      }
+    }
   }
 };
 
@@ -105,6 +105,57 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
                                               CellBoundaryMapping const (*cellBoundaryMapping)[4],
                                               double time,
                                               double timeStepWidth) {
+  computeIntegral(i_timeIntegratedDegreesOfFreedom, data, tmp);
+
+  for (unsigned face = 0; face < 4; ++face) {
+    // Include some boundary conditions here.
+    switch (data.cellInformation.faceTypes[face]) {
+    case FaceType::freeSurfaceGravity:
+      assert(cellBoundaryMapping != nullptr);
+      assert(materialData != nullptr);
+      computeFreeSurfaceGravityIntegral(i_timeIntegratedDegreesOfFreedom,
+                                        data,
+                                        face,
+                                        tmp.nodalAvgDisplacements[face].data(),
+                                        *materialData,
+                                        (*cellBoundaryMapping)[face]);
+      break;
+    case FaceType::dirichlet:
+      assert(cellBoundaryMapping != nullptr);
+      computeDirichletIntegral(i_timeIntegratedDegreesOfFreedom,
+                               data,
+                               face,
+                               (*cellBoundaryMapping)[face]);
+      break;
+    case FaceType::analytical:
+      {
+      assert(cellBoundaryMapping != nullptr);
+      assert(materialData != nullptr);
+      const real* nodes = (*cellBoundaryMapping)[face].nodes;
+      auto nodesVec = std::vector<std::array<double, 3>>(tensor::INodal::Shape[0]);
+      for (unsigned int i = 0; i < tensor::INodal::Shape[0]; ++i) {
+        nodesVec[i] = {nodes[3*i], nodes[3*i+1], nodes[3*i+2]};
+      }
+      computeAnalyticalIntegral(i_timeIntegratedDegreesOfFreedom,
+                                data,
+                                face,
+                                nodesVec,
+                                *materialData,
+                                (*cellBoundaryMapping)[face],
+                                time,
+                                timeStepWidth);
+      break;
+      }
+    default:
+      // No boundary condition.
+      break;
+    }
+  }
+}
+
+void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                              LocalData& data,
+                                              LocalTmp& tmp) {
   assert(reinterpret_cast<uintptr_t>(i_timeIntegratedDegreesOfFreedom) % ALIGNMENT == 0);
   assert(reinterpret_cast<uintptr_t>(data.dofs) % ALIGNMENT == 0);
 
@@ -132,117 +183,120 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
       lfKrnl.AplusT = data.localIntegration.nApNm1[face];
       lfKrnl.execute(face);
     }
+  }
+}
 
-    alignas(ALIGNMENT) real dofsFaceBoundaryNodal[tensor::INodal::size()];
-    auto nodalLfKrnl = m_nodalLfKrnlPrototype;
-    nodalLfKrnl.Q = data.dofs;
-    nodalLfKrnl.INodal = dofsFaceBoundaryNodal;
-    nodalLfKrnl._prefetch.I = i_timeIntegratedDegreesOfFreedom + tensor::I::size();
-    nodalLfKrnl._prefetch.Q = data.dofs + tensor::Q::size();
-    nodalLfKrnl.AminusT = data.neighboringIntegration.nAmNm1[face];
-
-    // Include some boundary conditions here.
-    switch (data.cellInformation.faceTypes[face]) {
-    case FaceType::freeSurfaceGravity:
-      {
-        assert(cellBoundaryMapping != nullptr);
-        assert(materialData != nullptr);
-        auto* displ = tmp.nodalAvgDisplacements[face].data();
-        auto displacement = init::averageNormalDisplacement::view::create(displ);
-        auto applyFreeSurfaceBc = [&displacement, &materialData](
-            const real*, // nodes are unused
-            init::INodal::view::type& boundaryDofs) {
-          for (unsigned int i = 0; i < nodal::tensor::nodes2D::Shape[0]; ++i) {
-            const double rho = materialData->local.rho;
-            const double g = getGravitationalAcceleration(); // [m/s^2]
-            const double pressureAtBnd = -1 * rho * g * displacement(i);
-
-            boundaryDofs(i,0) = 2 * pressureAtBnd - boundaryDofs(i,0);
-            boundaryDofs(i,1) = 2 * pressureAtBnd - boundaryDofs(i,1);
-            boundaryDofs(i,2) = 2 * pressureAtBnd - boundaryDofs(i,2);
-          }
-      };
-
-      dirichletBoundary.evaluate(i_timeIntegratedDegreesOfFreedom,
-                                 face,
-                                 (*cellBoundaryMapping)[face],
-                                 m_projectRotatedKrnlPrototype,
-                                 applyFreeSurfaceBc,
-                                 dofsFaceBoundaryNodal);
-
-      nodalLfKrnl.execute(face);
-      break;
-      }
-    case FaceType::dirichlet:
-      {
-      assert(cellBoundaryMapping != nullptr);
-      auto* easiBoundaryMap = (*cellBoundaryMapping)[face].easiBoundaryMap;
-      auto* easiBoundaryConstant = (*cellBoundaryMapping)[face].easiBoundaryConstant;
-      assert(easiBoundaryConstant != nullptr);
-      assert(easiBoundaryMap != nullptr);
-      auto applyEasiBoundary = [easiBoundaryMap, easiBoundaryConstant](
-          const real* nodes,
-          init::INodal::view::type& boundaryDofs) {
-        seissol::kernel::createEasiBoundaryGhostCells easiBoundaryKernel;
-        easiBoundaryKernel.easiBoundaryMap = easiBoundaryMap;
-        easiBoundaryKernel.easiBoundaryConstant = easiBoundaryConstant;
-        easiBoundaryKernel.easiIdentMap = init::easiIdentMap::Values;
-        easiBoundaryKernel.INodal = boundaryDofs.data();
-        easiBoundaryKernel.execute();
-      };
-
-      // Compute boundary in [n, t_1, t_2] basis
-      dirichletBoundary.evaluate(i_timeIntegratedDegreesOfFreedom,
-				 face,
-				 (*cellBoundaryMapping)[face],
-				 m_projectRotatedKrnlPrototype,
-				 applyEasiBoundary,
-				 dofsFaceBoundaryNodal);
-
-      // We do not need to rotate the boundary data back to the [x,y,z] basis
-      // as we set the Tinv matrix to the identity matrix in the flux solver
-      // See init. in CellLocalMatrices.initializeCellLocalMatrices!
-
-      nodalLfKrnl.execute(face);
-      break;
-      }
-      case FaceType::analytical:
-      {
-      assert(cellBoundaryMapping != nullptr);
-      auto applyAnalyticalSolution = [materialData, this](const real* nodes,
-                                                    double time,
-                                                    init::INodal::view::type& boundaryDofs) {
-          auto nodesVec = std::vector<std::array<double, 3>>{};
-          int offset = 0;
-          for (unsigned int i = 0; i < tensor::INodal::Shape[0]; ++i) {
-            auto curNode = std::array<double, 3>{};
-            curNode[0] = nodes[offset++];
-            curNode[1] = nodes[offset++];
-            curNode[2] = nodes[offset++];
-            nodesVec.push_back(curNode);
-          }
-          assert(initConds != nullptr);
-          // TODO(Lukas) Support multiple init. conds?
-          assert(initConds->size() == 1);
-          (*initConds)[0]->evaluate(time, nodesVec, *materialData, boundaryDofs);
-      };
-
-      dirichletBoundary.evaluateTimeDependent(i_timeIntegratedDegreesOfFreedom,
-                                              face,
-                                              (*cellBoundaryMapping)[face],
-                                              m_projectKrnlPrototype,
-                                              applyAnalyticalSolution,
-                                              dofsFaceBoundaryNodal,
-                                              time,
-                                              timeStepWidth);
-      nodalLfKrnl.execute(face);
-      break;
-      }
-    default:
-      // No boundary condition.
-      break;
+void seissol::kernels::Local::computeFreeSurfaceGravityIntegral(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                                                LocalData& data,
+                                                                unsigned face,
+                                                                real* nodalAvgDisplacement,
+                                                                const CellMaterialData& materialData,
+                                                                const CellBoundaryMapping& boundaryMapping) {
+  alignas(ALIGNMENT) real dofsFaceBoundaryNodal[tensor::INodal::size()];
+
+  auto displacement = init::averageNormalDisplacement::view::create(nodalAvgDisplacement);
+  auto applyFreeSurfaceBc = [&displacement, &materialData](
+      const real*, // nodes are unused
+      init::INodal::view::type& boundaryDofs) {
+    for (unsigned int i = 0; i < nodal::tensor::nodes2D::Shape[0]; ++i) {
+      const double rho = materialData.local.rho;
+      const double g = getGravitationalAcceleration(); // [m/s^2]
+      const double pressureAtBnd = -1 * rho * g * displacement(i);
+
+      boundaryDofs(i,0) = 2 * pressureAtBnd - boundaryDofs(i,0);
+      boundaryDofs(i,1) = 2 * pressureAtBnd - boundaryDofs(i,1);
+      boundaryDofs(i,2) = 2 * pressureAtBnd - boundaryDofs(i,2);
     }
-  }
+  };
+
+  dirichletBoundary.evaluate(i_timeIntegratedDegreesOfFreedom,
+                             face,
+                             boundaryMapping,
+                             m_projectRotatedKrnlPrototype,
+                             applyFreeSurfaceBc,
+                             dofsFaceBoundaryNodal);
+
+  executeNodalFlux(i_timeIntegratedDegreesOfFreedom, data, face, dofsFaceBoundaryNodal);
+}
+
+void seissol::kernels::Local::computeDirichletIntegral(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                                       LocalData& data,
+                                                       unsigned face,
+                                                       const CellBoundaryMapping& boundaryMapping) {
+  alignas(ALIGNMENT) real dofsFaceBoundaryNodal[tensor::INodal::size()];
+
+  auto* easiBoundaryMap = boundaryMapping.easiBoundaryMap;
+  auto* easiBoundaryConstant = boundaryMapping.easiBoundaryConstant;
+  assert(easiBoundaryConstant != nullptr);
+  assert(easiBoundaryMap != nullptr);
+  auto applyEasiBoundary = [easiBoundaryMap, easiBoundaryConstant](
+      const real* nodes,
+      init::INodal::view::type& boundaryDofs) {
+    seissol::kernel::createEasiBoundaryGhostCells easiBoundaryKernel;
+    easiBoundaryKernel.easiBoundaryMap = easiBoundaryMap;
+    easiBoundaryKernel.easiBoundaryConstant = easiBoundaryConstant;
+    easiBoundaryKernel.easiIdentMap = init::easiIdentMap::Values;
+    easiBoundaryKernel.INodal = boundaryDofs.data();
+    easiBoundaryKernel.execute();
+  };
+
+  // Compute boundary in [n, t_1, t_2] basis
+  dirichletBoundary.evaluate(i_timeIntegratedDegreesOfFreedom,
+                             face,
+                             boundaryMapping,
+                             m_projectRotatedKrnlPrototype,
+                             applyEasiBoundary,
+                             dofsFaceBoundaryNodal);
+
+  // We do not need to rotate the boundary data back to the [x,y,z] basis
+  // as we set the Tinv matrix to the identity matrix in the flux solver
+  // See init. in CellLocalMatrices.initializeCellLocalMatrices!
+
+  executeNodalFlux(i_timeIntegratedDegreesOfFreedom, data, face, dofsFaceBoundaryNodal);
+}
+
+void seissol::kernels::Local::computeAnalyticalIntegral(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                                        LocalData& data,
+                                                        unsigned face,
+                                                        const std::vector<std::array<double, 3>>& nodes,
+                                                        const CellMaterialData& materialData,
+                                                        const CellBoundaryMapping& boundaryMapping,
+                                                        double time,
+                                                        double timeStepWidth) {
+  alignas(ALIGNMENT) real dofsFaceBoundaryNodal[tensor::INodal::size()];
+
+  auto applyAnalyticalSolution = [&nodes, &materialData, this](const real*, // precomputed nodes are used instead
+                                                                double time,
+                                                                init::INodal::view::type& boundaryDofs) {
+      assert(initConds != nullptr);
+      // TODO(Lukas) Support multiple init. conds?
+      assert(initConds->size() == 1);
+      (*initConds)[0]->evaluate(time, nodes, materialData, boundaryDofs);
+  };
+
+  dirichletBoundary.evaluateTimeDependent(i_timeIntegratedDegreesOfFreedom,
+                                          face,
+                                          boundaryMapping,
+                                          m_projectKrnlPrototype,
+                                          applyAnalyticalSolution,
+                                          dofsFaceBoundaryNodal,
+                                          time,
+                                          timeStepWidth);
+
+  executeNodalFlux(i_timeIntegratedDegreesOfFreedom, data, face, dofsFaceBoundaryNodal);
+}
+
+void seissol::kernels::Local::executeNodalFlux(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                               LocalData& data,
+                                               unsigned face,
+                                               real dofsFaceBoundaryNodal[tensor::INodal::size()]) {
+  auto nodalLfKrnl = m_nodalLfKrnlPrototype;
+  nodalLfKrnl.Q = data.dofs;
+  nodalLfKrnl.INodal = dofsFaceBoundaryNodal;
+  nodalLfKrnl._prefetch.I = i_timeIntegratedDegreesOfFreedom + tensor::I::size();
+  nodalLfKrnl._prefetch.Q = data.dofs + tensor::Q::size();
+  nodalLfKrnl.AminusT = data.neighboringIntegration.nAmNm1[face];
+  nodalLfKrnl.execute(face);
 }
 
 void seissol::kernels::Local::computeBatchedIntegral(ConditionalBatchTableT &table, LocalTmp& tmp) {
@@ -250,6 +250,20 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
 #endif //USE_STP
 }
 
+void seissol::kernels::Time::computeFreeSurfaceGravityDisplacements(double i_timeStepWidth,
+                                                                    const GravityFace* faces,
+                                                                    unsigned numberOfFaces,
+                                                                    real* displacements,
+                                                                    real* integratedDisplacements) {
+  GravitationalFreeSurfaceBc::evaluateBatch(projectDerivativeToNodalBoundaryRotated,
+                                            *this,
+                                            faces,
+                                            numberOfFaces,
+                                            displacements,
+                                            integratedDisplacements,
+                                            i_timeStepWidth);
+}
+
 void seissol::kernels::Time::computeBatchedAder(double i_timeStepWidth,
                                                 LocalTmp& tmp,
                                                 ConditionalBatchTableT &table) {
@@ -8,6 +8,7 @@ extern long long libxsmm_num_total_flops;
 #include <Kernels/common.hpp>
 #include <Kernels/denseMatrixOps.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <cassert>
 #include <stdint.h>
@@ -129,6 +130,15 @@ void seissol::kernels::Time::computeAder( double i_timeStepWidth,
   executeSTP( i_timeStepWidth, data, o_timeIntegrated, stpBuffer );
 }
 
+void seissol::kernels::Time::computeFreeSurfaceGravityDisplacements(double i_timeStepWidth,
+                                                                    const GravityFace* faces,
+                                                                    unsigned numberOfFaces,
+                                                                    real* displacements,
+                                                                    real* integratedDisplacements) {
+  // the gravitational free surface is not implemented for this equation
+  std::fill_n(integratedDisplacements, numberOfFaces * tensor::averageNormalDisplacement::size(), static_cast<real>(0.0));
+}
+
 void seissol::kernels::Time::flopsAder( unsigned int        &o_nonZeroFlops,
                                         unsigned int        &o_hardwareFlops ) {
   // reset flops
@@ -77,6 +77,37 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
                                               CellBoundaryMapping const (*cellBoundaryMapping)[4],
                                               double time,
                                               double timeStepWidth) {
+  // nodal boundary conditions are not implemented for this equation
+  computeIntegral(i_timeIntegratedDegreesOfFreedom, data, tmp);
+}
+
+void seissol::kernels::Local::computeFreeSurfaceGravityIntegral(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                                                LocalData& data,
+                                                                unsigned face,
+                                                                real* nodalAvgDisplacement,
+                                                                const CellMaterialData& materialData,
+                                                                const CellBoundaryMapping& boundaryMapping) {
+}
+
+void seissol::kernels::Local::computeDirichletIntegral(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                                       LocalData& data,
+                                                       unsigned face,
+                                                       const CellBoundaryMapping& boundaryMapping) {
+}
+
+void seissol::kernels::Local::computeAnalyticalIntegral(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                                        LocalData& data,
+                                                        unsigned face,
+                                                        const std::vector<std::array<double, 3>>& nodes,
+                                                        const CellMaterialData& materialData,
+                                                        const CellBoundaryMapping& boundaryMapping,
+                                                        double time,
+                                                        double timeStepWidth) {
+}
+
+void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                              LocalData& data,
+                                              LocalTmp& tmp) {
   // assert alignments
 #ifndef NDEBUG
   assert( ((uintptr_t)i_timeIntegratedDegreesOfFreedom) % ALIGNMENT == 0 );
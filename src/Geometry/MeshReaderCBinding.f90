@@ -404,6 +404,7 @@ contains
         allocate(m_mesh%Fault%geoNormals(3, n))
         allocate(m_mesh%Fault%geoTangent1(3, n))
         allocate(m_mesh%Fault%geoTangent2(3, n))
+        allocate(m_mesh%Fault%geoSurfaces(n))
     end subroutine allocFault
 
     subroutine hasPlusFault() bind(C)
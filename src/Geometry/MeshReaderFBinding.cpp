@@ -55,6 +55,7 @@
 #include "Monitoring/instrumentation.fpp"
 #include "Monitoring/Stopwatch.h"
 #include "Numerical_aux/Statistics.h"
+#include "Initializer/MemoryAllocator.h"
 #include "Initializer/time_stepping/LtsWeights/WeightsFactory.h"
 #include "Solver/time_stepping/MiniSeisSol.h"
 
@@ -69,6 +70,28 @@ void read_mesh(int rank, MeshReader &meshReader, bool hasFault, double const dis
 	const std::vector<Vertex>& vertices = meshReader.getVertices();
 	const std::map<int, MPINeighbor>& mpiNeighbors = meshReader.getMPINeighbors();
 
+	// The local part of the mesh identifies the partition in the setup cache key
+	seissol::initializers::SetupCache& setupCache = seissol::SeisSol::main.setupCache();
+	if (setupCache.enabled()) {
+		for (const Element& element : elements) {
+			setupCache.addData(element.vertices, sizeof(element.vertices));
+			setupCache.addData(element.neighbors, sizeof(element.neighbors));
+			setupCache.addData(element.boundaries, sizeof(element.boundaries));
+			setupCache.addData(element.neighborRanks, sizeof(element.neighborRanks));
+			setupCache.addData(&element.material, sizeof(element.material));
+		}
+		for (const Vertex& vertex : vertices) {
+			setupCache.addData(vertex.coords, sizeof(vertex.coords));
+		}
+	}
+
+	size_t vertexBytes = vertices.capacity() * sizeof(Vertex);
+	for (const Vertex& vertex : vertices) {
+		vertexBytes += vertex.elements.capacity() * sizeof(int);
+	}
+	seissol::memory::accountMemory("Mesh/elements", elements.capacity() * sizeof(Element));
+	seissol::memory::accountMemory("Mesh/vertices", vertexBytes);
+
 	// Compute maximum element for one vertex
 	size_t maxElements = 0;
 	for (std::vector<Vertex>::const_iterator i = vertices.begin();
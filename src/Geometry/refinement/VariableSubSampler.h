@@ -42,6 +42,8 @@
 
 #include <cassert>
 #include <algorithm>
+#include <cmath>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -68,12 +70,19 @@ private:
     const unsigned int kSubCellsPerCell;
     const unsigned int kNumVariables;
     const unsigned int kNumAlignedDOF;
+    /** Number of fused simulations, their DOFs are interleaved */
+    const unsigned int kNumSimulations;
 
 
+    /**
+     * Variables are numbered simulation by simulation,
+     * i.e. variable + numVariables * simulation
+     */
     std::size_t getInVarOffset(unsigned int cell, unsigned int variable,
     		const unsigned int* cellMap) const
     {
-        return (cellMap[cell]*kNumVariables + variable) * kNumAlignedDOF;
+        const unsigned int simulation = variable / kNumVariables;
+        return (cellMap[cell]*kNumVariables + variable % kNumVariables) * kNumAlignedDOF + simulation;
     }
 
     std::size_t getOutVarOffset(unsigned cell, unsigned int subcell) const
@@ -87,11 +96,21 @@ public:
             const TetrahedronRefiner<T>& tetRefiner,
             unsigned int order,
             unsigned int numVariables,
-            unsigned int numAlignedDOF
+            unsigned int numAlignedDOF,
+            unsigned int numSimulations = 1
             );
 
     void get(const real* inData, const unsigned int* cellMap,
             int variable, real* outData) const;
+
+    /**
+     * Subsamples several variables in a single pass over the cells
+     *
+     * @param outData One output buffer per variable
+     * @return False if any subsampled value is not finite
+     */
+    bool get(const real* inData, const unsigned int* cellMap,
+            const std::vector<int>& variables, real* const* outData) const;
 };
 
 //------------------------------------------------------------------------------
@@ -102,10 +121,12 @@ VariableSubsampler<T>::VariableSubsampler(
         const TetrahedronRefiner<T>& tetRefiner,
         unsigned int order,
         unsigned int numVariables,
-        unsigned int numAlignedDOF)
+        unsigned int numAlignedDOF,
+        unsigned int numSimulations)
 		: m_numCells(numCells),
 		  kSubCellsPerCell(tetRefiner.getDivisionCount()),
-    kNumVariables(numVariables), kNumAlignedDOF(numAlignedDOF)
+    kNumVariables(numVariables), kNumAlignedDOF(numAlignedDOF),
+    kNumSimulations(numSimulations)
 {
     // Generate cell centerpoints in the reference or unit tetrahedron.
 	Tetrahedron<T>* subCells = new Tetrahedron<T>[kSubCellsPerCell];
@@ -139,9 +160,35 @@ void VariableSubsampler<T>::get(const real* inData,  const unsigned int* cellMap
     for (unsigned int c = 0; c < m_numCells; ++c) {
         for (unsigned int sc = 0; sc < kSubCellsPerCell; ++sc) {
             outData[getOutVarOffset(c, sc)] =
-            		m_BasisFunctions[sc].evalWithCoeffs(&inData[getInVarOffset(c, variable, cellMap)]);
+            		m_BasisFunctions[sc].evalWithCoeffs(&inData[getInVarOffset(c, variable, cellMap)], kNumSimulations);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+bool VariableSubsampler<T>::get(const real* inData,  const unsigned int* cellMap,
+        const std::vector<int>& variables, real* const* outData) const
+{
+    bool finite = true;
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static) reduction(&&:finite)
+#endif
+    // Iterate over original Cells, the DOFs of all variables of a cell are contiguous
+    for (unsigned int c = 0; c < m_numCells; ++c) {
+        for (std::size_t v = 0; v < variables.size(); ++v) {
+            const real* cellData = &inData[getInVarOffset(c, variables[v], cellMap)];
+            for (unsigned int sc = 0; sc < kSubCellsPerCell; ++sc) {
+                const real value = m_BasisFunctions[sc].evalWithCoeffs(cellData, kNumSimulations);
+                outData[v][getOutVarOffset(c, sc)] = value;
+                finite = finite && std::isfinite(value);
+            }
         }
     }
+
+    return finite;
 }
 
 //------------------------------------------------------------------------------
@@ -5,6 +5,7 @@
 
 #include "Condition.hpp"
 #include "EncodedConstants.hpp"
+#include "Initializer/MemoryAllocator.h"
 #include <device.h>
 #include <string>
 #include <unordered_map>
@@ -19,6 +20,7 @@ public:
       : pointers(std::move(collectedPointers)), devicePtrs(nullptr) {
     if (!pointers.empty()) {
       devicePtrs = (real **)device.api->allocGlobMem(pointers.size() * sizeof(real *));
+      seissol::memory::accountMemory("Device/batch pointers", pointers.size() * sizeof(real *));
       device.api->copyTo(devicePtrs, pointers.data(), pointers.size() * sizeof(real *));
     }
   }
@@ -27,6 +29,7 @@ public:
     if (!pointers.empty()) {
       if (other.devicePtrs != nullptr) {
         devicePtrs = (real **)device.api->allocGlobMem(other.pointers.size() * sizeof(real *));
+        seissol::memory::accountMemory("Device/batch pointers", other.pointers.size() * sizeof(real *));
         device.api->copyBetween(devicePtrs, other.devicePtrs, other.pointers.size() * sizeof(real *));
       }
     }
@@ -40,6 +40,7 @@
  **/
 
 #include "CellLocalMatrices.h"
+#include "GodunovStateCache.h"
 
 #include <cassert>
 
@@ -56,6 +57,17 @@
 #include <device.h>
 #endif
 
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+
 void setStarMatrix( real* i_AT,
                     real* i_BT,
                     real* i_CT,
@@ -96,6 +108,17 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
   assert(ltsToMesh      == i_ltsLut->getLtsToMeshLut(i_lts->localIntegration.mask));
   assert(ltsToMesh      == i_ltsLut->getLtsToMeshLut(i_lts->neighboringIntegration.mask));
 
+  // one cache per thread, shared by all layers
+  using MaterialT = decltype(CellMaterialData::local);
+  using AnisotropicMaterialT = seissol::model::AnisotropicMaterial;
+#ifdef _OPENMP
+  const unsigned numberOfThreads = omp_get_max_threads();
+#else
+  const unsigned numberOfThreads = 1;
+#endif
+  std::vector<GodunovStateCache<MaterialT>> godunovStateCaches(numberOfThreads);
+  std::vector<GodunovStateCache<AnisotropicMaterialT>> rotatedGodunovStateCaches(numberOfThreads);
+
   for (LTSTree::leaf_iterator it = io_ltsTree->beginLeaf(LayerMask(Ghost)); it != io_ltsTree->endLeaf(); ++it) {
     CellMaterialData*           material                = it->var(i_lts->material);
     LocalIntegrationData*       localIntegration        = it->var(i_lts->localIntegration);
@@ -123,8 +146,13 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
 
     real QgodLocalData[tensor::QgodLocal::size()];
     real QgodNeighborData[tensor::QgodNeighbor::size()];
-    auto QgodLocal = init::QgodLocal::view::create(QgodLocalData);
-    auto QgodNeighbor = init::QgodNeighbor::view::create(QgodNeighborData);
+#ifdef _OPENMP
+    const unsigned thread = omp_get_thread_num();
+#else
+    const unsigned thread = 0;
+#endif
+    GodunovStateCache<MaterialT>& godunovStates = godunovStateCaches[thread];
+    GodunovStateCache<AnisotropicMaterialT>& rotatedGodunovStates = rotatedGodunovStateCaches[thread];
     
 #ifdef _OPENMP
     #pragma omp for schedule(static)
@@ -161,12 +189,6 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
       double volume = MeshTools::volume(elements[meshId], vertices);
 
       for (unsigned side = 0; side < 4; ++side) {
-        seissol::model::getTransposedGodunovState(  material[cell].local,
-                                                    material[cell].neighbor[side],
-                                                    cellInformation[cell].faceTypes[side],
-                                                    QgodLocal,
-                                                    QgodNeighbor );
-
         VrtxCoords normal;
         VrtxCoords tangent1;
         VrtxCoords tangent2;
@@ -176,22 +198,26 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
         MeshTools::normalize(tangent1, tangent1);
         MeshTools::normalize(tangent2, tangent2);
 
-        real NLocalData[6*6];
-        seissol::model::getBondMatrix(normal, tangent1, tangent2, NLocalData);
+        // Isotropic materials are invariant under the face rotation, i.e. ATtilde equals AT
+        real* ATtildeOrATData = ATData;
         if (material[cell].local.getMaterialType() == seissol::model::MaterialType::anisotropic) {
-          seissol::model::getTransposedGodunovState(  seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)),
-                                                      seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].neighbor[side])),
-                                                      cellInformation[cell].faceTypes[side],
-                                                      QgodLocal,
-                                                      QgodNeighbor );
-          seissol::model::getTransposedCoefficientMatrix( seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)), 0, ATtilde );
+          real NLocalData[6*6];
+          seissol::model::getBondMatrix(normal, tangent1, tangent2, NLocalData);
+          auto const rotatedLocal = seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<AnisotropicMaterialT*>(&material[cell].local));
+          auto const rotatedNeighbor = seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<AnisotropicMaterialT*>(&material[cell].neighbor[side]));
+          rotatedGodunovStates.getTransposedGodunovState( rotatedLocal,
+                                                          rotatedNeighbor,
+                                                          cellInformation[cell].faceTypes[side],
+                                                          QgodLocalData,
+                                                          QgodNeighborData );
+          seissol::model::getTransposedCoefficientMatrix( rotatedLocal, 0, ATtilde );
+          ATtildeOrATData = ATtildeData;
         } else {
-          seissol::model::getTransposedGodunovState(  material[cell].local,
-                                                      material[cell].neighbor[side],     
-                                                      cellInformation[cell].faceTypes[side],
-                                                      QgodLocal,
-                                                      QgodNeighbor );
-          seissol::model::getTransposedCoefficientMatrix( material[cell].local, 0, ATtilde );
+          godunovStates.getTransposedGodunovState( material[cell].local,
+                                                   material[cell].neighbor[side],
+                                                   cellInformation[cell].faceTypes[side],
+                                                   QgodLocalData,
+                                                   QgodNeighborData );
         }
 
         // Calculate transposed T instead
@@ -207,7 +233,7 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
         localKrnl.QgodLocal = QgodLocalData;
         localKrnl.T = TData;
         localKrnl.Tinv = TinvData;
-        localKrnl.star(0) = ATtildeData;
+        localKrnl.star(0) = ATtildeOrATData;
         localKrnl.execute();
         
         kernel::computeFluxSolverNeighbor neighKrnl;
@@ -216,7 +242,7 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
         neighKrnl.QgodNeighbor = QgodNeighborData;
         neighKrnl.T = TData;
         neighKrnl.Tinv = TinvData;
-        neighKrnl.star(0) = ATtildeData;
+        neighKrnl.star(0) = ATtildeOrATData;
         if (cellInformation[cell].faceTypes[side] == FaceType::dirichlet ||
             cellInformation[cell].faceTypes[side] == FaceType::freeSurfaceGravity) {
           // Already rotated!
@@ -411,6 +437,16 @@ void seissol::initializers::initializeDynamicRuptureMatrices( MeshReader const&
         faceInformation[ltsFace].faceRelation = elements[ fault[meshFace].neighborElement ].sideOrientations[ fault[meshFace].neighborSide ] + 1;
       }
 
+      /// With local time stepping across the fault, one side may belong to the next slower cluster
+      faceInformation[ltsFace].plusSideSlower = false;
+      faceInformation[ltsFace].minusSideSlower = false;
+      if (fault[meshFace].element >= 0 && fault[meshFace].neighborElement >= 0) {
+        unsigned plusCluster = cellInformation[ i_ltsLut->ltsId(i_lts->cellInformation.mask, fault[meshFace].element) ].clusterId;
+        unsigned minusCluster = cellInformation[ i_ltsLut->ltsId(i_lts->cellInformation.mask, fault[meshFace].neighborElement) ].clusterId;
+        faceInformation[ltsFace].plusSideSlower = plusCluster > minusCluster;
+        faceInformation[ltsFace].minusSideSlower = minusCluster > plusCluster;
+      }
+
       /// Look for time derivative mapping in all duplicates
       int derivativesMeshId;
       int derivativesSide;
@@ -452,29 +488,20 @@ void seissol::initializers::initializeDynamicRuptureMatrices( MeshReader const&
 
         assert(duplicate != 0 || plusLtsId != std::numeric_limits<unsigned>::max() || minusLtsId != std::numeric_limits<unsigned>::max());
 
+        // Every cell side belongs to at most one fault face, hence no two faces write the same mapping
         if (plusLtsId != std::numeric_limits<unsigned>::max()) {
-#ifdef _OPENMP
-#pragma omp critical
-#endif // _OPENMP
-{
           CellDRMapping& mapping = drMapping[plusLtsId][ faceInformation[ltsFace].plusSide ];
           mapping.side = faceInformation[ltsFace].plusSide;
           mapping.faceRelation = 0;
           mapping.godunov = &imposedStatePlus[ltsFace][0];
           mapping.fluxSolver = &fluxSolverPlus[ltsFace][0];
-}
         }
         if (minusLtsId != std::numeric_limits<unsigned>::max()) {
-#ifdef _OPENMP
-#pragma omp critical
-#endif // _OPENMP
-{
           CellDRMapping& mapping = drMapping[minusLtsId][ faceInformation[ltsFace].minusSide ];
           mapping.side = faceInformation[ltsFace].minusSide;
           mapping.faceRelation = faceInformation[ltsFace].faceRelation;
           mapping.godunov = &imposedStateMinus[ltsFace][0];
           mapping.fluxSolver = &fluxSolverMinus[ltsFace][0];
-}
         }
       }
 
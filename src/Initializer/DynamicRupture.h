@@ -50,7 +50,11 @@ namespace seissol {
   }
 }
 
-#ifndef ACL_DEVICE
+#if !defined(ACL_DEVICE) && defined(USE_NUMA_LOCAL_MEMORY)
+#	define MEMKIND_NEIGHBOUR_INTEGRATION seissol::memory::NumaLocal
+#	define MEMKIND_Q_INTERPOLATED seissol::memory::Standard
+#	define MEMKIND_IMPOSED_STATE seissol::memory::NumaLocal
+#elif !defined(ACL_DEVICE)
 #	define MEMKIND_NEIGHBOUR_INTEGRATION seissol::memory::Standard
 #	define MEMKIND_Q_INTERPOLATED seissol::memory::Standard
 #	define MEMKIND_IMPOSED_STATE seissol::memory::Standard
@@ -0,0 +1,114 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Per-member inputs of fused simulations (MULTIPLE_SIMULATIONS).
+ **/
+
+#include "Ensemble.h"
+
+#include <Parallel/MPI.h>
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <string>
+
+void seissol::initializers::Ensemble::init() {
+  const std::string fileName = utils::Env::get<const char*>("SEISSOL_ENSEMBLE_FILE", "");
+  if (fileName.empty()) {
+    return;
+  }
+
+#ifndef MULTIPLE_SIMULATIONS
+  logError() << "SEISSOL_ENSEMBLE_FILE requires a build with more than one fused simulation.";
+#endif
+
+  const int rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Reading the ensemble description" << fileName;
+
+  YAML::Node root;
+  try {
+    root = YAML::LoadFile(fileName);
+  } catch (YAML::Exception const& exception) {
+    logError() << "Could not read" << fileName << ":" << exception.what();
+  }
+
+  // members share the mesh, the material and the fault, in particular the friction state
+  for (auto const& entry : root) {
+    const auto key = entry.first.as<std::string>();
+    if (key != "members") {
+      logError() << "Unknown key" << key << "in the ensemble description. All members share the material and the dynamic rupture setup.";
+    }
+  }
+
+  auto const members = root["members"];
+  if (!members || !members.IsSequence() || members.size() != NumberOfMembers) {
+    logError() << "The ensemble description must contain" << NumberOfMembers << "members.";
+  }
+
+  for (unsigned m = 0; m < NumberOfMembers; ++m) {
+    auto const node = members[m];
+    auto& member = m_members[m];
+    if (!node.IsMap()) {
+      logError() << "Member" << m << "of the ensemble description is not a map.";
+    }
+    for (auto const& entry : node) {
+      const auto key = entry.first.as<std::string>();
+      if (key != "sources" && key != "sourceScale" && key != "initialFieldScale") {
+        logError() << "Member" << m << "of the ensemble description sets" << key
+                   << ", but members may only differ in their sources and initial fields. Per-member materials and dynamic rupture setups are not supported.";
+      }
+    }
+    // an empty list selects no source at all
+    if (node["sources"]) {
+      member.allSources = false;
+      member.sources = node["sources"].as<std::vector<unsigned>>();
+      std::sort(member.sources.begin(), member.sources.end());
+    }
+    member.sourceScale = node["sourceScale"].as<double>(1.0);
+    member.initialFieldScale = node["initialFieldScale"].as<double>(1.0);
+  }
+
+  m_configured = true;
+}
+
+void seissol::initializers::Ensemble::sourceWeights(unsigned source, real weights[NumberOfMembers]) const {
+  for (unsigned m = 0; m < NumberOfMembers; ++m) {
+    auto const& sources = m_members[m].sources;
+    const bool acts = m_members[m].allSources || std::binary_search(sources.begin(), sources.end(), source);
+    weights[m] = acts ? m_members[m].sourceScale : 0.0;
+  }
+}
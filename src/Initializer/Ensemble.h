@@ -0,0 +1,102 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Per-member inputs of fused simulations (MULTIPLE_SIMULATIONS).
+ **/
+
+#ifndef INITIALIZER_ENSEMBLE_H_
+#define INITIALIZER_ENSEMBLE_H_
+
+#include <Kernels/precision.hpp>
+
+#include <string>
+#include <vector>
+
+namespace seissol::initializers {
+/**
+ * Describes how the members of fused simulations differ. All members share the mesh and
+ * the material; they may differ in the point sources which act on them, the amplitude of
+ * the sources and of the initial field. The description is read from a YAML file:
+ *
+ *   members:
+ *     - sources: [0, 2]        # indices in the source file, all sources if omitted
+ *       sourceScale: 1.0
+ *       initialFieldScale: 1.0
+ *     - ...
+ *
+ * Receivers, wave field, free surface and checkpoint output contain every member.
+ **/
+class Ensemble {
+public:
+#ifdef MULTIPLE_SIMULATIONS
+  static constexpr unsigned NumberOfMembers = MULTIPLE_SIMULATIONS;
+#else
+  static constexpr unsigned NumberOfMembers = 1;
+#endif
+
+  struct Member {
+    //! all point sources act on this member if true, otherwise only those in sources
+    bool allSources = true;
+    //! indices of the point sources acting on this member
+    std::vector<unsigned> sources;
+    double sourceScale = 1.0;
+    double initialFieldScale = 1.0;
+  };
+
+  Ensemble() : m_members(NumberOfMembers) {}
+
+  //! Reads the description given by SEISSOL_ENSEMBLE_FILE, if any
+  void init();
+
+  //! True if the members differ
+  bool isConfigured() const {
+    return m_configured;
+  }
+
+  Member const& member(unsigned member) const {
+    return m_members[member];
+  }
+
+  /**
+   * Weights of the point source with the given index in the source file for every member.
+   **/
+  void sourceWeights(unsigned source, real weights[NumberOfMembers]) const;
+
+private:
+  bool m_configured = false;
+  std::vector<Member> m_members;
+};
+} // namespace seissol::initializers
+
+#endif
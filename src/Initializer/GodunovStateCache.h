@@ -0,0 +1,207 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2026, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Cache of the Godunov states of the faces during the setup.
+ **/
+
+
+#ifndef INITIALIZER_GODUNOVSTATECACHE_H_
+#define INITIALIZER_GODUNOVSTATECACHE_H_
+
+#include <Equations/datastructures.hpp>
+#include <Equations/Setup.h>
+#include <Initializer/typedefs.hpp>
+#include <Model/common.hpp>
+#include <generated_code/init.h>
+#include <generated_code/tensor.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+
+namespace seissol::initializers {
+/**
+ * Parameters which determine the Godunov state of a material, Count is zero if the states
+ * of the material are not cached.
+ **/
+template<typename MaterialT, typename Enable = void>
+struct GodunovStateParameters {
+  static constexpr unsigned Count = 0;
+  static void get(MaterialT const&, double*) {}
+};
+
+//! Isotropic materials only enter the Godunov state with their elastic parameters
+template<typename MaterialT>
+struct GodunovStateParameters<MaterialT, std::enable_if_t<std::is_base_of_v<seissol::model::ElasticMaterial, MaterialT>>> {
+  static constexpr unsigned Count = 3;
+  static void get(MaterialT const& material, double* parameters) {
+    parameters[0] = material.rho;
+    parameters[1] = material.lambda;
+    parameters[2] = material.mu;
+  }
+};
+
+//! Anisotropic materials have to be rotated into the face-aligned coordinate system first
+template<>
+struct GodunovStateParameters<seissol::model::AnisotropicMaterial> {
+  static constexpr unsigned Count = 22;
+  static void get(seissol::model::AnisotropicMaterial const& material, double* parameters) {
+    const double values[Count] = {material.rho,
+                                  material.c11, material.c12, material.c13, material.c14, material.c15, material.c16,
+                                  material.c22, material.c23, material.c24, material.c25, material.c26,
+                                  material.c33, material.c34, material.c35, material.c36,
+                                  material.c44, material.c45, material.c46,
+                                  material.c55, material.c56,
+                                  material.c66};
+    std::copy_n(values, Count, parameters);
+  }
+};
+
+/**
+ * Caches the transposed Godunov states by the materials on both sides of a face and by whether
+ * the face is a free surface. Meshes usually consist of few distinct material pairs, hence most
+ * faces reuse a state instead of computing the eigendecomposition again. Anisotropic materials
+ * are cached by their rotated coefficients, i.e. only faces with the same orientation share a state.
+ *
+ * The cache is not thread-safe, use one per thread. It holds at most MaxStates states. If most of
+ * the first ProbeFaces faces needed a new state (e.g. for smoothly varying materials), the cache
+ * is cleared and all further states are computed directly.
+ **/
+template<typename MaterialT>
+class GodunovStateCache {
+public:
+  static constexpr bool Enabled = GodunovStateParameters<MaterialT>::Count > 0;
+  static constexpr std::size_t MaxStates = 4096;
+  static constexpr std::size_t ProbeFaces = 4096;
+
+  /**
+   * Computes the transposed Godunov state as model::getTransposedGodunovState or restores it.
+   **/
+  void getTransposedGodunovState(MaterialT const& local,
+                                 MaterialT const& neighbor,
+                                 FaceType faceType,
+                                 real* QgodLocalData,
+                                 real* QgodNeighborData) {
+    if constexpr (Enabled) {
+      if (m_active) {
+        ++m_faces;
+        Key const stateKey = key(local, neighbor, faceType);
+        // materials with NaN parameters never match, compute them directly
+        if (std::none_of(stateKey.begin(), stateKey.end(), [](double value) { return std::isnan(value); })) {
+          auto const state = m_states.find(stateKey);
+          if (state != m_states.end()) {
+            std::copy_n(state->second.QgodLocal, tensor::QgodLocal::size(), QgodLocalData);
+            std::copy_n(state->second.QgodNeighbor, tensor::QgodNeighbor::size(), QgodNeighborData);
+            return;
+          }
+
+          compute(local, neighbor, faceType, QgodLocalData, QgodNeighborData);
+          ++m_misses;
+          if (m_faces >= ProbeFaces && 2 * m_misses > m_faces) {
+            // almost every face has its own material pair, the cache does not pay off
+            m_active = false;
+            m_states.clear();
+          } else if (m_states.size() < MaxStates) {
+            State& state = m_states[stateKey];
+            std::copy_n(QgodLocalData, tensor::QgodLocal::size(), state.QgodLocal);
+            std::copy_n(QgodNeighborData, tensor::QgodNeighbor::size(), state.QgodNeighbor);
+          }
+          return;
+        }
+      }
+    }
+    compute(local, neighbor, faceType, QgodLocalData, QgodNeighborData);
+  }
+
+  //! @return The number of cached states
+  std::size_t size() const {
+    return m_states.size();
+  }
+
+  //! @return false if the cache was given up and all states are computed directly
+  bool isActive() const {
+    return m_active;
+  }
+
+private:
+  static constexpr unsigned ParameterCount = GodunovStateParameters<MaterialT>::Count;
+
+  //! Parameters of the local and the neighboring material, and 1 for free surfaces
+  using Key = std::array<double, 2 * ParameterCount + 1>;
+
+  struct KeyHash {
+    std::size_t operator()(Key const& key) const {
+      std::size_t hash = 0;
+      for (double value : key) {
+        hash = hash * 31 + std::hash<double>()(value);
+      }
+      return hash;
+    }
+  };
+
+  struct State {
+    real QgodLocal[tensor::QgodLocal::size()];
+    real QgodNeighbor[tensor::QgodNeighbor::size()];
+  };
+
+  static Key key(MaterialT const& local, MaterialT const& neighbor, FaceType faceType) {
+    Key key{};
+    GodunovStateParameters<MaterialT>::get(local, key.data());
+    GodunovStateParameters<MaterialT>::get(neighbor, key.data() + ParameterCount);
+    key[2 * ParameterCount] = (faceType == FaceType::freeSurface) ? 1.0 : 0.0;
+    return key;
+  }
+
+  static void compute(MaterialT const& local,
+                      MaterialT const& neighbor,
+                      FaceType faceType,
+                      real* QgodLocalData,
+                      real* QgodNeighborData) {
+    auto QgodLocal = init::QgodLocal::view::create(QgodLocalData);
+    auto QgodNeighbor = init::QgodNeighbor::view::create(QgodNeighborData);
+    seissol::model::getTransposedGodunovState(local, neighbor, faceType, QgodLocal, QgodNeighbor);
+  }
+
+  std::unordered_map<Key, State, KeyHash> m_states;
+  std::size_t m_faces = 0;
+  std::size_t m_misses = 0;
+  bool m_active = Enabled;
+};
+} // namespace seissol::initializers
+
+#endif
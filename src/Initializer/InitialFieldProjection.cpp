@@ -40,6 +40,9 @@
 
 #include "InitialFieldProjection.h"
 
+#include <algorithm>
+#include <vector>
+
 #include <Numerical_aux/Quadrature.h>
 #include <Numerical_aux/BasisFunction.h>
 #include <Numerical_aux/Transformation.h>
@@ -73,6 +76,17 @@ void seissol::initializers::projectInitialField(std::vector<std::unique_ptr<phys
   double quadratureWeights[numQuadPoints];
   seissol::quadrature::TetrahedronQuadrature(quadraturePoints, quadratureWeights, quadPolyDegree);
 
+#ifdef MULTIPLE_SIMULATIONS
+  constexpr unsigned multipleSimulations = MULTIPLE_SIMULATIONS;
+#else
+  constexpr unsigned multipleSimulations = 1;
+#endif
+  constexpr unsigned numberOfQuantities = tensor::iniCond::Shape[ sizeof(tensor::iniCond::Shape) / sizeof(tensor::iniCond::Shape[0]) - 1];
+
+  // The initial field is evaluated for blocks of elements at once
+  constexpr unsigned blockSize = 32;
+  const unsigned numberOfBlocks = (elements.size() + blockSize - 1) / blockSize;
+
 #ifdef _OPENMP
   #pragma omp parallel
   {
@@ -81,7 +95,12 @@ void seissol::initializers::projectInitialField(std::vector<std::unique_ptr<phys
   auto iniCond = init::iniCond::view::create(iniCondData);
 
   std::vector<std::array<double, 3>> quadraturePointsXyz;
-  quadraturePointsXyz.resize(numQuadPoints);
+  quadraturePointsXyz.reserve(blockSize * numQuadPoints);
+  std::vector<CellMaterialData const*> materials;
+  materials.reserve(blockSize);
+  std::vector<real> iniCondBlockData(multipleSimulations * blockSize * numQuadPoints * numberOfQuantities);
+  std::vector<yateto::DenseTensorView<2,real,unsigned>> iniCondBlock;
+  iniCondBlock.reserve(multipleSimulations);
 
   kernel::projectIniCond krnl;
   krnl.projectQP = globalData.projectQPMatrix;
@@ -92,30 +111,52 @@ void seissol::initializers::projectInitialField(std::vector<std::unique_ptr<phys
 #ifdef _OPENMP
   #pragma omp for schedule(static)
 #endif
-  for (unsigned int meshId = 0; meshId < elements.size(); ++meshId) {
-    double const* elementCoords[4];
-    for (size_t v = 0; v < 4; ++v) {
-      elementCoords[v] = vertices[elements[meshId].vertices[ v ] ].coords;
+  for (unsigned block = 0; block < numberOfBlocks; ++block) {
+    const unsigned firstMeshId = block * blockSize;
+    const unsigned numberOfElements = std::min(blockSize, static_cast<unsigned>(elements.size()) - firstMeshId);
+    const unsigned numberOfPoints = numberOfElements * numQuadPoints;
+
+    quadraturePointsXyz.resize(numberOfPoints);
+    materials.resize(numberOfElements);
+    for (unsigned element = 0; element < numberOfElements; ++element) {
+      const unsigned meshId = firstMeshId + element;
+      double const* elementCoords[4];
+      for (size_t v = 0; v < 4; ++v) {
+        elementCoords[v] = vertices[elements[meshId].vertices[ v ] ].coords;
+      }
+      for (size_t i = 0; i < numQuadPoints; ++i) {
+        seissol::transformations::tetrahedronReferenceToGlobal(elementCoords[0], elementCoords[1], elementCoords[2], elementCoords[3], quadraturePoints[i], quadraturePointsXyz[element * numQuadPoints + i].data());
+      }
+      materials[element] = &ltsLut.lookup(lts.material, meshId);
     }
-    for (size_t i = 0; i < numQuadPoints; ++i) {
-      seissol::transformations::tetrahedronReferenceToGlobal(elementCoords[0], elementCoords[1], elementCoords[2], elementCoords[3], quadraturePoints[i], quadraturePointsXyz[i].data());
+
+    iniCondBlock.clear();
+    for (unsigned s = 0; s < multipleSimulations; ++s) {
+      iniCondBlock.emplace_back(&iniCondBlockData[s * numberOfPoints * numberOfQuantities],
+                                std::initializer_list<unsigned>{numberOfPoints, numberOfQuantities});
+      iniFields[s % iniFields.size()]->evaluateBatch(0.0, quadraturePointsXyz, materials, iniCondBlock[s]);
     }
 
-    const CellMaterialData& material = ltsLut.lookup(lts.material, meshId);
+    for (unsigned element = 0; element < numberOfElements; ++element) {
+      const unsigned meshId = firstMeshId + element;
+      for (unsigned s = 0; s < multipleSimulations; ++s) {
+        for (unsigned v = 0; v < numberOfQuantities; ++v) {
+          for (unsigned i = 0; i < numQuadPoints; ++i) {
 #ifdef MULTIPLE_SIMULATIONS
-    for (int s = 0; s < MULTIPLE_SIMULATIONS; ++s) {
-      auto sub = iniCond.subtensor(s, yateto::slice<>(), yateto::slice<>());
-      iniFields[s % iniFields.size()]->evaluate(0.0, quadraturePointsXyz, material, sub);
-    }
+            iniCond(s, i, v) = iniCondBlock[s](element * numQuadPoints + i, v);
 #else
-    iniFields[0]->evaluate(0.0, quadraturePointsXyz, material, iniCond);
+            iniCond(i, v) = iniCondBlock[s](element * numQuadPoints + i, v);
 #endif
+          }
+        }
+      }
 
-    krnl.Q = ltsLut.lookup(lts.dofs, meshId);
-    if (kernels::has_size<tensor::Qane>::value) {
-      kernels::set_Qane(krnl, &ltsLut.lookup(lts.dofsAne, meshId)[0]);
+      krnl.Q = ltsLut.lookup(lts.dofs, meshId);
+      if (kernels::has_size<tensor::Qane>::value) {
+        kernels::set_Qane(krnl, &ltsLut.lookup(lts.dofsAne, meshId)[0]);
+      }
+      krnl.execute();
     }
-    krnl.execute();
   }
 #ifdef _OPENMP
   }
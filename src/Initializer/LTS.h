@@ -49,7 +49,13 @@
 #error Preprocessor flag CONVERGENCE_ORDER is not in {2, 3, 4, 5, 6, 7, 8}.
 #endif
 
-#ifndef ACL_DEVICE
+#if !defined(ACL_DEVICE) && defined(USE_NUMA_LOCAL_MEMORY)
+#   define MEMKIND_GLOBAL   seissol::memory::Standard
+#   define MEMKIND_TIMEDOFS seissol::memory::NumaLocal
+#   define MEMKIND_CONSTANT seissol::memory::NumaLocal
+#   define MEMKIND_DOFS     seissol::memory::NumaLocal
+#   define MEMKIND_UNIFIED  seissol::memory::Standard
+#elif !defined(ACL_DEVICE)
 #   define MEMKIND_GLOBAL   seissol::memory::HighBandwidth
 #if CONVERGENCE_ORDER <= 7
 #   define MEMKIND_TIMEDOFS seissol::memory::HighBandwidth
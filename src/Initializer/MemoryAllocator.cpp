@@ -70,13 +70,167 @@
  **/
 #include "MemoryAllocator.h"
 #include <Parallel/MPI.h>
+#include <Numerical_aux/Statistics.h>
 
+#include <utils/env.h>
 #include <utils/logger.h>
+#include <utils/stringutils.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef USE_NUMA_AWARE_PINNING
+#include <numa.h>
+#include <numaif.h>
+#endif
 
 #ifdef ACL_DEVICE
 #include "device.h"
 #endif
 
+namespace {
+  /**
+   * Mapping which backs a NumaLocal allocation.
+   **/
+  struct NumaLocalRegion {
+    void*  base;
+    size_t mappedSize;
+    size_t size;
+    bool   explicitHugePages;
+  };
+
+  std::mutex numaLocalMutex;
+  //! NumaLocal regions indexed by the pointer handed out by allocate
+  std::unordered_map<void*, NumaLocalRegion> numaLocalRegions;
+
+  size_t explicitHugePageSize() {
+    size_t hugePageSize = 2 * 1024 * 1024;
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    while (meminfo >> key) {
+      if (key == "Hugepagesize:") {
+        size_t kiB;
+        if (meminfo >> kiB) {
+          hugePageSize = kiB * 1024;
+        }
+        break;
+      }
+      meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return hugePageSize;
+  }
+
+  /**
+   * Maps anonymous memory without touching it, such that the first touch places the pages.
+   **/
+  void* allocateNumaLocal(size_t size, size_t alignment) {
+    const size_t pageSize = sysconf(_SC_PAGESIZE);
+    const auto mode = seissol::memory::hugePageMode();
+
+    // mmap returns page-aligned memory; larger alignments are obtained by over-allocation
+    const size_t padding = (alignment > pageSize) ? alignment : 0;
+    size_t mappedSize = size + padding;
+    void* base = MAP_FAILED;
+    bool explicitHugePages = false;
+
+#ifdef MAP_HUGETLB
+    if (mode == seissol::memory::HugePages::Explicit) {
+      const size_t hugePageSize = explicitHugePageSize();
+      const size_t hugeSize = ((mappedSize + hugePageSize - 1) / hugePageSize) * hugePageSize;
+      base = mmap(nullptr, hugeSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (base != MAP_FAILED) {
+        mappedSize = hugeSize;
+        explicitHugePages = true;
+      } else {
+        static bool warned = false;
+        if (!warned) {
+          logWarning() << "Could not map" << hugeSize << "bytes of explicit huge pages, falling back to regular pages.";
+          warned = true;
+        }
+      }
+    }
+#endif
+
+    if (base == MAP_FAILED) {
+      base = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (base == MAP_FAILED) {
+        return nullptr;
+      }
+#ifdef MADV_HUGEPAGE
+      if (mode == seissol::memory::HugePages::Transparent) {
+        madvise(base, mappedSize, MADV_HUGEPAGE);
+      }
+#endif
+    }
+
+    uintptr_t address = reinterpret_cast<uintptr_t>(base);
+    if (padding != 0) {
+      address = ((address + alignment - 1) / alignment) * alignment;
+    }
+    void* pointer = reinterpret_cast<void*>(address);
+
+    std::lock_guard<std::mutex> lock(numaLocalMutex);
+    numaLocalRegions[pointer] = NumaLocalRegion{base, mappedSize, size, explicitHugePages};
+    return pointer;
+  }
+
+  //! Tag under which the allocations of the calling thread are accounted, empty if they are not accounted
+  thread_local std::string currentMemoryTag;
+
+  //! Only taken at the tagged allocation sites during the setup and by accountMemory
+  std::mutex accountingMutex;
+  //! Accounted bytes per tag
+  std::map<std::string, size_t> accountedBytes;
+
+  void recordAllocation(size_t size) {
+    if (currentMemoryTag.empty()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(accountingMutex);
+    accountedBytes[currentMemoryTag] += size;
+  }
+
+  void freeNumaLocal(void* pointer) {
+    std::lock_guard<std::mutex> lock(numaLocalMutex);
+    auto region = numaLocalRegions.find(pointer);
+    if (region == numaLocalRegions.end()) {
+      logError() << "Tried to free NumaLocal memory which was not allocated as such.";
+    }
+    munmap(region->second.base, region->second.mappedSize);
+    numaLocalRegions.erase(region);
+  }
+}
+
+seissol::memory::HugePages seissol::memory::hugePageMode() {
+  std::string mode = utils::Env::get<std::string>("SEISSOL_HUGE_PAGES", "none");
+  utils::StringUtils::toLower(mode);
+  if (mode == "transparent") {
+    return HugePages::Transparent;
+  }
+  if (mode == "explicit") {
+    return HugePages::Explicit;
+  }
+  if (mode != "none") {
+    logWarning() << "Unknown SEISSOL_HUGE_PAGES mode" << mode << ", using regular pages.";
+  }
+  return HugePages::None;
+}
+
 void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind i_memkind)
 {
     void* l_ptrBuffer{nullptr};
@@ -89,6 +243,15 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
       return l_ptrBuffer;
     }
 
+    if (i_memkind == NumaLocal) {
+      l_ptrBuffer = allocateNumaLocal(i_size, i_alignment);
+      if (l_ptrBuffer == nullptr) {
+        logError() << "The mmap failed (bytes: " << i_size << ", alignment: " << i_alignment << ", memkind: " << i_memkind << ").";
+      }
+      recordAllocation(i_size);
+      return l_ptrBuffer;
+    }
+
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if( i_memkind == 0 ) {
 #endif
@@ -132,10 +295,18 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
       logError() << "The malloc failed (bytes: " << i_size << ", alignment: " << i_alignment << ", memkind: " << i_memkind << ").";
     }
 
+    recordAllocation(i_size);
     return l_ptrBuffer;
 }
 
 void seissol::memory::free(void* i_pointer, enum Memkind i_memkind) {
+  if (i_memkind == NumaLocal) {
+    if (i_pointer != nullptr) {
+      freeNumaLocal(i_pointer);
+    }
+    return;
+  }
+
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if (i_memkind == Standard) {
 #endif
@@ -169,6 +340,172 @@ void seissol::memory::printMemoryAlignment( std::vector< std::vector<unsigned lo
   }
 }
 
+seissol::memory::ScopedMemoryTag::ScopedMemoryTag(std::string const& tag)
+  : m_previousTag(currentMemoryTag) {
+  currentMemoryTag = tag;
+}
+
+seissol::memory::ScopedMemoryTag::~ScopedMemoryTag() {
+  currentMemoryTag = m_previousTag;
+}
+
+void seissol::memory::accountMemory(std::string const& i_tag, size_t i_bytes) {
+  std::lock_guard<std::mutex> lock(accountingMutex);
+  accountedBytes[i_tag] += i_bytes;
+}
+
+bool seissol::memory::isMemoryDryRun() {
+  return utils::Env::get<bool>("SEISSOL_MEMORY_DRY_RUN", false);
+}
+
+void seissol::memory::printMemoryFootprint() {
+  std::map<std::string, size_t> localBytes;
+  {
+    std::lock_guard<std::mutex> lock(accountingMutex);
+    localBytes = accountedBytes;
+  }
+
+  std::set<std::string> tags;
+  for (auto const& entry : localBytes) {
+    tags.insert(entry.first);
+  }
+
+#ifdef USE_MPI
+  // The ranks may have accounted different tags, hence agree on their union first
+  std::string localTags;
+  for (auto const& tag : tags) {
+    localTags += tag + '\n';
+  }
+  const int numberOfRanks = seissol::MPI::mpi.size();
+  int localLength = localTags.size();
+  std::vector<int> lengths(numberOfRanks);
+  MPI_Allgather(&localLength, 1, MPI_INT, lengths.data(), 1, MPI_INT, seissol::MPI::mpi.comm());
+  std::vector<int> displacements(numberOfRanks, 0);
+  for (int r = 1; r < numberOfRanks; ++r) {
+    displacements[r] = displacements[r-1] + lengths[r-1];
+  }
+  std::vector<char> allTags(displacements.back() + lengths.back() + 1, '\0');
+  MPI_Allgatherv(localTags.data(), localLength, MPI_CHAR,
+                 allTags.data(), lengths.data(), displacements.data(), MPI_CHAR,
+                 seissol::MPI::mpi.comm());
+  std::istringstream tagStream(std::string(allTags.data()));
+  std::string tag;
+  while (std::getline(tagStream, tag)) {
+    if (!tag.empty()) {
+      tags.insert(tag);
+    }
+  }
+#endif
+
+  const int rank = seissol::MPI::mpi.rank();
+  constexpr double MiB = 1024.0 * 1024.0;
+  logInfo(rank) << "Memory footprint per rank in MiB (min / avg / max):";
+  double totalBytes = 0.0;
+  for (auto const& tag : tags) {
+    const auto entry = localBytes.find(tag);
+    const double bytes = (entry != localBytes.end()) ? entry->second : 0.0;
+    totalBytes += bytes;
+    const auto summary = seissol::statistics::parallelSummary(bytes / MiB);
+    logInfo(rank) << " " << tag.c_str() << ":" << summary.min << "/" << summary.mean << "/" << summary.max;
+  }
+  const auto summary = seissol::statistics::parallelSummary(totalBytes / MiB);
+  logInfo(rank) << " Total:" << summary.min << "/" << summary.mean << "/" << summary.max;
+  logInfo(rank) << "Not accounted: allocations outside of a memory tag (e.g. sources, receivers and checkpoints),"
+                << "standard containers and the buffers of the MPI and I/O libraries.";
+}
+
+void seissol::memory::printNumaPlacement() {
+  std::vector<NumaLocalRegion> regions;
+  std::vector<void*> pointers;
+  {
+    std::lock_guard<std::mutex> lock(numaLocalMutex);
+    for (auto const& region : numaLocalRegions) {
+      pointers.push_back(region.first);
+      regions.push_back(region.second);
+    }
+  }
+
+  const int rank = seissol::MPI::mpi.rank();
+  size_t totalBytes = 0;
+  size_t explicitHugeBytes = 0;
+  for (auto const& region : regions) {
+    totalBytes += region.size;
+    explicitHugeBytes += region.explicitHugePages ? region.size : 0;
+  }
+
+  const char* modeNames[] = {"none", "transparent", "explicit"};
+  logInfo(rank) << "NUMA-local memory:" << totalBytes / (1024.0 * 1024.0) << "MiB, huge pages:"
+                << modeNames[static_cast<int>(hugePageMode())]
+                << "(" << explicitHugeBytes / (1024.0 * 1024.0) << "MiB explicitly backed)";
+
+#ifdef USE_NUMA_AWARE_PINNING
+  if (numa_available() < 0) {
+    logInfo(rank) << "NUMA placement cannot be queried, libnuma reports no NUMA support.";
+    return;
+  }
+
+  const int numberOfNodes = numa_max_node() + 1;
+  std::vector<int> threadsPerNode(numberOfNodes, 0);
+#ifdef _OPENMP
+  #pragma omp parallel
+#endif
+  {
+    const int node = numa_node_of_cpu(sched_getcpu());
+#ifdef _OPENMP
+    #pragma omp critical
+#endif
+    {
+      if (node >= 0 && node < numberOfNodes) {
+        ++threadsPerNode[node];
+      }
+    }
+  }
+
+  // Sample the page locations; every sample represents the same share of its region
+  constexpr size_t MaxSamplesPerRegion = 4096;
+  const size_t pageSize = sysconf(_SC_PAGESIZE);
+  std::vector<double> bytesPerNode(numberOfNodes, 0.0);
+  double queriedBytes = 0.0;
+  for (unsigned r = 0; r < regions.size(); ++r) {
+    const size_t numberOfPages = (regions[r].size + pageSize - 1) / pageSize;
+    const size_t stride = std::max<size_t>(1, numberOfPages / MaxSamplesPerRegion);
+    std::vector<void*> pages;
+    for (size_t page = 0; page < numberOfPages; page += stride) {
+      pages.push_back(static_cast<char*>(pointers[r]) + page * pageSize);
+    }
+    std::vector<int> status(pages.size(), -1);
+    if (move_pages(0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0) {
+      continue;
+    }
+    const double bytesPerSample = static_cast<double>(regions[r].size) / pages.size();
+    for (const int node : status) {
+      if (node >= 0 && node < numberOfNodes) {
+        bytesPerNode[node] += bytesPerSample;
+        queriedBytes += bytesPerSample;
+      }
+    }
+  }
+
+  double remoteBytes = 0.0;
+  std::stringstream placement;
+  for (int node = 0; node < numberOfNodes; ++node) {
+    if (threadsPerNode[node] == 0) {
+      remoteBytes += bytesPerNode[node];
+    }
+    if (threadsPerNode[node] > 0 || bytesPerNode[node] > 0.0) {
+      const double percentage = (queriedBytes > 0.0) ? 100.0 * bytesPerNode[node] / queriedBytes : 0.0;
+      placement << " node " << node << ": " << percentage << "% (" << threadsPerNode[node] << " threads)";
+    }
+  }
+  logInfo(rank) << "NUMA placement on rank 0:" << placement.str();
+
+  const double remoteFraction = (queriedBytes > 0.0) ? remoteBytes / queriedBytes : 0.0;
+  const auto summary = seissol::statistics::parallelSummary(remoteFraction);
+  logInfo(rank) << "Fraction of NUMA-local memory on domains without worker threads (min, median, max):"
+                << summary.min << summary.median << summary.max;
+#endif
+}
+
 seissol::memory::ManagedAllocator::~ManagedAllocator()
 {
   for (AddressVector::const_iterator it = m_dataMemoryAddresses.begin(); it != m_dataMemoryAddresses.end(); ++it) {
@@ -75,6 +75,8 @@
 #include <cassert>
 #include <cstdlib>
 #include <iostream>
+#include <string>
+#include <utility>
 #include <vector>
 
 #ifdef USE_MEMKIND
@@ -88,17 +90,77 @@ namespace seissol {
       HighBandwidth = 1,
       DeviceGlobalMemory = 3,
       DeviceUnifiedMemory = 4,
-      PinnedMemory = 5
+      PinnedMemory = 5,
+      NumaLocal = 6
     };
+
+    /**
+     * Page policy of NumaLocal memory, selected with SEISSOL_HUGE_PAGES (none, transparent, explicit).
+     **/
+    enum class HugePages {
+      None,
+      Transparent,
+      Explicit
+    };
+
     void* allocate(size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard);
     void free(void* i_pointer, enum Memkind i_memkind = Standard);   
 
+    /**
+     * @return huge page policy for NumaLocal allocations.
+     **/
+    HugePages hugePageMode();
+
+    /**
+     * Reports the NUMA domains on which the pages of all NumaLocal allocations were placed.
+     * NumaLocal memory is mapped but not touched on allocation, hence the placement is
+     * decided by the first touch (see Layer::touchVariables) and should be queried afterwards.
+     **/
+    void printNumaPlacement();
+
     /**
      * Prints the memory alignment of in terms of relative start and ends in bytes.
      *
      * @param i_memoryAlignment memory alignment.
      **/
     void printMemoryAlignment( std::vector< std::vector<unsigned long long> > i_memoryAlignment );
+
+    /**
+     * Accounts all allocations of the calling thread within its scope under the given tag,
+     * e.g. "DR" or "Output". Tags nest, the innermost one is used. Allocations outside of a tag
+     * are not accounted, hence allocate and free stay cheap. Only use tags for memory which is
+     * allocated during the setup and lives for the whole run; frees are not accounted.
+     **/
+    class ScopedMemoryTag {
+      public:
+        explicit ScopedMemoryTag(std::string const& tag);
+        ~ScopedMemoryTag();
+
+        ScopedMemoryTag(ScopedMemoryTag const&) = delete;
+        ScopedMemoryTag& operator=(ScopedMemoryTag const&) = delete;
+
+      private:
+        std::string m_previousTag;
+    };
+
+    /**
+     * Accounts memory which is not obtained from allocate within a tag, e.g. Fortran arrays,
+     * the layers of an LTS tree, or memory which is only projected in a dry run.
+     **/
+    void accountMemory(std::string const& i_tag, size_t i_bytes);
+
+    /**
+     * Prints the accounted memory per tag as minimum, average and maximum over all ranks.
+     * Collective over all ranks.
+     **/
+    void printMemoryFootprint();
+
+    /**
+     * @return true if SEISSOL_MEMORY_DRY_RUN is set, i.e. if the setup should stop
+     *         after reporting the projected memory footprint.
+     **/
+    bool isMemoryDryRun();
+
     class ManagedAllocator;
   }
 }
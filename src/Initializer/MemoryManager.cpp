@@ -71,6 +71,7 @@
 #include "MemoryManager.h"
 #include "InternalState.h"
 #include "GlobalData.h"
+#include "Parallel/MPI.h"
 #include <yateto.h>
 
 #include <Kernels/common.hpp>
@@ -90,6 +91,8 @@
 
 void seissol::initializers::MemoryManager::initialize()
 {
+  seissol::memory::ScopedMemoryTag memoryTag("Global data");
+
   // initialize global matrices
   GlobalDataInitializerOnHost::init(m_globalDataOnHost, m_memoryAllocator, MEMKIND_GLOBAL);
   if constexpr (seissol::isDeviceOn()) {
@@ -420,7 +423,7 @@ void seissol::initializers::MemoryManager::touchBuffersDerivatives( Layer& layer
   }
 }
 
-void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_timeStepping,
+bool seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_timeStepping,
                                                          struct MeshStructure*i_meshStructure,
                                                          unsigned* numberOfDRCopyFaces,
                                                          unsigned* numberOfDRInteriorFaces,
@@ -431,6 +434,7 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
   // Setup tree variables
   m_lts.addTo(m_ltsTree, usePlasticity);
   seissol::SeisSol::main.postProcessor().allocateMemory(&m_ltsTree);
+  m_ltsTree.setMemoryTag("LTS");
   m_ltsTree.setNumberOfTimeClusters(i_timeStepping.numberOfLocalClusters);
 
   /// From this point, the tree layout, variables, and buckets cannot be changed anymore
@@ -444,11 +448,9 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
     cluster.child<Interior>().setNumberOfCells(i_meshStructure[tc].numberOfInteriorCells);
   }
 
-  m_ltsTree.allocateVariables();
-  m_ltsTree.touchVariables();
-
   /// Dynamic rupture tree
   m_dynRup.addTo(m_dynRupTree);
+  m_dynRupTree.setMemoryTag("DR");
   m_dynRupTree.setNumberOfTimeClusters(i_timeStepping.numberOfLocalClusters);
   m_dynRupTree.fixate();
 
@@ -459,6 +461,14 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
     cluster.child<Interior>().setNumberOfCells(numberOfDRInteriorFaces[tc]);
   }
 
+  if (seissol::memory::isMemoryDryRun()) {
+    reportProjectedMemory();
+    return false;
+  }
+
+  m_ltsTree.allocateVariables();
+  m_ltsTree.touchVariables();
+
   m_dynRupTree.allocateVariables();
   m_dynRupTree.touchVariables();
 
@@ -482,6 +492,8 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
   }
   m_dynRupTree.allocateScratchPads();
 #endif
+
+  return true;
 }
 
 void seissol::initializers::MemoryManager::fixateBoundaryLtsTree() {
@@ -489,6 +501,7 @@ void seissol::initializers::MemoryManager::fixateBoundaryLtsTree() {
 
   // Boundary face tree
   m_boundary.addTo(m_boundaryTree);
+  m_boundaryTree.setMemoryTag("Boundary");
   m_boundaryTree.setNumberOfTimeClusters(m_ltsTree.numChildren());
   m_boundaryTree.fixate();
 
@@ -563,20 +576,27 @@ void seissol::initializers::MemoryManager::deriveFaceDisplacementsBucket()
     CellMaterialData* cellMaterialData = layer->var(m_lts.material);
 
     unsigned numberOfFaces = 0;
-    for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
-      for (unsigned int face = 0; face < 4; ++face) {
-        if (requiresDisplacement(cellInformation[cell],
-                                 cellMaterialData[cell],
-                                 face)) {
-          // We add the base address later when the bucket is allocated
-          // +1 is necessary as we want to reserve the nullptr for cell without displacement.
-          // Thanks to this hack, the array contains a constant plus the offset of the current
-          // cell.
-          displacements[cell][face] =
-              static_cast<real*>(nullptr) + 1 + numberOfFaces * tensor::faceDisplacement::size();
-          ++numberOfFaces;
-        } else {
-          displacements[cell][face] = nullptr;
+    // Faces with the gravitational free surface boundary condition are stored first and
+    // in the order of the cells, such that they can be integrated as one contiguous batch.
+    for (bool gravity : {true, false}) {
+      for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
+        for (unsigned int face = 0; face < 4; ++face) {
+          if ((cellInformation[cell].faceTypes[face] == FaceType::freeSurfaceGravity) != gravity) {
+            continue;
+          }
+          if (requiresDisplacement(cellInformation[cell],
+                                   cellMaterialData[cell],
+                                   face)) {
+            // We add the base address later when the bucket is allocated
+            // +1 is necessary as we want to reserve the nullptr for cell without displacement.
+            // Thanks to this hack, the array contains a constant plus the offset of the current
+            // cell.
+            displacements[cell][face] =
+                static_cast<real*>(nullptr) + 1 + numberOfFaces * tensor::faceDisplacement::size();
+            ++numberOfFaces;
+          } else {
+            displacements[cell][face] = nullptr;
+          }
         }
       }
     }
@@ -727,6 +747,33 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFre
   deriveRequiredScratchpadMemory();
   m_ltsTree.allocateScratchPads();
 #endif
+
+  // all NumaLocal memory has been touched by now
+  seissol::memory::printNumaPlacement();
+}
+
+void seissol::initializers::MemoryManager::reportProjectedMemory() {
+  m_ltsTree.accountVariables();
+  m_dynRupTree.accountVariables();
+
+  // The buffers and derivatives depend on the LTS setup of each cell, hence assume the worst case
+  const std::pair<enum LayerType, const char*> layerTypes[] = {{Ghost, "Ghost"}, {Copy, "Copy"}, {Interior, "Interior"}};
+  for (auto const& layerType : layerTypes) {
+    size_t numberOfCells = 0;
+    for (auto it = m_ltsTree.beginLeaf(); it != m_ltsTree.endLeaf(); ++it) {
+      if (it->getLayerType() == layerType.first) {
+        numberOfCells += it->getNumberOfCells();
+      }
+    }
+    seissol::memory::accountMemory(std::string("LTS/") + layerType.second + "/buckets (upper bound)",
+                                   numberOfCells * sizeof(real) * (tensor::Q::size() + yateto::computeFamilySize<tensor::dQ>()));
+  }
+
+  seissol::memory::printMemoryFootprint();
+  const int rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Not included in the dry run: boundary and free surface trees, sources, receivers,"
+                << "output buffers, checkpoints and the buffers of the MPI and I/O libraries.";
+  logInfo(rank) << "Memory dry run done, the simulation is not started.";
 }
 
 std::pair<MeshStructure *, CompoundGlobalData>
@@ -225,6 +225,12 @@ class seissol::initializers::MemoryManager {
     void initializeCommunicationStructure();
 #endif
 
+    /**
+     * Reports the projected memory footprint of the LTS and dynamic rupture trees
+     * without allocating them (SEISSOL_MEMORY_DRY_RUN).
+     **/
+    void reportProjectedMemory();
+
   public:
     /**
      * Constructor
@@ -246,8 +252,10 @@ class seissol::initializers::MemoryManager {
      * Afterwards the tree cannot be changed anymore.
      *
      * @param i_meshStructrue mesh structure.
+     * @return false if the trees were not allocated since this is a memory dry run;
+     *         the caller has to stop the setup.
      **/
-    void fixateLtsTree(struct TimeStepping& i_timeStepping,
+    bool fixateLtsTree(struct TimeStepping& i_timeStepping,
                        struct MeshStructure*i_meshStructure,
                        unsigned* numberOfDRCopyFaces,
                        unsigned* numberOfDRInteriorFaces,
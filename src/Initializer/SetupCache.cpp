@@ -0,0 +1,250 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Per-rank binary cache of setup results.
+ **/
+
+#include "SetupCache.h"
+
+#include <Kernels/precision.hpp>
+#include <Parallel/MPI.h>
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace {
+constexpr std::uint64_t CacheMagic = 0x3148434143535353ull; // "SSSCACH1"
+
+struct CacheHeader {
+  std::uint64_t magic;
+  std::uint64_t key;
+  std::uint64_t size;
+};
+
+//! Guards against cyclic includes of easi files
+constexpr unsigned MaxEasiIncludeDepth = 32;
+
+//! @return The value of the YAML line after the tag or key, without quotes
+std::string valueAfter(std::string const& line, std::size_t position) {
+  const auto value = line.substr(position);
+  const auto begin = value.find_first_not_of(" \t\"'");
+  if (begin == std::string::npos) {
+    return std::string();
+  }
+  const auto end = value.find_last_not_of(" \t\r\"'");
+  return value.substr(begin, end - begin + 1);
+}
+
+//! Resolves a file name relative to the directory of the including file, falls back to the working directory
+std::string resolve(std::string const& fileName, std::string const& includingFile) {
+  if (fileName.empty() || fileName[0] == '/') {
+    return fileName;
+  }
+  const auto separator = includingFile.rfind('/');
+  if (separator != std::string::npos) {
+    const auto relative = includingFile.substr(0, separator + 1) + fileName;
+    std::ifstream file(relative);
+    if (file) {
+      return relative;
+    }
+  }
+  return fileName;
+}
+} // namespace
+
+void seissol::initializers::SetupCache::init() {
+  m_directory = utils::Env::get<const char*>("SEISSOL_SETUP_CACHE", "");
+  if (!enabled()) {
+    return;
+  }
+
+  logInfo(seissol::MPI::mpi.rank()) << "Caching setup results in" << m_directory;
+  addValue(CONVERGENCE_ORDER);
+  addValue(NUMBER_OF_QUANTITIES);
+  addValue(sizeof(real));
+  addValue(seissol::MPI::mpi.size());
+}
+
+void seissol::initializers::SetupCache::addFile(const char* fileName) {
+  if (!enabled()) {
+    return;
+  }
+
+  std::ifstream file(fileName, std::ios::binary);
+  if (!file) {
+    logError() << "Could not read" << fileName << "for the setup cache key.";
+  }
+  const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  addData(fileName, std::char_traits<char>::length(fileName));
+  addData(content.data(), content.size());
+}
+
+void seissol::initializers::SetupCache::addEasiFile(const char* fileName) {
+  if (!enabled()) {
+    return;
+  }
+
+  addEasiFile(std::string(fileName), 0);
+}
+
+void seissol::initializers::SetupCache::addEasiFile(std::string const& fileName, unsigned depth) {
+  if (depth > MaxEasiIncludeDepth) {
+    logError() << "Too many nested includes in" << fileName << "for the setup cache key.";
+  }
+
+  addFile(fileName.c_str());
+
+  // the includes are added in the order of their appearance, which is the same in every run
+  std::ifstream file(fileName);
+  std::string line;
+  while (std::getline(file, line)) {
+    const auto comment = line.find('#');
+    if (comment != std::string::npos) {
+      line.erase(comment);
+    }
+
+    const auto include = line.find("!Include");
+    if (include != std::string::npos) {
+      addEasiFile(resolve(valueAfter(line, include + 8), fileName), depth + 1);
+      continue;
+    }
+    const auto grid = line.find("file:");
+    if (grid != std::string::npos && (grid == 0 || line[grid - 1] == ' ' || line[grid - 1] == '\t')) {
+      addFileStatus(resolve(valueAfter(line, grid + 5), fileName));
+    }
+  }
+}
+
+void seissol::initializers::SetupCache::addFileStatus(std::string const& fileName) {
+  struct stat status;
+  if (stat(fileName.c_str(), &status) != 0) {
+    logError() << "Could not read" << fileName << "for the setup cache key.";
+  }
+  addData(fileName.data(), fileName.size());
+  addValue(status.st_size);
+  addValue(status.st_mtime);
+}
+
+void seissol::initializers::SetupCache::addData(void const* data, std::size_t size) {
+  if (!enabled()) {
+    return;
+  }
+
+  auto const* bytes = static_cast<unsigned char const*>(data);
+  for (std::size_t i = 0; i < size; ++i) {
+    m_key ^= bytes[i];
+    m_key *= 1099511628211ull;
+  }
+}
+
+bool seissol::initializers::SetupCache::read(const char* step, std::vector<Block> const& blocks) const {
+  if (!enabled()) {
+    return false;
+  }
+
+  std::size_t size = 0;
+  for (auto const& block : blocks) {
+    size += block.size;
+  }
+
+  std::ifstream file(fileName(step), std::ios::binary);
+  int valid = 0;
+  if (file) {
+    CacheHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    valid = (file && header.magic == CacheMagic && header.key == m_key && header.size == size) ? 1 : 0;
+    if (valid == 0) {
+      logWarning(seissol::MPI::mpi.rank()) << "Ignoring invalid setup cache file" << fileName(step);
+    }
+  }
+
+  // a rank which restores its result would not take part in the collectives of the step
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &valid, 1, MPI_INT, MPI_MIN, seissol::MPI::mpi.comm());
+#endif
+  if (valid == 0) {
+    return false;
+  }
+
+  for (auto const& block : blocks) {
+    file.read(static_cast<char*>(block.data), block.size);
+  }
+  if (!file) {
+    logError() << "Setup cache file" << fileName(step) << "is truncated.";
+  }
+  return true;
+}
+
+void seissol::initializers::SetupCache::write(const char* step, std::vector<Block> const& blocks) const {
+  if (!enabled()) {
+    return;
+  }
+
+  CacheHeader header{CacheMagic, m_key, 0};
+  for (auto const& block : blocks) {
+    header.size += block.size;
+  }
+
+  // write to a temporary file first, such that an aborted run never leaves a partial file
+  const auto name = fileName(step);
+  const auto tmpName = name + ".tmp";
+  {
+    std::ofstream file(tmpName, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (auto const& block : blocks) {
+      file.write(static_cast<const char*>(block.data), block.size);
+    }
+    if (!file) {
+      logWarning(seissol::MPI::mpi.rank()) << "Could not write setup cache file" << tmpName;
+      return;
+    }
+  }
+  if (std::rename(tmpName.c_str(), name.c_str()) != 0) {
+    logWarning(seissol::MPI::mpi.rank()) << "Could not write setup cache file" << name;
+  }
+}
+
+std::string seissol::initializers::SetupCache::fileName(const char* step) const {
+  std::ostringstream name;
+  name << m_directory << '/' << step << '-' << std::hex << std::setw(16) << std::setfill('0') << m_key
+       << std::dec << '-' << seissol::MPI::mpi.rank() << ".bin";
+  return name.str();
+}
@@ -0,0 +1,113 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Per-rank binary cache of setup results.
+ **/
+
+#ifndef INITIALIZER_SETUPCACHE_H_
+#define INITIALIZER_SETUPCACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace seissol::initializers {
+/**
+ * Stores results of expensive setup steps in one binary file per step and rank, such that
+ * later runs of the same configuration skip them. The file name contains a hash of
+ * everything the results depend on: the local part of the mesh, the easi files added with
+ * addEasiFile, the data added by the setup steps, the order, the equation and the number of
+ * ranks. A changed input hence never reads stale data, outdated files are simply ignored.
+ * The ranks agree on whether a step is restored, i.e. either all ranks read their result or
+ * all ranks recompute it.
+ **/
+class SetupCache {
+public:
+  //! Contiguous memory which is stored or restored
+  struct Block {
+    void* data;
+    std::size_t size;
+  };
+
+  //! Reads SEISSOL_SETUP_CACHE and hashes the build configuration
+  void init();
+
+  bool enabled() const {
+    return !m_directory.empty();
+  }
+
+  //! Adds the content of a file to the key of all following steps
+  void addFile(const char* fileName);
+
+  /**
+   * Adds an easi model to the key of all following steps: the content of the YAML file and of
+   * all files it includes (!Include), and the size and modification time of the grids it
+   * reads (file: of ASAGI or NetCDF maps). The grids are not hashed since they may be large.
+   **/
+  void addEasiFile(const char* fileName);
+
+  //! Adds raw data to the key of all following steps
+  void addData(void const* data, std::size_t size);
+
+  //! Adds a value to the key of all following steps
+  void addValue(std::uint64_t value) {
+    addData(&value, sizeof(value));
+  }
+
+  /**
+   * Restores the blocks of the given step. Collective over all ranks.
+   * @return false if the cache is disabled or holds no matching result on at least one rank
+   **/
+  bool read(const char* step, std::vector<Block> const& blocks) const;
+
+  //! Stores the blocks of the given step
+  void write(const char* step, std::vector<Block> const& blocks) const;
+
+  //! @return The file of the given step on this rank
+  std::string fileName(const char* step) const;
+
+private:
+  void addEasiFile(std::string const& fileName, unsigned depth);
+
+  //! Adds the name, size and modification time of a file
+  void addFileStatus(std::string const& fileName);
+
+  std::string m_directory;
+  //! FNV-1a hash of all inputs
+  std::uint64_t m_key = 14695981039346656037ull;
+};
+} // namespace seissol::initializers
+
+#endif
@@ -83,6 +83,9 @@ MODULE dg_setup_mod
   INTERFACE BuildSpecialDGGeometry3D_new
      MODULE PROCEDURE BuildSpecialDGGeometry3D_new
   END INTERFACE
+  INTERFACE accountElementMemory
+     MODULE PROCEDURE accountElementMemory
+  END INTERFACE
 
   !
   !---------------------------------------------------------------------------!
@@ -133,16 +136,9 @@ CONTAINS
     !
     logInfo(*) 'Enter closeGalerkin...'
     !
-    DEALLOCATE( DISC%Galerkin%geoNormals         )
-    DEALLOCATE( DISC%Galerkin%geoTangent1        )
-    DEALLOCATE( DISC%Galerkin%geoTangent2        )
-    DEALLOCATE( DISC%Galerkin%geoSurfaces        )
-    !
     IF (ASSOCIATED( DISC%Galerkin%Faculty)) DEALLOCATE(DISC%Galerkin%Faculty)
     IF (ASSOCIATED( DISC%Galerkin%TimeGaussP)) DEALLOCATE(DISC%Galerkin%TimeGaussP)
     IF (ASSOCIATED( DISC%Galerkin%TimeGaussW)) DEALLOCATE(DISC%Galerkin%TimeGaussW)
-    ! Interoperability with C needs continuous arrays in memory.
-    deallocate(disc%galerkin%dgvar)
 
     IF (ASSOCIATED( DISC%Galerkin%intGaussP_Hex)) DEALLOCATE(DISC%Galerkin%intGaussP_Hex)
     IF (ASSOCIATED( DISC%Galerkin%intGaussW_Hex)) DEALLOCATE(DISC%Galerkin%intGaussW_Hex)
@@ -250,7 +246,6 @@ CONTAINS
     INTEGER                         :: i, j, k, l, iElem, iDirac, iRicker
     INTEGER                         :: iDRFace
     INTEGER                         :: iCurElem
-    INTEGER                         :: nDGWorkVar
     INTEGER                         :: allocstat
     INTEGER                         :: iIntGP,iTimeGP,NestSize,BlockSize,iFace
     INTEGER                         :: iDegFr_xi,iDegFr_tau,iDegFr_tau2
@@ -369,6 +364,8 @@ CONTAINS
                                               )
     enddo
 
+    call accountElementMemory(OptionalFields, DISC, MESH)
+
     enableFreeSurfaceIntegration = (io%surfaceOutput > 0)
     ! put the clusters under control of the time manager
     call c_interoperability_initializeClusteredLts(&
@@ -376,31 +373,17 @@ CONTAINS
             i_enableFreeSurfaceIntegration = enableFreeSurfaceIntegration, &
             usePlasticity = logical(EQN%Plasticity == 1, 1))
 
+    ! the memory dry run stops after the clustering, the remaining setup is skipped
+    if (c_interoperability_isSetupStopped()) then
+      return
+    endif
+
     !
-    SELECT CASE(DISC%Galerkin%DGMethod)
-    CASE(3)
-        nDGWorkVar = EQN%nVar+EQN%nAneFuncperMech
-    CASE DEFAULT
-        nDGWorkVar = EQN%nVarTotal
-    END SELECT
+    ! The degrees of freedom live in the LTS tree of the C++ solver only,
+    ! hence no Fortran copy of the solution is allocated here.
     !
-    ! Allocation of arrays
-    ALLOCATE(                                                                                   &
-         DISC%Galerkin%dgvar( DISC%Galerkin%nDegFr,EQN%nVarTotal,MESH%nElem,DISC%Galerkin%nRK), &
-         STAT = allocstat                                                                       )
-    IF(allocStat .NE. 0) THEN
-       logError(*) 'could not allocate all variables!'
-       call MPI_ABORT(MPI%commWorld, 134)
-    END IF
-    !
-    IF(DISC%Galerkin%DGMethod.EQ.3) THEN
-        ALLOCATE( DISC%Galerkin%DGTaylor(DISC%Galerkin%nDegFr,EQN%nVarTotal,0:DISC%Galerkin%nPoly,MESH%nElem), &
-                  STAT = allocstat )
-        IF(allocStat .NE. 0) THEN
-           logError(*) 'could not allocate DISC%Galerkin%DGTayl.'
-           call MPI_ABORT(MPI%commWorld, 134)
-        END IF
-    ENDIF
+    ! The element time step widths have been handed over to the time manager.
+    call close_calc_deltaT(optionalFields)
 
 #ifdef PARALLEL
     IF(MPI%nCPU.GT.1) THEN                                          !
@@ -958,8 +941,9 @@ CONTAINS
     INTEGER :: VertexSide_Tet(MESH%nSides_Tet,MESH%nVertices_Tri)
     INTEGER :: VertexSide_Hex(MESH%nSides_Hex,MESH%nVertices_Quad)              ! # sides = 6, # vertices per side = 4
     INTEGER :: allocstat                        ! Status of allocation        !
-    REAL    :: Length                           ! Length of tangent vector    !
+    INTEGER :: iFault                           ! Fault side counter          !
     REAL    :: BaryVec(EQN%Dimension,MESH%nSideMax), Dist(MESH%nSideMax)
+    REAL    :: sideNormal(3), sideSurfaces(MESH%nSideMax)
     REAL    :: minv
     INTEGER :: minl(1)
     INTEGER :: i, j, iLayer, iZone
@@ -1038,17 +1022,9 @@ CONTAINS
     VertexSide_Hex(5,:) =  (/ 2,1,3,4 /)   ! Local hex. vertices of side V        !
     VertexSide_Hex(6,:) =  (/ 5,6,8,7 /)   ! Local hex. vertices of side VI       !
     !
-    ALLOCATE( DISC%Galerkin%geoNormals(EQN%Dimension,MESH%nSideMax,MESH%nElem),  &
-              DISC%Galerkin%geoTangent1(EQN%Dimension,MESH%nSideMax,MESH%nElem),  &
-              DISC%Galerkin%geoTangent2(EQN%Dimension,MESH%nSideMax,MESH%nElem),  &
-              DISC%Galerkin%geoSurfaces(MESH%nSideMax,MESH%nElem),  &
-              STAT=allocstat )
-    IF (allocStat .NE. 0) THEN
-       logError(*) 'Interface SeisSol: could not allocate all variables!'
-       call MPI_ABORT(MPI%commWorld, 134)
-    END IF
-
     ! Calculating boundary surfaces (3D)
+    ! The side normals and surfaces are only needed to derive the insphere radii,
+    ! hence they are not stored per element.
 
     DO iElem=1,MESH%nElem
        DO iSide=1,MESH%LocalElemType(iElem)
@@ -1061,22 +1037,18 @@ CONTAINS
               sidevec(:,2) = MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Tet(iSide,3),iElem)) - &
                              MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Tet(iSide,1),iElem))
               ! Normal vector computed by cross product
-              DISC%Galerkin%geoNormals(:,iSide,iElem) =  sidevec(:,1).x.sidevec(:,2)
+              sideNormal(:) = sidevec(:,1).x.sidevec(:,2)
               ! Triangle surface = 0.5 * cross_product
-              DISC%Galerkin%geoSurfaces(iSide,iElem)  =  0.5*SQRT(                                     &
-                                                         DISC%Galerkin%geoNormals(1,iSide,iElem)**2 +  &
-                                                         DISC%Galerkin%geoNormals(2,iSide,iElem)**2 +  &
-                                                         DISC%Galerkin%geoNormals(3,iSide,iElem)**2    )
+              sideSurfaces(iSide) = 0.5*SQRT(SUM(sideNormal(:)**2))
               ! Normalize normal vector to length 1
-              DISC%Galerkin%geoNormals(:,iSide,iElem) =  0.5*DISC%Galerkin%geoNormals(:,iSide,iElem) / &
-                                                         DISC%Galerkin%geoSurfaces(iSide,iElem)
+              sideNormal(:) = 0.5*sideNormal(:) / sideSurfaces(iSide)
               !
               ! Compute MinDistBarySide :
               ! 1. Compute vector connecting barycenter of tetrahedron and local point 1 of the side
               BaryVec(:,iSide) = MESH%ELEM%xyBary(:,iElem) - MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Tet(iSide,1),iElem))
               ! 2. Compute scalar product of previous vector and normal vector (already normalized to 1)
               !    and take the absolute value.
-              Dist(iSide) = ABS(DOT_PRODUCT(BaryVec(:,iSide),DISC%Galerkin%geoNormals(:,iSide,iElem)))
+              Dist(iSide) = ABS(DOT_PRODUCT(BaryVec(:,iSide),sideNormal(:)))
           CASE(6)
               ! Boundary side vector pointing in chi-direction
               sidevec(:,1) = MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Hex(iSide,2),iElem)) - &
@@ -1085,12 +1057,9 @@ CONTAINS
               sidevec(:,2) = MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Hex(iSide,3),iElem)) - &
                              MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Hex(iSide,1),iElem))
               ! Normal vector computed by cross product
-              DISC%Galerkin%geoNormals(:,iSide,iElem) =  sidevec(:,1).x.sidevec(:,2)
+              sideNormal(:) = sidevec(:,1).x.sidevec(:,2)
               ! Triangle's surface = 0.5 * cross_product
-              DISC%Galerkin%geoSurfaces(iSide,iElem)  =  0.5*SQRT(                                     &
-                                                         DISC%Galerkin%geoNormals(1,iSide,iElem)**2 +  &
-                                                         DISC%Galerkin%geoNormals(2,iSide,iElem)**2 +  &
-                                                         DISC%Galerkin%geoNormals(3,iSide,iElem)**2    )
+              sideSurfaces(iSide) = 0.5*SQRT(SUM(sideNormal(:)**2))
 
               ! Boundary side vector pointing in chi-direction
               sidevec(:,1) = MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Hex(iSide,4),iElem)) - &
@@ -1099,44 +1068,20 @@ CONTAINS
               sidevec(:,2) = MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Hex(iSide,2),iElem)) - &
                              MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Hex(iSide,3),iElem))
               ! Normal vector computed by cross product
-              DISC%Galerkin%geoNormals(:,iSide,iElem) =  sidevec(:,1).x.sidevec(:,2)
+              sideNormal(:) = sidevec(:,1).x.sidevec(:,2)
               ! Second triangle's surface = 0.5 * cross_product
-              DISC%Galerkin%geoSurfaces(iSide,iElem)  =  DISC%Galerkin%geoSurfaces(iSide,iElem) +      &
-                                                         0.5*SQRT(                                     &
-                                                         DISC%Galerkin%geoNormals(1,iSide,iElem)**2 +  &
-                                                         DISC%Galerkin%geoNormals(2,iSide,iElem)**2 +  &
-                                                         DISC%Galerkin%geoNormals(3,iSide,iElem)**2    )
+              sideSurfaces(iSide) = sideSurfaces(iSide) + 0.5*SQRT(SUM(sideNormal(:)**2))
 
               ! Normalize normal vector to length 1
-              DISC%Galerkin%geoNormals(:,iSide,iElem) =  DISC%Galerkin%geoNormals(:,iSide,iElem) / &
-                                                         SQRT(SUM(DISC%Galerkin%geoNormals(:,iSide,iElem)**2))
+              sideNormal(:) = sideNormal(:) / SQRT(SUM(sideNormal(:)**2))
               !
               ! Compute MinDistBarySide :
               ! 1. Compute vector connecting barycenter of tetrahedron and local point 1 of the side
               BaryVec(:,iSide) = MESH%ELEM%xyBary(:,iElem) - MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Hex(iSide,1),iElem))
               ! 2. Compute scalar product of previous vector and normal vector (already normalized to 1)
               !    and take the absolute value.
-              Dist(iSide) = ABS(DOT_PRODUCT(BaryVec(:,iSide),DISC%Galerkin%geoNormals(:,iSide,iElem)))
-
-              !
-              CONTINUE
-              !
+              Dist(iSide) = ABS(DOT_PRODUCT(BaryVec(:,iSide),sideNormal(:)))
           END SELECT
-          ! Compute vector inside the triangle's plane for the rotation matrix
-          DISC%Galerkin%geoTangent1(:,iSide,iElem) = sidevec(:,1)
-          ! Normalize to 1
-          Length = SQRT(DISC%Galerkin%geoTangent1(1,iSide,iElem)**2 + &
-                        DISC%Galerkin%geoTangent1(2,iSide,iElem)**2 + &
-                        DISC%Galerkin%geoTangent1(3,iSide,iElem)**2   )
-          DISC%Galerkin%geoTangent1(:,iSide,iElem) = DISC%Galerkin%geoTangent1(:,iSide,iElem)/Length
-          ! Compute second vector in the plane, orthogonal to the normal and tangent 1 vectors
-          ! using the crossproduct
-          DISC%Galerkin%geoTangent2(:,iSide,iElem) = DISC%Galerkin%geoNormals( :,iSide,iElem) .x. &
-                                                     DISC%Galerkin%geoTangent1(:,iSide,iElem)
-          ! Check: Length must be 1.
-          Length = DISC%Galerkin%geoTangent2(1,iSide,iElem)**2 + &
-                   DISC%Galerkin%geoTangent2(2,iSide,iElem)**2 + &
-                   DISC%Galerkin%geoTangent2(3,iSide,iElem)**2
       ENDDO
       !
       SELECT CASE(MESH%LocalElemType(iElem))
@@ -1145,11 +1090,30 @@ CONTAINS
           MESH%ELEM%MinDistBarySide(iElem) = MINVAL(Dist(:))
       CASE(4)
           ! Insphere radius of tetrahedron (is larger the the previous minimum distance !!!)
-          MESH%ELEM%MinDistBarySide(iElem) = 3*MESH%ELEM%Volume(iElem)/SUM(DISC%Galerkin%geoSurfaces(1:4,iElem))
+          MESH%ELEM%MinDistBarySide(iElem) = 3*MESH%ELEM%Volume(iElem)/SUM(sideSurfaces(1:4))
       END SELECT
       !
     ENDDO
     !
+    ! Surfaces of the fault sides, e.g. for the magnitude output
+    IF (EQN%DR.EQ.1) THEN
+      DO iFault = 1, MESH%Fault%nSide
+        iElem = MESH%Fault%Face(iFault,1,1)
+        iSide = MESH%Fault%Face(iFault,2,1)
+        IF (iElem.EQ.0) THEN
+          ! the "+" element is located on another rank
+          iElem = MESH%Fault%Face(iFault,1,2)
+          iSide = MESH%Fault%Face(iFault,2,2)
+        ENDIF
+        sidevec(:,1) = MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Tet(iSide,2),iElem)) - &
+                       MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Tet(iSide,1),iElem))
+        sidevec(:,2) = MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Tet(iSide,3),iElem)) - &
+                       MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide_Tet(iSide,1),iElem))
+        sideNormal(:) = sidevec(:,1).x.sidevec(:,2)
+        MESH%Fault%geoSurfaces(iFault) = 0.5*SQRT(SUM(sideNormal(:)**2))
+      ENDDO
+    ENDIF
+    !
     ! Report mesh quality
     !
     minl = MINLOC(MESH%ELEM%Volume(:))
@@ -1360,4 +1324,55 @@ CONTAINS
     !
   END SUBROUTINE BuildSpecialDGGeometry3D_new
 
+  !===========================================================================!
+  !!                                                                         !!
+  !! accountElementMemory accounts the per-element arrays which remain on    !!
+  !! the Fortran side after the setup, one memory tag per array              !!
+  !!                                                                         !!
+  !===========================================================================!
+
+  SUBROUTINE accountElementMemory(OptionalFields, DISC, MESH)
+    !-------------------------------------------------------------------------!
+    IMPLICIT NONE
+    !-------------------------------------------------------------------------!
+    ! Argument list declaration
+    TYPE(tUnstructOptionalFields)  :: OptionalFields
+    TYPE(tDiscretization)          :: DISC
+    TYPE(tUnstructMesh)            :: MESH
+    !-------------------------------------------------------------------------!
+    INTENT(IN)                     :: OptionalFields, DISC, MESH
+    !-------------------------------------------------------------------------!
+    IF (ASSOCIATED(MESH%ELEM%Vertex)) call accountFortranArray('MESH%ELEM%Vertex', SIZE(MESH%ELEM%Vertex, KIND=8) * STORAGE_SIZE(MESH%ELEM%Vertex) / 8)
+    IF (ASSOCIATED(MESH%ELEM%Reference)) call accountFortranArray('MESH%ELEM%Reference', SIZE(MESH%ELEM%Reference, KIND=8) * STORAGE_SIZE(MESH%ELEM%Reference) / 8)
+    IF (ASSOCIATED(MESH%ELEM%MPIReference)) call accountFortranArray('MESH%ELEM%MPIReference', SIZE(MESH%ELEM%MPIReference, KIND=8) * STORAGE_SIZE(MESH%ELEM%MPIReference) / 8)
+    IF (ASSOCIATED(MESH%ELEM%MPINumber)) call accountFortranArray('MESH%ELEM%MPINumber', SIZE(MESH%ELEM%MPINumber, KIND=8) * STORAGE_SIZE(MESH%ELEM%MPINumber) / 8)
+    IF (ASSOCIATED(MESH%ELEM%BoundaryToObject)) call accountFortranArray('MESH%ELEM%BoundaryToObject', SIZE(MESH%ELEM%BoundaryToObject, KIND=8) * STORAGE_SIZE(MESH%ELEM%BoundaryToObject) / 8)
+    IF (ASSOCIATED(MESH%ELEM%SideNeighbor)) call accountFortranArray('MESH%ELEM%SideNeighbor', SIZE(MESH%ELEM%SideNeighbor, KIND=8) * STORAGE_SIZE(MESH%ELEM%SideNeighbor) / 8)
+    IF (ASSOCIATED(MESH%ELEM%LocalNeighborSide)) call accountFortranArray('MESH%ELEM%LocalNeighborSide', SIZE(MESH%ELEM%LocalNeighborSide, KIND=8) * STORAGE_SIZE(MESH%ELEM%LocalNeighborSide) / 8)
+    IF (ASSOCIATED(MESH%ELEM%LocalNeighborVrtx)) call accountFortranArray('MESH%ELEM%LocalNeighborVrtx', SIZE(MESH%ELEM%LocalNeighborVrtx, KIND=8) * STORAGE_SIZE(MESH%ELEM%LocalNeighborVrtx) / 8)
+    IF (ASSOCIATED(MESH%ELEM%Volume)) call accountFortranArray('MESH%ELEM%Volume', SIZE(MESH%ELEM%Volume, KIND=8) * STORAGE_SIZE(MESH%ELEM%Volume) / 8)
+    IF (ASSOCIATED(MESH%ELEM%xyBary)) call accountFortranArray('MESH%ELEM%xyBary', SIZE(MESH%ELEM%xyBary, KIND=8) * STORAGE_SIZE(MESH%ELEM%xyBary) / 8)
+    IF (ASSOCIATED(MESH%ELEM%MinDistBarySide)) call accountFortranArray('MESH%ELEM%MinDistBarySide', SIZE(MESH%ELEM%MinDistBarySide, KIND=8) * STORAGE_SIZE(MESH%ELEM%MinDistBarySide) / 8)
+    IF (ALLOCATED(MESH%LocalElemType)) call accountFortranArray('MESH%LocalElemType', SIZE(MESH%LocalElemType, KIND=8) * STORAGE_SIZE(MESH%LocalElemType) / 8)
+    IF (ALLOCATED(MESH%LocalVrtxType)) call accountFortranArray('MESH%LocalVrtxType', SIZE(MESH%LocalVrtxType, KIND=8) * STORAGE_SIZE(MESH%LocalVrtxType) / 8)
+    IF (ASSOCIATED(OptionalFields%BackgroundValue)) call accountFortranArray('OptionalFields%BackgroundValue', SIZE(OptionalFields%BackgroundValue, KIND=8) * STORAGE_SIZE(OptionalFields%BackgroundValue) / 8)
+    IF (ASSOCIATED(DISC%Galerkin%MaxWaveSpeed)) call accountFortranArray('DISC%Galerkin%MaxWaveSpeed', SIZE(DISC%Galerkin%MaxWaveSpeed, KIND=8) * STORAGE_SIZE(DISC%Galerkin%MaxWaveSpeed) / 8)
+  END SUBROUTINE accountElementMemory
+
+  SUBROUTINE accountFortranArray(name, nBytes)
+    !-------------------------------------------------------------------------!
+    use iso_c_binding, only: c_null_char, c_long_long
+    use f_ftoc_bind_interoperability
+    !-------------------------------------------------------------------------!
+    IMPLICIT NONE
+    !-------------------------------------------------------------------------!
+    ! Argument list declaration
+    CHARACTER(LEN=*)               :: name
+    INTEGER(KIND=8)                :: nBytes
+    !-------------------------------------------------------------------------!
+    INTENT(IN)                     :: name, nBytes
+    !-------------------------------------------------------------------------!
+    call c_interoperability_accountMemory('Fortran/' // name // c_null_char, int(nBytes, kind=c_long_long))
+  END SUBROUTINE accountFortranArray
+
 END MODULE dg_setup_mod
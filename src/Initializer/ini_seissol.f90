@@ -290,6 +290,12 @@ CONTAINS
          MPI    = MPI                                , &              !
          IO     = IO                                   )              !
     !                                                                       !
+    IF (c_interoperability_isSetupStopped()) THEN
+      ! memory dry run
+      EPIK_FUNC_END()
+      SCOREP_USER_FUNC_END()
+      RETURN
+    ENDIF
     logInfo(*) 'Galerkin module initialized correctly.'    !
     !
     !aheineck: Metisweighs are not used, @TODO we should delete this
@@ -41,11 +41,15 @@
  **/
 
 #include "Parallel/MPI.h"
+#include "SeisSol.h"
 
+#include "utils/env.h"
 #include "utils/logger.h"
 
 #include "LtsLayout.h"
 #include "MultiRate.hpp"
+#include "common.hpp"
+#include <algorithm>
 #include <iterator>
 
 seissol::initializers::time_stepping::LtsLayout::LtsLayout():
@@ -55,7 +59,9 @@ seissol::initializers::time_stepping::LtsLayout::LtsLayout():
  m_globalTimeStepRates(      NULL ),
  m_plainCopyRegions(         NULL ),
  m_numberOfPlainGhostCells(  NULL ),
- m_plainGhostCellClusterIds( NULL ) {}
+ m_plainGhostCellClusterIds( NULL ),
+ m_dynamicRuptureLts(        false ),
+ m_maximumClusterDifference( 1 ) {}
 
 seissol::initializers::time_stepping::LtsLayout::~LtsLayout() {
   // free memory of member variables
@@ -206,6 +212,11 @@ void seissol::initializers::time_stepping::LtsLayout::deriveDynamicRupturePlainC
   m_dynamicRupturePlainCopy.resize(     m_localClusters.size() );
   for (unsigned face = 0; face < m_fault.size(); ++face) {
     int meshId = (m_fault[face].element >= 0) ? m_fault[face].element : m_fault[face].neighborElement;
+    // faces between different clusters belong to the faster one
+    if (m_fault[face].element >= 0 && m_fault[face].neighborElement >= 0 &&
+        m_cellClusterIds[m_fault[face].neighborElement] < m_cellClusterIds[meshId]) {
+      meshId = m_fault[face].neighborElement;
+    }
     unsigned localCluster = getLocalClusterId( m_cellClusterIds[meshId] );
     
     assert(localCluster < m_localClusters.size());
@@ -477,8 +488,71 @@ void seissol::initializers::time_stepping::LtsLayout::synchronizePlainGhostData(
 #endif // USE_MPI
 }
 
+bool seissol::initializers::time_stepping::LtsLayout::plainCopyClusterIdsChanged( unsigned int i_region ) const {
+  if( m_plainCopyClusterIdsSent.size() <= i_region ||
+      m_plainCopyClusterIdsSent[i_region].size() != m_plainCopyRegions[i_region].size() ) {
+    return true;
+  }
+
+  for( unsigned int l_copyCell = 0; l_copyCell < m_plainCopyRegions[i_region].size(); l_copyCell++ ) {
+    if( m_cellClusterIds[ m_plainCopyRegions[i_region][l_copyCell] ] != m_plainCopyClusterIdsSent[i_region][l_copyCell] ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 void seissol::initializers::time_stepping::LtsLayout::synchronizePlainGhostClusterIds() {
-  synchronizePlainGhostData(m_cellClusterIds, m_plainGhostCellClusterIds);
+  // allocate memory for the cluster ids of the ghost layer
+  if( m_plainGhostCellClusterIds == NULL ) {
+    m_plainGhostCellClusterIds = new unsigned int*[ m_plainNeighboringRanks.size() ];
+    for( unsigned int l_neighbor = 0; l_neighbor < m_plainNeighboringRanks.size(); l_neighbor++ ) {
+      m_plainGhostCellClusterIds[l_neighbor] = new unsigned int[ m_numberOfPlainGhostCells[l_neighbor] ];
+    }
+  }
+
+  // detect the copy regions with changed cluster ids
+  std::vector< char > l_changed( m_plainNeighboringRanks.size(), 0 );
+  for( unsigned int l_region = 0; l_region < m_plainNeighboringRanks.size(); l_region++ ) {
+    l_changed[l_region] = plainCopyClusterIdsChanged( l_region ) ? 1 : 0;
+  }
+
+  m_plainCopyClusterIdsSent.resize( m_plainNeighboringRanks.size() );
+  for( unsigned int l_region = 0; l_region < m_plainNeighboringRanks.size(); l_region++ ) {
+    if( l_changed[l_region] ) {
+      m_plainCopyClusterIdsSent[l_region].resize( m_plainCopyRegions[l_region].size() );
+      for( unsigned int l_copyCell = 0; l_copyCell < m_plainCopyRegions[l_region].size(); l_copyCell++ ) {
+        m_plainCopyClusterIdsSent[l_region][l_copyCell] = m_cellClusterIds[ m_plainCopyRegions[l_region][l_copyCell] ];
+      }
+    }
+  }
+
+#ifdef USE_MPI
+  std::vector< MPI_Request > l_requests( m_plainNeighboringRanks.size() * 2 );
+
+  for( unsigned int l_region = 0; l_region < m_plainNeighboringRanks.size(); l_region++ ) {
+    // unchanged regions are announced by an empty message
+    MPI_Isend( m_plainCopyClusterIdsSent[l_region].data(),                             // buffer
+               l_changed[l_region] ? m_plainCopyClusterIdsSent[l_region].size() : 0,   // size
+               MPI_UNSIGNED,                                                           // data type
+               m_plainNeighboringRanks[l_region],                                      // destination
+               synchronizeClusters,                                                    // message tag
+               seissol::MPI::mpi.comm(),                                               // communicator
+               &l_requests[l_region] );                                                // mpi request
+
+    // an empty message leaves the ghost cluster ids untouched
+    MPI_Irecv( m_plainGhostCellClusterIds[l_region],                                  // buffer
+               m_numberOfPlainGhostCells[l_region],                                    // maximum size
+               MPI_UNSIGNED,                                                           // data type
+               m_plainNeighboringRanks[l_region],                                      // source
+               synchronizeClusters,                                                    // message tag
+               seissol::MPI::mpi.comm(),                                               // communicator
+               &l_requests[l_region + m_plainNeighboringRanks.size()] );               // mpi request
+  }
+
+  MPI_Waitall( l_requests.size(), l_requests.data(), MPI_STATUSES_IGNORE );
+#endif // USE_MPI
 }
 
 unsigned seissol::initializers::time_stepping::LtsLayout::enforceDynamicRuptureGTS() {
@@ -495,6 +569,10 @@ unsigned seissol::initializers::time_stepping::LtsLayout::enforceDynamicRuptureG
       face = fault->neighborSide;
     }
     if (m_cells[meshId].neighborRanks[face] == rank ) {
+      // the faster side evaluates the friction law of rank-local faces
+      if (m_dynamicRuptureLts) {
+        continue;
+      }
       unsigned neighborId = m_cells[meshId].neighbors[face];
       if (m_cellClusterIds[meshId] != m_cellClusterIds[neighborId]) {
         unsigned minCluster = std::min(m_cellClusterIds[meshId], m_cellClusterIds[neighborId]);
@@ -516,12 +594,21 @@ unsigned seissol::initializers::time_stepping::LtsLayout::enforceDynamicRuptureG
   return reductions;
 }
 
+bool seissol::initializers::time_stepping::LtsLayout::hasRemoteFaceNeighbor( unsigned int i_cell ) const {
+  const int rank = seissol::MPI::mpi.rank();
+
+  for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+    if( m_cells[i_cell].neighborRanks[l_face] != rank ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 unsigned int seissol::initializers::time_stepping::LtsLayout::enforceMaximumDifference( unsigned int i_difference ) {
 	const int rank = seissol::MPI::mpi.rank();
 
-  // get up-to-date cluster ids of the ghost layer before starting
-  synchronizePlainGhostClusterIds();
-
   // number of reductions per iteration
   unsigned int l_numberOfReductions      = 1;
 
@@ -533,7 +620,10 @@ unsigned int seissol::initializers::time_stepping::LtsLayout::enforceMaximumDiff
 
     // iterate over mesh
     for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
-      unsigned int l_minimumNeighborId = std::numeric_limits<unsigned int>::max();
+      unsigned int l_maximumId = std::numeric_limits<unsigned int>::max();
+
+      // the copy layer exchanges buffers and derivatives with adjacent clusters only
+      const bool l_copyCell = hasRemoteFaceNeighbor( l_cell );
 
       // get the ids
       for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
@@ -541,10 +631,19 @@ unsigned int seissol::initializers::time_stepping::LtsLayout::enforceMaximumDiff
         if (l_faceType == FaceType::regular ||
            l_faceType == FaceType::periodic ||
            l_faceType == FaceType::dynamicRupture) {
+          // the friction law expands the slower side relative to the time step of the next cluster
+          unsigned int l_faceDifference = i_difference;
+          if( l_copyCell || l_faceType == FaceType::dynamicRupture ) {
+            l_faceDifference = std::min( i_difference, 1u );
+          }
+
           // neighbor cell is part of copy layer/interior
           if( m_cells[l_cell].neighborRanks[l_face] == rank ) {
             unsigned int l_neighborId = m_cells[l_cell].neighbors[l_face];
-            l_minimumNeighborId = std::min( l_minimumNeighborId, m_cellClusterIds[l_neighborId] );
+            if( hasRemoteFaceNeighbor( l_neighborId ) ) {
+              l_faceDifference = std::min( i_difference, 1u );
+            }
+            l_maximumId = std::min( l_maximumId, m_cellClusterIds[l_neighborId] + l_faceDifference );
           }
           // cell is part of the ghost layer
           else {
@@ -556,17 +655,17 @@ unsigned int seissol::initializers::time_stepping::LtsLayout::enforceMaximumDiff
 
             assert( l_localGhostCell < m_numberOfPlainGhostCells[l_region] );
 
-            l_minimumNeighborId = std::min( l_minimumNeighborId, m_plainGhostCellClusterIds[l_region][l_localGhostCell] );
+            l_maximumId = std::min( l_maximumId, m_plainGhostCellClusterIds[l_region][l_localGhostCell] + l_faceDifference );
           }
         }
       }
 
       // assert we have a face neighbor
-      assert( l_minimumNeighborId != std::numeric_limits<unsigned int>::max() );
+      assert( l_maximumId != std::numeric_limits<unsigned int>::max() );
 
       // lower id of the cell if required
-      if( m_cellClusterIds[l_cell] > l_minimumNeighborId + i_difference ) {
-        m_cellClusterIds[l_cell] = l_minimumNeighborId + i_difference;
+      if( m_cellClusterIds[l_cell] > l_maximumId ) {
+        m_cellClusterIds[l_cell] = l_maximumId;
         l_numberOfReductions++;
       }
 
@@ -579,64 +678,112 @@ unsigned int seissol::initializers::time_stepping::LtsLayout::enforceMaximumDiff
 }
 
 unsigned int seissol::initializers::time_stepping::LtsLayout::enforceSingleBuffer() {
-  // TODO: Implementation required
-  return 0;
-}
-
-void seissol::initializers::time_stepping::LtsLayout::normalizeClustering() {
   const int rank = seissol::MPI::mpi.rank();
-  // allocate memory for the cluster ids of the ghost layer
-  m_plainGhostCellClusterIds = new unsigned int*[ m_plainNeighboringRanks.size() ];
-  for( unsigned int l_neighbor = 0; l_neighbor < m_plainNeighboringRanks.size(); l_neighbor++ ) {
-    m_plainGhostCellClusterIds[l_neighbor] = new unsigned int[ m_numberOfPlainGhostCells[l_neighbor] ];
+
+  unsigned int l_numberOfReductions = 0;
+
+  for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+    // cluster ids of the face neighbors, faces without neighbor share the cell's cluster id
+    unsigned int l_neighboringClusterIds[4];
+
+    for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+      l_neighboringClusterIds[l_face] = m_cellClusterIds[l_cell];
+
+      FaceType l_faceType = getFaceType( m_cells[l_cell].boundaries[l_face] );
+      if( l_faceType == FaceType::regular || l_faceType == FaceType::periodic ) {
+        if( m_cells[l_cell].neighborRanks[l_face] == rank ) {
+          l_neighboringClusterIds[l_face] = m_cellClusterIds[ m_cells[l_cell].neighbors[l_face] ];
+        }
+        else {
+          unsigned int l_region = getPlainRegion( m_cells[l_cell].neighborRanks[l_face] );
+          l_neighboringClusterIds[l_face] = m_plainGhostCellClusterIds[l_region][ m_cells[l_cell].mpiIndices[l_face] ];
+        }
+      }
+    }
+
+    const unsigned int l_bufferClusterId = getBufferClusterId( m_cellClusterIds[l_cell], l_neighboringClusterIds );
+
+    // lower the larger face neighbors of the local domain to the cluster of the buffer
+    // (ghost cells differ by at most one cluster and therefore never exceed the buffer's cluster)
+    for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+      FaceType l_faceType = getFaceType( m_cells[l_cell].boundaries[l_face] );
+      if( ( l_faceType == FaceType::regular || l_faceType == FaceType::periodic ) &&
+          m_cells[l_cell].neighborRanks[l_face] == rank ) {
+        unsigned int l_neighborId = m_cells[l_cell].neighbors[l_face];
+        if( m_cellClusterIds[l_neighborId] > l_bufferClusterId ) {
+          m_cellClusterIds[l_neighborId] = l_bufferClusterId;
+          l_numberOfReductions++;
+        }
+      }
+    }
   }
 
+  return l_numberOfReductions;
+}
+
+void seissol::initializers::time_stepping::LtsLayout::normalizeClustering( unsigned int i_maximumDifference ) {
   // enforce requirements until mesh is valid
-  unsigned int l_maximumDifference      = 0;
-  unsigned int l_dynamicRupture         = 0;
-  unsigned int l_singleBuffer           = 0;
   unsigned int l_totalMaximumDifference = 0;
   unsigned int l_totalDynamicRupture    = 0;
   unsigned int l_totalSingleBuffer      = 0;
 
-  int l_globalContinue = 1;
+  // get up-to-date cluster ids of the ghost layer before starting
+  synchronizePlainGhostClusterIds();
 
   // continue until all ranks converged to a normalized mesh
-  while( l_globalContinue ) {
-    // get up-to-date cluster ids of the ghost layer before starting
-    synchronizePlainGhostClusterIds();
-
-    l_dynamicRupture = enforceDynamicRuptureGTS();
+  while( true ) {
+    // Enforce all requirements against the current ghost layer until the local mesh does not change
+    // anymore. Ghost exchanges are then only required for changes which cascade across ranks.
+    unsigned int l_localReductions = 1;
+    while( l_localReductions != 0 ) {
+      const unsigned int l_dynamicRupture = enforceDynamicRuptureGTS();
+
+      // enforce maximum difference of cluster ids
+      unsigned int l_maximumDifference = 0;
+      if( m_clusteringStrategy == single ) {
+        l_maximumDifference = enforceMaximumDifference( 0 );
+      }
+      else if( m_clusteringStrategy == multiRate ) {
+        l_maximumDifference = enforceMaximumDifference( i_maximumDifference );
+      }
+      else logError() << "clustering stategy not supported";
 
-    // enforce maximum difference of cluster ids
-    if( m_clusteringStrategy == single ) {
-      l_maximumDifference = enforceMaximumDifference( 0 );
-    }
-    else if( m_clusteringStrategy == multiRate ) {
-      l_maximumDifference = enforceMaximumDifference( 1 );
-    }
-    else logError() << "clustering stategy not supported";
+      // a single buffer is sufficient for differences of 0 or 1 by construction
+      const unsigned int l_singleBuffer = ( i_maximumDifference > 1 ) ? enforceSingleBuffer() : 0;
 
-    // TODO: missing implementation (works only for max. difference 0 or 1)
-    l_singleBuffer = enforceSingleBuffer();
+      l_totalMaximumDifference += l_maximumDifference;
+      l_totalDynamicRupture    += l_dynamicRupture;
+      l_totalSingleBuffer      += l_singleBuffer;
 
-    l_totalMaximumDifference += l_maximumDifference;
-    l_totalDynamicRupture    += l_dynamicRupture;
-    l_totalSingleBuffer      += l_singleBuffer;
+      l_localReductions = l_maximumDifference + l_dynamicRupture + l_singleBuffer;
+    }
 
-    // check if this rank requires another iteration
-    int l_localContinue = l_maximumDifference + l_dynamicRupture + l_singleBuffer;
+    // another exchange is only required if the copy layer of any rank changed since the last exchange
+    int l_localContinue = 0;
+    for( unsigned int l_region = 0; l_region < m_plainNeighboringRanks.size(); l_region++ ) {
+      if( plainCopyClusterIdsChanged( l_region ) ) {
+        l_localContinue = 1;
+        break;
+      }
+    }
 
+    int l_globalContinue = l_localContinue;
 #ifdef USE_MPI
-    // continue if any rank is required to continue
     MPI_Allreduce( &l_localContinue, &l_globalContinue, 1, MPI_INT, MPI_MAX, seissol::MPI::mpi.comm() );
-#else
-    l_globalContinue = l_localContinue;
 #endif
+    if( !l_globalContinue ) {
+      break;
+    }
+
+    synchronizePlainGhostClusterIds();
   }
 
   //logInfo() << "Performed a total of" << l_totalMaximumDifference << "reductions (max. diff.) for" << m_cells.size() << "cells," << l_totalDynamicRupture << "reductions (dyn. rup.) for" << m_fault.size() << "faces.";
-  
+}
+
+void seissol::initializers::time_stepping::LtsLayout::printClusterHistogram() {
+  const int rank = seissol::MPI::mpi.rank();
+
   int* localClusterHistogram = new int[m_numberOfGlobalClusters];
   for (unsigned cluster = 0; cluster < m_numberOfGlobalClusters; ++cluster) {
     localClusterHistogram[cluster] = 0;
@@ -1155,6 +1302,34 @@ void seissol::initializers::time_stepping::LtsLayout::deriveLayout( enum TimeClu
 
   m_clusteringStrategy = i_timeClustering;
 
+  m_dynamicRuptureLts = utils::Env::get<int>("SEISSOL_DR_LTS", 0) != 0;
+#ifdef ACL_DEVICE
+  if (m_dynamicRuptureLts) {
+    logWarning(rank) << "Local time stepping across dynamic rupture faces is not supported on devices.";
+    m_dynamicRuptureLts = false;
+  }
+#endif
+  if (m_dynamicRuptureLts) {
+    logInfo(rank) << "Dynamic rupture faces between cells of the same rank may connect different time clusters.";
+  }
+
+  if( m_clusteringStrategy == single ) {
+    m_maximumClusterDifference = 0;
+  }
+  else {
+    m_maximumClusterDifference = std::max( utils::Env::get<int>("SEISSOL_LTS_MAX_DIFFERENCE", 1), 1 );
+    if( m_maximumClusterDifference > MaximumLtsClusterDifference ) {
+      logWarning(rank) << "SEISSOL_LTS_MAX_DIFFERENCE is limited to" << MaximumLtsClusterDifference;
+      m_maximumClusterDifference = MaximumLtsClusterDifference;
+    }
+#ifdef ACL_DEVICE
+    if( m_maximumClusterDifference > 1 ) {
+      logWarning(rank) << "Cluster differences larger than one between face neighbors are not supported on devices.";
+      m_maximumClusterDifference = 1;
+    }
+#endif
+  }
+
   // derive time stepping clusters and per-cell cluster ids (w/o normalizations)
   if( m_clusteringStrategy == single ) {
     MultiRate::deriveClusterIds( m_cells.size(),
@@ -1184,16 +1359,50 @@ void seissol::initializers::time_stepping::LtsLayout::deriveLayout( enum TimeClu
   // normalize mpi indices
   normalizeMpiIndices();
 
-  // normalize clustering
-  normalizeClustering();
+  double l_perCellSpeedup, l_clusteringSpeedup;
+
+  // the normalized clustering only depends on the per-cell time steps and the clustering parameters
+  auto& setupCache = seissol::SeisSol::main.setupCache();
+  if( setupCache.enabled() ) {
+    setupCache.addData( m_cellTimeStepWidths, m_cells.size() * sizeof(double) );
+    setupCache.addValue( i_clusterRate );
+    setupCache.addValue( m_clusteringStrategy );
+    setupCache.addValue( m_maximumClusterDifference );
+    setupCache.addValue( m_dynamicRuptureLts );
+  }
+  const std::vector<SetupCache::Block> l_cachedClustering{ { m_cellClusterIds, m_cells.size() * sizeof(unsigned int) } };
+
+  if( setupCache.read( "lts-clustering", l_cachedClustering ) ) {
+    logInfo(rank) << "LTS clustering restored from the setup cache.";
+    // the derived layout reads the cluster ids of the ghost layer
+    synchronizePlainGhostClusterIds();
+  }
+  else {
+    // reference clustering with face neighbors differing by at most one cluster
+    if( m_maximumClusterDifference > 1 ) {
+      std::vector< unsigned int > l_cellClusterIds( m_cellClusterIds, m_cellClusterIds + m_cells.size() );
+
+      normalizeClustering( 1 );
+      getTheoreticalSpeedup( l_perCellSpeedup, l_clusteringSpeedup );
+      logInfo(rank) << "maximum theoretical speedup (compared to GTS):"
+                      << l_clusteringSpeedup << "with a maximum cluster difference of 1 between face neighbors.";
+
+      std::copy( l_cellClusterIds.begin(), l_cellClusterIds.end(), m_cellClusterIds );
+    }
+
+    // normalize clustering
+    normalizeClustering( m_maximumClusterDifference );
+    setupCache.write( "lts-clustering", l_cachedClustering );
+  }
+  printClusterHistogram();
 
   // get maximum speedups compared to GTS
-  double l_perCellSpeedup, l_clusteringSpeedup;
   getTheoreticalSpeedup( l_perCellSpeedup, l_clusteringSpeedup );
 
   // get maximum speedup
   logInfo(rank) << "maximum theoretical speedup (compared to GTS):"
-                  << l_perCellSpeedup << "per cell LTS," << l_clusteringSpeedup << "with the used clustering.";
+                  << l_perCellSpeedup << "per cell LTS," << l_clusteringSpeedup << "with the used clustering"
+                  << "(maximum cluster difference of" << m_maximumClusterDifference << "between face neighbors).";
 
   // derive clustered copy and interior layout
   deriveClusteredCopyInterior();
@@ -1221,6 +1430,8 @@ void seissol::initializers::time_stepping::LtsLayout::getCrossClusterTimeSteppin
   // set synchronization time invalid
   o_timeStepping.synchronizationTime = std::numeric_limits<double>::min();
 
+  o_timeStepping.maximumClusterDifference = m_maximumClusterDifference;
+
   // set number of local clusters
   o_timeStepping.numberOfLocalClusters = m_localClusters.size();
 
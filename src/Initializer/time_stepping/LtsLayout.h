@@ -67,6 +67,12 @@ class seissol::initializers::time_stepping::LtsLayout {
     //! used clustering strategy
     enum TimeClustering m_clusteringStrategy;
 
+    //! true if dynamic rupture faces between cells of this rank may connect different clusters
+    bool m_dynamicRuptureLts;
+
+    //! maximum difference of the cluster ids of face neighbors in the interior of the local domain
+    unsigned int m_maximumClusterDifference;
+
     //! cells in the local domain
     std::vector<Element> m_cells;
 
@@ -122,6 +128,9 @@ class seissol::initializers::time_stepping::LtsLayout {
     //! cluster ids of the cells in the ghost layer
     unsigned int **m_plainGhostCellClusterIds;
 
+    //! cluster ids of the plain copy regions as last sent to the neighboring ranks
+    std::vector< std::vector< unsigned int > > m_plainCopyClusterIdsSent;
+
     //! face ids of interior dr faces
     std::vector< std::vector<int> > m_dynamicRupturePlainInterior;
 
@@ -251,19 +260,39 @@ class seissol::initializers::time_stepping::LtsLayout {
 
     /**
      * Synchronizes the cluster ids of the cells in the plain ghost layer.
+     * Only regions with changed cluster ids are sent, the neighboring rank keeps its ghost ids on an empty message.
      **/
     void synchronizePlainGhostClusterIds();
 
     /**
-     * Enforces the same time step for all cells with dynamic rupture faces.
+     * Checks if the cluster ids of a plain copy region changed since they were last sent.
+     *
+     * @param i_region id of the plain region.
+     * @return true if the region was never sent or at least one cluster id differs.
+     **/
+    bool plainCopyClusterIdsChanged( unsigned int i_region ) const;
+
+    /**
+     * Enforces the same time step for both sides of dynamic rupture faces.
+     * With local time stepping across the fault, only faces at MPI boundaries are affected.
      */
     unsigned enforceDynamicRuptureGTS();
 
     /**
-     * Enforces a maximum cluster difference between all cells.
+     * Checks if a cell has a face neighbor on a different rank, that is, if the cell is part of the copy layer.
+     *
+     * @param i_cell local id of the cell.
+     * @return true if at least one face neighbor is located on a different rank.
+     **/
+    bool hasRemoteFaceNeighbor( unsigned int i_cell ) const;
+
+    /**
+     * Enforces a maximum cluster difference between all cells, until the local mesh does not change anymore.
+     * The cluster ids of the ghost layer are used as they are, the caller synchronizes them.
      * 0: GTS (no difference of cluster ids allowed).
      * 1: Only a single difference in the cluster id is allowed, for example 2 is allowed to neighbor 1,2,3 but not 0 or 4.
      * [...]
+     * Differences larger than one are restricted to faces which are neither dynamic rupture faces nor adjacent to the copy layer.
      *
      * @param i_difference maximum allowed difference.
      * @return number of performed per-cell adjustments.
@@ -278,16 +307,21 @@ class seissol::initializers::time_stepping::LtsLayout {
      *   The scheme only provides one derivative (-> 2*dt - neighbor) and one buffer (-> 4*dt neighbor).
      *   Therefore we have to lower the time step of the 8*dt neighbor to 4*dt.
      *
-     * TODO: This function is not implemented but required for maximum differences other than 0 or 1.
-     *
      * @return number of performed normalizations.
      **/
     unsigned int enforceSingleBuffer();
 
     /**
      * Normalizes the clustering.
+     *
+     * @param i_maximumDifference maximum difference of the cluster ids of face neighbors.
+     **/
+    void normalizeClustering( unsigned int i_maximumDifference );
+
+    /**
+     * Prints the number of cells in the time clusters.
      **/
-    void normalizeClustering();
+    void printClusterHistogram();
 
     /**
      * Gets the maximum possible speedups.
@@ -52,6 +52,29 @@ namespace seissol {
 namespace initializers {
 namespace time_stepping {
   
+/**
+ * Gets the cluster of the LTS buffer of a cell.
+ *   All face neighbors with a larger time step than the cell operate on the single buffer of the cell,
+ *   hence they are required to belong to this cluster (see LtsLayout::enforceSingleBuffer).
+ *
+ * @return smallest global cluster id of the face neighbors with a larger cluster id than the cell, i_localClusterId if no such neighbor exists.
+ * @param i_localClusterId global id of the cluster to which this cell belongs.
+ * @param i_neighboringClusterIds global ids of the clusters the face neighbors belong to, set to i_localClusterId if not present.
+ **/
+static unsigned int getBufferClusterId( unsigned int       i_localClusterId,
+                                        const unsigned int i_neighboringClusterIds[4] ) {
+  unsigned int l_bufferClusterId = i_localClusterId;
+
+  for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+    if( i_neighboringClusterIds[l_face] > i_localClusterId &&
+        ( l_bufferClusterId == i_localClusterId || i_neighboringClusterIds[l_face] < l_bufferClusterId ) ) {
+      l_bufferClusterId = i_neighboringClusterIds[l_face];
+    }
+  }
+
+  return l_bufferClusterId;
+}
+
 /**
  * Gets the lts setup in relation to the four face neighbors.
  *   Remark: Remember to perform the required normalization step.
@@ -107,6 +130,18 @@ namespace time_stepping {
  *     [ 15 14 13 12 11 |    10    |  9  8  7  6  5  4  3  2  1  0  ]
  *  In Example 5 the buffer is a LTS buffer (reset on request only). GTS buffers are updated in every time step.
  *
+ * -------------------------------------------------------------------------------
+ *
+ *  Bits 11 - 13: difference of the cluster ids of the larger face neighbors and the cell (0 if not present).
+ *                All larger face neighbors share a single cluster, the difference determines when the LTS buffer is reset
+ *                and the point in time the derivatives of the larger face neighbors are expanded around.
+ *
+ *     Example 6:
+ *     [  rem.  | cl. diff. |          first 11 bits            ]
+ *     [  -  -  | 0   1   0 |  1  -  1  -  -  -  -  -  -  -  -  ]
+ *     [ 15 14  | 13 12  11 | 10  9  8  7  6  5  4  3  2  1  0  ]
+ *  In Example 6 the larger face neighbors belong to the cluster two levels above the cell's cluster.
+ *
  * @return lts setup.
  * @param i_localCluster global id of the cluster to which this cell belongs.
  * @param i_neighboringClusterIds global ids of the clusters the face neighbors belong to (if present).
@@ -159,6 +194,11 @@ static unsigned short getLtsSetup(unsigned int i_localClusterId,
 
         // the cell-local buffer is used in LTS-fashion
         l_ltsSetup |= ( 1 << 10     );
+
+        // difference of the cluster ids, identical for all larger face neighbors
+        assert( i_neighboringClusterIds[l_face] - i_localClusterId <= MaximumLtsClusterDifference );
+        assert( (l_ltsSetup >> 11)%8 == 0 || (l_ltsSetup >> 11)%8 == i_neighboringClusterIds[l_face] - i_localClusterId );
+        l_ltsSetup |= ( (i_neighboringClusterIds[l_face] - i_localClusterId) << 11 );
       }
       // GTS relation
       else if( i_localClusterId == i_neighboringClusterIds[l_face] ) {
@@ -46,6 +46,9 @@
 
 #include <Initializer/MemoryAllocator.h>
 
+#include <string>
+#include <utility>
+
 namespace seissol {
   namespace initializers {
     class LTSTree;
@@ -61,6 +64,7 @@ private:
   seissol::memory::ManagedAllocator m_allocator;
   std::vector<size_t> variableSizes{};  /*!< sizes of variables within the entire tree in bytes */
   std::vector<size_t> bucketSizes{};    /*!< sizes of buckets within the entire tree in bytes */
+  std::string m_memoryTag{"LTS"};       /*!< tag under which the memory of the tree is accounted */
 
 #ifdef ACL_DEVICE
   std::vector<MemoryInfo> scratchpadMemInfo{};
@@ -69,6 +73,33 @@ private:
   std::vector<int> scratchpadMemIds{};
 #endif  // ACL_DEVICE
 
+  /// Splits sizes, which are added by addSizes(layer, bytes), by layer type for the memory accounting
+  template<typename AddSizes>
+  std::vector<std::vector<std::pair<std::string, size_t>>> sizesPerLayer(unsigned count, std::string const& kind, AddSizes addSizes) {
+    const std::pair<enum LayerType, const char*> layerTypes[] = {{Ghost, "Ghost"}, {Copy, "Copy"}, {Interior, "Interior"}};
+    std::vector<std::vector<std::pair<std::string, size_t>>> parts(count);
+    for (auto const& layerType : layerTypes) {
+      std::vector<size_t> bytes(count, 0);
+      for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
+        if (it->getLayerType() == layerType.first) {
+          addSizes(*it, bytes);
+        }
+      }
+      for (unsigned index = 0; index < count; ++index) {
+        if (bytes[index] > 0) {
+          parts[index].emplace_back(m_memoryTag + "/" + layerType.second + "/" + kind, bytes[index]);
+        }
+      }
+    }
+    return parts;
+  }
+
+  std::vector<std::vector<std::pair<std::string, size_t>>> variableSizesPerLayer() {
+    return sizesPerLayer(varInfo.size(), "variables", [&](Layer& layer, std::vector<size_t>& bytes) {
+      layer.addVariableSizes(varInfo, bytes);
+    });
+  }
+
 public:
   LTSTree() : m_vars(NULL), m_buckets(NULL) {}
   
@@ -78,6 +109,11 @@ public:
     setChildren<TimeCluster>(numberOfTimeCluster);
   }
   
+  /// Sets the tag under which the memory of this tree is accounted, e.g. "DR".
+  void setMemoryTag(std::string const& memoryTag) {
+    m_memoryTag = memoryTag;
+  }
+
   void fixate() {
     setPostOrderPointers();
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
@@ -149,8 +185,12 @@ public:
       it->addVariableSizes(varInfo, variableSizes);
     }
 
+    const auto variableParts = variableSizesPerLayer();
     for (unsigned var = 0; var < varInfo.size(); ++var) {
       m_vars[var] = m_allocator.allocateMemory(variableSizes[var], varInfo[var].alignment, varInfo[var].memkind);
+      for (auto const& part : variableParts[var]) {
+        seissol::memory::accountMemory(part.first, part.second);
+      }
     }
     
     std::fill(variableSizes.begin(), variableSizes.end(), 0);
@@ -168,8 +208,14 @@ public:
       it->addBucketSizes(bucketSizes);
     }
     
+    const auto bucketParts = sizesPerLayer(bucketInfo.size(), "buckets", [](Layer& layer, std::vector<size_t>& bytes) {
+      layer.addBucketSizes(bytes);
+    });
     for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
       m_buckets[bucket] = m_allocator.allocateMemory(bucketSizes[bucket], bucketInfo[bucket].alignment, bucketInfo[bucket].memkind);
+      for (auto const& part : bucketParts[bucket]) {
+        seissol::memory::accountMemory(part.first, part.second);
+      }
     }
     
     std::fill(bucketSizes.begin(), bucketSizes.end(), 0);
@@ -200,6 +246,7 @@ public:
       scratchpadMemories[id] = m_allocator.allocateMemory(scratchpadMemSizes[id],
                                                           scratchpadMemInfo[id].alignment,
                                                           scratchpadMemInfo[id].memkind);
+      seissol::memory::accountMemory(m_memoryTag + "/scratchpads", scratchpadMemSizes[id]);
     }
 
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
@@ -208,6 +255,15 @@ public:
   }
 #endif
   
+  /// Accounts the memory of the variables without allocating them, see seissol::memory::isMemoryDryRun.
+  void accountVariables() {
+    for (auto const& parts : variableSizesPerLayer()) {
+      for (auto const& part : parts) {
+        seissol::memory::accountMemory(part.first, part.second);
+      }
+    }
+  }
+
   void touchVariables() {
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
       it->touchVariables(varInfo);
@@ -242,6 +242,8 @@ public:
   }
 #endif
   
+  /// Zeros all variables by first touch. The schedule has to match the one of the
+  /// kernel loops such that NumaLocal pages end up on the domain of the thread using them.
   void touchVariables(std::vector<MemoryInfo> const& vars) {
     for (unsigned var = 0; var < vars.size(); ++var) {
 
@@ -38,6 +38,7 @@
  **/
 
 #include "Lut.hpp"
+#include <Initializer/MemoryAllocator.h>
 
 seissol::initializers::Lut::LutsForMask::LutsForMask()
   : ltsToMesh(NULL), duplicatedMeshIds(NULL), numberOfDuplicatedMeshIds(0)
@@ -111,6 +112,9 @@ void seissol::initializers::Lut::LutsForMask::createLut(  LayerMask mask,
   }
   
   delete[] numDuplicates;
+
+  seissol::memory::accountMemory("LTS/lookup tables",
+                                 (numberOfLtsIds + MaxDuplicates * numberOfMeshIds + numberOfDuplicatedMeshIds) * sizeof(unsigned));
 }
 
 seissol::initializers::Lut::Lut()
@@ -158,4 +162,6 @@ void seissol::initializers::Lut::createLuts(  LTSTree*        ltsTree,
   }
   
   delete[] clusters;
+
+  seissol::memory::accountMemory("LTS/lookup tables", numberOfMeshIds * sizeof(unsigned));
 }
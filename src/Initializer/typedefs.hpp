@@ -86,8 +86,16 @@ struct TimeStepping {
    * Ids of the local clusters with respect to global ordering.
    */
   unsigned int *clusterIds;
+
+  /*
+   * Maximum difference of the global cluster ids of face neighbors.
+   */
+  unsigned int maximumClusterDifference;
 };
 
+// upper bound for the difference of the cluster ids of face neighbors (stored in bits 11 - 13 of the LTS setup)
+constexpr unsigned int MaximumLtsClusterDifference = 7;
+
 // cell local information
 struct CellLocalInformation {
   // types of the faces
@@ -420,6 +428,9 @@ struct DRFaceInformation {
   unsigned plusSide;
   unsigned minusSide;
   unsigned faceRelation;
+  // the side belongs to the next slower time cluster (LTS across the fault)
+  bool plusSideSlower;
+  bool minusSideSlower;
 };
 
 struct DRGodunovData {
@@ -119,7 +119,9 @@ void seissol::kernels::DynamicRupture::spaceTimeInterpolation(  DRFaceInformatio
                                                                 real                        QInterpolatedPlus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
                                                                 real                        QInterpolatedMinus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
                                                                 real const*                 timeDerivativePlus_prefetch,
-                                                                real const*                 timeDerivativeMinus_prefetch ) {
+                                                                real const*                 timeDerivativeMinus_prefetch,
+                                                                double                      timeShiftPlus,
+                                                                double                      timeShiftMinus ) {
   // assert alignments
 #ifndef NDEBUG
   assert( timeDerivativePlus != nullptr );
@@ -137,8 +139,8 @@ void seissol::kernels::DynamicRupture::spaceTimeInterpolation(  DRFaceInformatio
   dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints krnl = m_krnlPrototype;
 
   for (unsigned timeInterval = 0; timeInterval < CONVERGENCE_ORDER; ++timeInterval) {
-    m_timeKernel.computeTaylorExpansion(timePoints[timeInterval], 0.0, timeDerivativePlus, degreesOfFreedomPlus);
-    m_timeKernel.computeTaylorExpansion(timePoints[timeInterval], 0.0, timeDerivativeMinus, degreesOfFreedomMinus);
+    m_timeKernel.computeTaylorExpansion(timePoints[timeInterval], -timeShiftPlus, timeDerivativePlus, degreesOfFreedomPlus);
+    m_timeKernel.computeTaylorExpansion(timePoints[timeInterval], -timeShiftMinus, timeDerivativeMinus, degreesOfFreedomMinus);
 
     real const* plusPrefetch = (timeInterval < CONVERGENCE_ORDER-1) ? &QInterpolatedPlus[timeInterval+1][0] : timeDerivativePlus_prefetch;
     real const* minusPrefetch = (timeInterval < CONVERGENCE_ORDER-1) ? &QInterpolatedMinus[timeInterval+1][0] : timeDerivativeMinus_prefetch;
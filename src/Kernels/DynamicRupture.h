@@ -75,6 +75,11 @@ class seissol::kernels::DynamicRupture {
     
     void setTimeStepWidth(double timestep);
 
+    /**
+     * Evaluates both sides at the time points of the current time step. A side whose
+     * derivatives were computed at an earlier time (a slower cluster under LTS) is shifted
+     * by the time elapsed since then.
+     **/
     void spaceTimeInterpolation(  DRFaceInformation const&    faceInfo,
                                   GlobalData const*           global,
                                   DRGodunovData const*        godunovData,
@@ -83,7 +88,9 @@ class seissol::kernels::DynamicRupture {
                                   real                        QInterpolatedPlus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
                                   real                        QInterpolatedMinus[CONVERGENCE_ORDER][seissol::tensor::QInterpolated::size()],
                                   real const*                 timeDerivativePlus_prefetch,
-                                  real const*                 timeDerivativeMinus_prefetch);
+                                  real const*                 timeDerivativeMinus_prefetch,
+                                  double                      timeShiftPlus = 0.0,
+                                  double                      timeShiftMinus = 0.0);
 
   void batchedSpaceTimeInterpolation(ConditionalBatchTableT& table);
 
@@ -42,7 +42,9 @@
 #define VOLUME_H_
 
 #include <Initializer/typedefs.hpp>
+#include <array>
 #include <cassert>
+#include <vector>
 #include <Kernels/common.hpp>
 #include <Kernels/Interface.hpp>
 #include <Kernels/LocalBase.h>
@@ -59,6 +61,9 @@ class seissol::kernels::Local : public LocalBase {
     void setHostGlobalData(GlobalData const* global);
     void setGlobalData(const CompoundGlobalData& global);
 
+    /**
+     * Volume and local flux integral including the nodal boundary conditions of all faces.
+     **/
     void computeIntegral(real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
                          LocalData& data,
                          LocalTmp& tmp,
@@ -67,6 +72,39 @@ class seissol::kernels::Local : public LocalBase {
                          double time,
                          double timeStepWidth);
 
+    /**
+     * Volume and local flux integral without boundary conditions.
+     **/
+    void computeIntegral(real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                         LocalData& data,
+                         LocalTmp& tmp);
+
+    /**
+     * Nodal boundary conditions of a single face of the respective type, see computeIntegral.
+     * The free surface with gravity works on the average normal displacement at the nodes of the face,
+     * the analytical boundary condition on the nodes of the face in global coordinates.
+     **/
+    void computeFreeSurfaceGravityIntegral(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                           LocalData& data,
+                                           unsigned face,
+                                           real* nodalAvgDisplacement,
+                                           const CellMaterialData& materialData,
+                                           const CellBoundaryMapping& boundaryMapping);
+
+    void computeDirichletIntegral(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                  LocalData& data,
+                                  unsigned face,
+                                  const CellBoundaryMapping& boundaryMapping);
+
+    void computeAnalyticalIntegral(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                                   LocalData& data,
+                                   unsigned face,
+                                   const std::vector<std::array<double, 3>>& nodes,
+                                   const CellMaterialData& materialData,
+                                   const CellBoundaryMapping& boundaryMapping,
+                                   double time,
+                                   double timeStepWidth);
+
     void computeBatchedIntegral(ConditionalBatchTableT &table, LocalTmp& tmp);
 
     void flopsIntegral(FaceType const i_faceTypes[4],
@@ -74,6 +112,12 @@ class seissol::kernels::Local : public LocalBase {
                        unsigned int &o_hardwareFlops );
                         
     unsigned bytesIntegral();
+
+  private:
+    void executeNodalFlux(const real i_timeIntegratedDegreesOfFreedom[tensor::I::size()],
+                          LocalData& data,
+                          unsigned face,
+                          real dofsFaceBoundaryNodal[tensor::INodal::size()]);
 };
 
 #endif
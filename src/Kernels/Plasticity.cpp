@@ -44,10 +44,15 @@
 #include <cstring>
 #include <algorithm>
 #include <cmath>
+#include <vector>
 #include <generated_code/kernel.h>
 #include <generated_code/init.h>
 #include "common.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifdef ACL_DEVICE
 #include "device.h"
 #include "DeviceAux/PlasticityAux.h"
@@ -55,6 +60,171 @@ using namespace device;
 #endif
 
 namespace seissol::kernels {
+  Plasticity::NodalBounds Plasticity::computeNodalBounds(GlobalData const* global) {
+    NodalBounds bounds{0.0, 0.0, 0.0};
+#ifndef MULTIPLE_SIMULATIONS
+    real QStress[tensor::QStress::size()] __attribute__((aligned(ALIGNMENT)));
+    real QStressNodal[tensor::QStressNodal::size()] __attribute__((aligned(ALIGNMENT)));
+    auto QStressView = init::QStress::view::create(QStress);
+    auto QStressNodalView = init::QStressNodal::view::create(QStressNodal);
+    const unsigned numModes = QStressView.shape(0);
+    const unsigned numNodes = QStressNodalView.shape(0);
+
+    // Evaluate every basis function at the nodes by converting unit modal vectors,
+    // such that we do not depend on the storage order of the Vandermonde matrix.
+    std::vector<real> basisAtNodes(numNodes * numModes);
+    kernel::plConvertToNodalNoLoading m2nKrnl;
+    m2nKrnl.v = global->vandermondeMatrix;
+    m2nKrnl.QStress = QStress;
+    m2nKrnl.QStressNodal = QStressNodal;
+    for (unsigned l = 0; l < numModes; ++l) {
+      std::fill(QStress, QStress + tensor::QStress::size(), 0.0);
+      QStressView(l, 0) = 1.0;
+      m2nKrnl.execute();
+      for (unsigned k = 0; k < numNodes; ++k) {
+        basisAtNodes[k * numModes + l] = QStressNodalView(k, 0);
+      }
+    }
+
+    for (unsigned k = 0; k < numNodes; ++k) {
+      bounds.constantMode += basisAtNodes[k * numModes] / numNodes;
+    }
+    for (unsigned k = 0; k < numNodes; ++k) {
+      real squaredNorm = 0.0;
+      for (unsigned l = 1; l < numModes; ++l) {
+        squaredNorm += basisAtNodes[k * numModes + l] * basisAtNodes[k * numModes + l];
+      }
+      bounds.spread = std::max(bounds.spread, std::abs(basisAtNodes[k * numModes] - bounds.constantMode));
+      bounds.higherModes = std::max(bounds.higherModes, std::sqrt(squaredNorm));
+    }
+#endif
+    return bounds;
+  }
+
+  bool Plasticity::mayYield(NodalBounds const& bounds,
+                            PlasticityData const* plasticityData,
+                            real const degreesOfFreedom[tensor::Q::size()]) {
+#ifdef MULTIPLE_SIMULATIONS
+    return true;
+#else
+    /* With s_k = c + d_k, where c is the stress of the constant mode plus sigma0 and |d_{k,ij}| <= r_{ij},
+     * the triangle inequality gives tau(s_k) <= tau(c) + tau(r) (the deviatoric part has a smaller norm)
+     * and m(s_k) >= m(c) - (r_xx + r_yy + r_zz) / 3. Hence, tau <= taulim holds at every node
+     * if it holds for the upper bound of tau and the lower bound of taulim. */
+    real constantStress[6];
+    real deviation[6];
+    for (unsigned p = 0; p < 6; ++p) {
+      real const* modes = degreesOfFreedom + p * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS;
+      real squaredNorm = 0.0;
+#pragma omp simd reduction(+:squaredNorm)
+      for (unsigned l = 1; l < NUMBER_OF_ALIGNED_BASIS_FUNCTIONS; ++l) {
+        squaredNorm += modes[l] * modes[l];
+      }
+      constantStress[p] = bounds.constantMode * modes[0] + plasticityData->initialLoading[p];
+      deviation[p] = bounds.spread * std::abs(modes[0]) + bounds.higherModes * std::sqrt(squaredNorm);
+    }
+
+    const real mean = (constantStress[0] + constantStress[1] + constantStress[2]) / 3.0;
+    const real tauConstant = std::sqrt(0.5 * ((constantStress[0] - mean) * (constantStress[0] - mean)
+                                            + (constantStress[1] - mean) * (constantStress[1] - mean)
+                                            + (constantStress[2] - mean) * (constantStress[2] - mean))
+                                       + constantStress[3] * constantStress[3]
+                                       + constantStress[4] * constantStress[4]
+                                       + constantStress[5] * constantStress[5]);
+    const real tauDeviation = std::sqrt(0.5 * (deviation[0] * deviation[0] + deviation[1] * deviation[1] + deviation[2] * deviation[2])
+                                        + deviation[3] * deviation[3] + deviation[4] * deviation[4] + deviation[5] * deviation[5]);
+    const real meanDeviation = (deviation[0] + deviation[1] + deviation[2]) / 3.0;
+    const real taulimLower = std::max((real) 0.0, plasticityData->cohesionTimesCosAngularFriction
+                                                  - mean * plasticityData->sinAngularFriction
+                                                  - std::abs(plasticityData->sinAngularFriction) * meanDeviation);
+
+    // safety margin for the round-off of the nodal evaluation; NaNs are candidates as well
+    const real safety = 1.0 + 1.0e3 * std::numeric_limits<real>::epsilon();
+    return !(safety * (tauConstant + tauDeviation) <= taulimLower);
+#endif
+  }
+
+  unsigned Plasticity::computePlasticityLayer(double oneMinusIntegratingFactor,
+                                              double timeStepWidth,
+                                              double T_v,
+                                              GlobalData const* global,
+                                              NodalBounds const& bounds,
+                                              unsigned numberOfCells,
+                                              PlasticityData const* plasticityData,
+                                              real (*degreesOfFreedom)[tensor::Q::size()],
+                                              real (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS],
+                                              unsigned char* mayYieldFlags,
+                                              unsigned* cellIndices,
+                                              unsigned& numberOfCandidates) {
+#ifdef _OPENMP
+    const unsigned maxThreads = omp_get_max_threads();
+#else
+    const unsigned maxThreads = 1;
+#endif
+    // candidatesBefore[t] is the number of candidates found by the threads before thread t
+    std::vector<unsigned> candidatesBefore(maxThreads + 1, 0);
+    unsigned numberOfYieldingCells = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:numberOfYieldingCells)
+#endif
+    {
+#ifdef _OPENMP
+      const unsigned thread = omp_get_thread_num();
+      const unsigned numThreads = omp_get_num_threads();
+#else
+      const unsigned thread = 0;
+      const unsigned numThreads = 1;
+#endif
+      // contiguous chunk per thread, such that the scatter keeps the cells in order
+      const unsigned begin = static_cast<unsigned>(static_cast<unsigned long>(numberOfCells) * thread / numThreads);
+      const unsigned end = static_cast<unsigned>(static_cast<unsigned long>(numberOfCells) * (thread + 1) / numThreads);
+
+      unsigned count = 0;
+      for (unsigned cell = begin; cell < end; ++cell) {
+        mayYieldFlags[cell] = mayYield(bounds, &plasticityData[cell], degreesOfFreedom[cell]) ? 1 : 0;
+        count += mayYieldFlags[cell];
+      }
+      candidatesBefore[thread + 1] = count;
+
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+      {
+        // exclusive prefix sum over the counts of the threads
+        for (unsigned t = 0; t < numThreads; ++t) {
+          candidatesBefore[t + 1] += candidatesBefore[t];
+        }
+        numberOfCandidates = candidatesBefore[numThreads];
+      }
+
+      unsigned position = candidatesBefore[thread];
+      for (unsigned cell = begin; cell < end; ++cell) {
+        if (mayYieldFlags[cell] != 0) {
+          cellIndices[position++] = cell;
+        }
+      }
+      const unsigned numCandidates = candidatesBefore[numThreads];
+
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp for schedule(static)
+#endif
+      for (unsigned candidate = 0; candidate < numCandidates; ++candidate) {
+        const unsigned cell = cellIndices[candidate];
+        numberOfYieldingCells += computePlasticity(oneMinusIntegratingFactor,
+                                                   timeStepWidth,
+                                                   T_v,
+                                                   global,
+                                                   &plasticityData[cell],
+                                                   degreesOfFreedom[cell],
+                                                   pstrain[cell]);
+      }
+    }
+    return numberOfYieldingCells;
+  }
+
   unsigned Plasticity::computePlasticity(double oneMinusIntegratingFactor,
                                          double timeStepWidth,
                                          double T_v,
@@ -479,4 +649,15 @@ namespace seissol::kernels {
     o_NonZeroFlopsYield += kernel::plAdjustStresses::NonZeroFlops;
     o_HardwareFlopsYield += kernel::plAdjustStresses::HardwareFlops;
   }
+
+  void Plasticity::flopsYieldPreCheck(long long &o_nonZeroFlops,
+                                      long long &o_hardwareFlops) {
+    // norms of the higher modes (2 per mode) and deviation bound (3) per stress component
+    o_nonZeroFlops = 6 * (2 * (NUMBER_OF_BASIS_FUNCTIONS - 1) + 5);
+    o_hardwareFlops = 6 * (2 * (NUMBER_OF_ALIGNED_BASIS_FUNCTIONS - 1) + 5);
+
+    // mean, both invariants and taulim (sqrt counted as one flop)
+    o_nonZeroFlops += 36;
+    o_hardwareFlops += 36;
+  }
 } // namespace seissol::kernels
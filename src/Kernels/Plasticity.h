@@ -55,6 +55,26 @@ namespace seissol {
 
 class seissol::kernels::Plasticity {
 public:
+  /** Bounds on the deviation of nodal stresses from the stress of the constant mode,
+   *  i.e. |s_k - c0 q_0| <= spread |q_0| + higherModes ||(q_1, ..., q_N)||_2 for every node k.
+   */
+  struct NodalBounds {
+    real constantMode;
+    real spread;
+    real higherModes;
+  };
+
+  /** Evaluates the nodal bounds once from the Vandermonde matrix.
+   */
+  static NodalBounds computeNodalBounds(GlobalData const* global);
+
+  /** Conservative yield test which does not leave the modal basis.
+   *  Returns false only if computePlasticity would not yield at any node.
+   */
+  static bool mayYield( NodalBounds const&          bounds,
+                        PlasticityData const*       plasticityData,
+                        real const                  degreesOfFreedom[tensor::Q::size()] );
+
   /** Returns 1 if there was plastic yielding otherwise 0.
    */
   static unsigned computePlasticity( double                      oneMinusIntegratingFactor,
@@ -65,6 +85,24 @@ public:
                                      real                        degreesOfFreedom[tensor::Q::size()],
                                      real*                       pstrain);
 
+  /** Plasticity of a whole layer on the CPU: mayYield is evaluated for all cells into
+   *  mayYieldFlags, the possibly yielding cells are compacted in parallel into cellIndices
+   *  (both of size numberOfCells) and computePlasticity is called on those cells only.
+   *  Returns the number of cells with plastic yielding.
+   */
+  static unsigned computePlasticityLayer( double                      oneMinusIntegratingFactor,
+                                          double                      timeStepWidth,
+                                          double                      T_v,
+                                          GlobalData const*           global,
+                                          NodalBounds const&          bounds,
+                                          unsigned                    numberOfCells,
+                                          PlasticityData const*       plasticityData,
+                                          real                     (*degreesOfFreedom)[tensor::Q::size()],
+                                          real                     (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS],
+                                          unsigned char*              mayYieldFlags,
+                                          unsigned*                   cellIndices,
+                                          unsigned&                   numberOfCandidates );
+
   static unsigned computePlasticityBatched(double relaxTime,
                                            double timeStepWidth,
                                            double T_v,
@@ -76,6 +114,9 @@ public:
                                 long long&  o_hardwareFlopsCheck,
                                 long long&  o_nonZeroFlopsYield,
                                 long long&  o_hardwareFlopsYield );
+
+  static void flopsYieldPreCheck( long long&  o_nonZeroFlops,
+                                  long long&  o_hardwareFlops );
 };
 
 #endif
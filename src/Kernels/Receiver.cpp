@@ -61,14 +61,17 @@ void seissol::kernels::ReceiverCluster::addReceiver(  unsigned
   }
   auto xiEtaZeta = seissol::transformations::tetrahedronGlobalToReference(coords[0], coords[1], coords[2], coords[3], point);
 
+  addReceiver(pointId, xiEtaZeta[0], xiEtaZeta[1], xiEtaZeta[2], kernels::LocalData::lookup(lts, ltsLut, meshId));
+}
+
+void seissol::kernels::ReceiverCluster::addReceiver(  unsigned            pointId,
+                                                      double              xi,
+                                                      double              eta,
+                                                      double              zeta,
+                                                      kernels::LocalData  data ) {
   // (time + number of quantities) * number of samples until sync point
   size_t reserved = ncols() * (m_syncPointInterval / m_samplingInterval + 1);
-  m_receivers.emplace_back( pointId,
-                            xiEtaZeta[0],
-                            xiEtaZeta[1],
-                            xiEtaZeta[2],
-                            kernels::LocalData::lookup(lts, ltsLut, meshId),
-                            reserved);
+  m_receivers.emplace_back(pointId, xi, eta, zeta, data, reserved);
 }
 
 double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
@@ -93,6 +96,7 @@ double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
       m_timeKernel.executeSTP(timeStepWidth, receiver.data, timeEvaluated, stp);
       g_SeisSolNonZeroFlopsOther += m_nonZeroFlops;
       g_SeisSolHardwareFlopsOther += m_hardwareFlops;
+      g_SeisSolBytesOther += m_bytes;
 
       receiverTime = time;
       while (receiverTime < expansionPoint + timeStepWidth) {
@@ -145,6 +149,7 @@ double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
                                 timeDerivatives );
       g_SeisSolNonZeroFlopsOther += m_nonZeroFlops;
       g_SeisSolHardwareFlopsOther += m_hardwareFlops;
+      g_SeisSolBytesOther += m_bytes;
 
       receiverTime = time;
       while (receiverTime < expansionPoint + timeStepWidth) {
@@ -71,7 +71,7 @@ namespace seissol {
     class ReceiverCluster {
     public:
       ReceiverCluster()
-        : m_nonZeroFlops(0), m_hardwareFlops(0),
+        : m_nonZeroFlops(0), m_hardwareFlops(0), m_bytes(0),
           m_samplingInterval(1.0e99), m_syncPointInterval(0.0)
       {}
 
@@ -83,6 +83,7 @@ namespace seissol {
           m_samplingInterval(samplingInterval), m_syncPointInterval(syncPointInterval) {
         m_timeKernel.setHostGlobalData(global);
         m_timeKernel.flopsAder(m_nonZeroFlops, m_hardwareFlops);
+        m_bytes = m_timeKernel.bytesAder();
       }
 
       void addReceiver( unsigned          meshId,
@@ -92,6 +93,13 @@ namespace seissol {
                         seissol::initializers::Lut const& ltsLut,
                         seissol::initializers::LTS const& lts );
 
+      //! Adds a receiver at the reference coordinates (xi, eta, zeta) of the cell given by data
+      void addReceiver( unsigned            pointId,
+                        double              xi,
+                        double              eta,
+                        double              zeta,
+                        kernels::LocalData  data );
+
       //! Returns new receiver time
       double calcReceivers( double time,
                             double expansionPoint,
@@ -119,6 +127,7 @@ namespace seissol {
       std::vector<unsigned>   m_quantities;
       unsigned                m_nonZeroFlops;
       unsigned                m_hardwareFlops;
+      unsigned                m_bytes;
       double                  m_samplingInterval;
       double                  m_syncPointInterval;
     };
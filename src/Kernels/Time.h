@@ -108,6 +108,17 @@ class seissol::kernels::Time : public TimeBase {
                             LocalTmp& tmp,
                             ConditionalBatchTableT &table);
 
+    /**
+     * Advances the displacements of contiguously stored faces with gravitational free surface
+     * boundary condition and integrates their normal displacements over the time step.
+     * The time derivatives of the faces' cells have to be up to date.
+     **/
+    void computeFreeSurfaceGravityDisplacements(double i_timeStepWidth,
+                                                const GravityFace* faces,
+                                                unsigned numberOfFaces,
+                                                real* displacements,
+                                                real* integratedDisplacements);
+
     void flopsAder( unsigned int &o_nonZeroFlops,
                     unsigned int &o_hardwareFlops );
 
@@ -53,8 +53,8 @@ void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
   /*
    * assert valid input.
    */
-  // only lower 10 bits are used for lts encoding
-  assert (i_ltsSetup < 2048 );
+  // only lower 14 bits are used for lts encoding
+  assert (i_ltsSetup < 16384 );
 
 #ifndef NDEBUG
   // alignment of the time derivatives/integrated dofs and the buffer
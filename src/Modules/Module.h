@@ -47,6 +47,7 @@
 
 #include "utils/logger.h"
 #include "Parallel/MPI.h"
+#include "Monitoring/Trace.hpp"
 
 namespace seissol
 {
@@ -105,7 +106,10 @@ public:
       int const rank = seissol::MPI::mpi.rank();
       logInfo(rank) << "Ignoring duplicate synchronisation point at time" << currentTime << "; the last sync point was at " << m_lastSyncPoint;
     } else if (forceSyncPoint || std::abs(currentTime - m_nextSyncPoint) < timeTolerance) {
-			syncPoint(currentTime);
+			{
+				seissol::monitoring::TraceScope trace("syncPoint");
+				syncPoint(currentTime);
+			}
       m_lastSyncPoint = currentTime;
 			m_nextSyncPoint += m_syncInterval;
 		}
@@ -43,6 +43,7 @@
 #include "Parallel/MPI.h"
 
 #include "FlopCounter.hpp"
+#include "Roofline.hpp"
 
 #include <utils/logger.h>
 
@@ -60,6 +61,15 @@ long long g_SeisSolNonZeroFlopsDynamicRupture = 0;
 long long g_SeisSolHardwareFlopsDynamicRupture = 0;
 long long g_SeisSolNonZeroFlopsPlasticity = 0;
 long long g_SeisSolHardwareFlopsPlasticity = 0;
+long long g_SeisSolNonZeroFlopsSource = 0;
+long long g_SeisSolHardwareFlopsSource = 0;
+
+long long g_SeisSolBytesLocal = 0;
+long long g_SeisSolBytesNeighbor = 0;
+long long g_SeisSolBytesOther = 0;
+long long g_SeisSolBytesDynamicRupture = 0;
+long long g_SeisSolBytesPlasticity = 0;
+long long g_SeisSolBytesSource = 0;
 
 void printPerformance(double wallTime) {
   const int rank = seissol::MPI::mpi.rank();
@@ -67,24 +77,54 @@ void printPerformance(double wallTime) {
                     + g_SeisSolHardwareFlopsNeighbor
                     + g_SeisSolHardwareFlopsOther
                     + g_SeisSolHardwareFlopsDynamicRupture
-                    + g_SeisSolHardwareFlopsPlasticity;
+                    + g_SeisSolHardwareFlopsPlasticity
+                    + g_SeisSolHardwareFlopsSource;
+  const long long bytes = g_SeisSolBytesLocal
+                    + g_SeisSolBytesNeighbor
+                    + g_SeisSolBytesOther
+                    + g_SeisSolBytesDynamicRupture
+                    + g_SeisSolBytesPlasticity
+                    + g_SeisSolBytesSource;
   const double gflopsPerSecond = flops * 1.e-9 / wallTime;
+  const auto& balance = seissol::monitoring::machineBalance();
 
+  enum Rate {
+    GFlops = 0,
+    GBytes,
+    StreamGBytes,
+    PeakGFlops,
+    NUM_RATES
+  };
+  double rates[NUM_RATES];
+  rates[GFlops]       = gflopsPerSecond;
+  rates[GBytes]       = bytes * 1.e-9 / wallTime;
+  rates[StreamGBytes] = balance.bandwidth * 1.e-9;
+  rates[PeakGFlops]   = balance.peakFlops * 1.e-9;
 
-  double flopsSum = 0;
-  MPI_Reduce(
-      &gflopsPerSecond,
-      &flopsSum,
-      1,
-      MPI_DOUBLE,
-      MPI_SUM,
-      0,
-      seissol::MPI::mpi.comm()
-  );
+#ifdef USE_MPI
+  double totalRates[NUM_RATES];
+  MPI_Reduce(rates, totalRates, NUM_RATES, MPI_DOUBLE, MPI_SUM, 0, seissol::MPI::mpi.comm());
+#else
+  double* totalRates = &rates[0];
+#endif
   if (rank == 0) {
+    const double flopsSum = totalRates[GFlops];
     const auto flopsPerRank = flopsSum / seissol::MPI::mpi.size();
     logInfo(rank) << flopsSum * 1.e-3  << "TFLOPS"
     << "(rank 0:" << gflopsPerSecond << "GFLOPS, average over ranks:" << flopsPerRank << "GFLOPS)";
+
+    const double intensity = (bytes > 0) ? static_cast<double>(flops) / bytes : 0.0;
+    if (totalRates[StreamGBytes] > 0.0) {
+      logInfo(rank) << totalRates[GBytes] << "GB/s modeled memory traffic,"
+      << 100.0 * totalRates[GBytes] / totalRates[StreamGBytes] << "% of STREAM bandwidth,"
+      << "rank 0 arithmetic intensity:" << intensity << "FLOP/byte";
+    } else {
+      logInfo(rank) << totalRates[GBytes] << "GB/s modeled memory traffic,"
+      << "rank 0 arithmetic intensity:" << intensity << "FLOP/byte";
+    }
+    if (totalRates[PeakGFlops] > 0.0) {
+      logInfo(rank) << 100.0 * flopsSum / totalRates[PeakGFlops] << "% of peak FLOPS";
+    }
   }
 }
   
@@ -102,6 +142,8 @@ void printFlops() {
     DRHardwareFlops,
     PLNonZeroFlops,
     PLHardwareFlops,
+    SRNonZeroFlops,
+    SRHardwareFlops,
     NUM_COUNTERS
   };
 
@@ -114,6 +156,8 @@ void printFlops() {
   flops[DRHardwareFlops]  = g_SeisSolHardwareFlopsDynamicRupture;
   flops[PLNonZeroFlops]   = g_SeisSolNonZeroFlopsPlasticity;
   flops[PLHardwareFlops]  = g_SeisSolHardwareFlopsPlasticity;
+  flops[SRNonZeroFlops]   = g_SeisSolNonZeroFlopsSource;
+  flops[SRHardwareFlops]  = g_SeisSolHardwareFlopsSource;
 
 #ifdef USE_MPI
   double totalFlops[NUM_COUNTERS];
@@ -123,12 +167,14 @@ void printFlops() {
 #endif
 
   logInfo(rank) << "Total   measured HW-GFLOP: " << totalFlops[Libxsmm] * 1.e-9;
-  logInfo(rank) << "Total calculated HW-GFLOP: " << (totalFlops[WPHardwareFlops] + totalFlops[DRHardwareFlops] + totalFlops[PLHardwareFlops]) * 1.e-9;
-  logInfo(rank) << "Total calculated NZ-GFLOP: " << (totalFlops[WPNonZeroFlops]  + totalFlops[DRNonZeroFlops]  + totalFlops[PLNonZeroFlops] ) * 1.e-9;
+  logInfo(rank) << "Total calculated HW-GFLOP: " << (totalFlops[WPHardwareFlops] + totalFlops[DRHardwareFlops] + totalFlops[PLHardwareFlops] + totalFlops[SRHardwareFlops]) * 1.e-9;
+  logInfo(rank) << "Total calculated NZ-GFLOP: " << (totalFlops[WPNonZeroFlops]  + totalFlops[DRNonZeroFlops]  + totalFlops[PLNonZeroFlops]  + totalFlops[SRNonZeroFlops] ) * 1.e-9;
   logInfo(rank) << "WP calculated HW-GFLOP: " << (totalFlops[WPHardwareFlops]) * 1.e-9;
   logInfo(rank) << "WP calculated NZ-GFLOP: " << (totalFlops[WPNonZeroFlops])  * 1.e-9;
   logInfo(rank) << "DR calculated HW-GFLOP: " << (totalFlops[DRHardwareFlops]) * 1.e-9;
   logInfo(rank) << "DR calculated NZ-GFLOP: " << (totalFlops[DRNonZeroFlops])  * 1.e-9;
   logInfo(rank) << "PL calculated HW-GFLOP: " << (totalFlops[PLHardwareFlops]) * 1.e-9;
   logInfo(rank) << "PL calculated NZ-GFLOP: " << (totalFlops[PLNonZeroFlops])  * 1.e-9;
+  logInfo(rank) << "SR calculated HW-GFLOP: " << (totalFlops[SRHardwareFlops]) * 1.e-9;
+  logInfo(rank) << "SR calculated NZ-GFLOP: " << (totalFlops[SRNonZeroFlops])  * 1.e-9;
 }
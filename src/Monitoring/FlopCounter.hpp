@@ -57,6 +57,16 @@ extern long long g_SeisSolNonZeroFlopsDynamicRupture;
 extern long long g_SeisSolHardwareFlopsDynamicRupture;
 extern long long g_SeisSolNonZeroFlopsPlasticity;
 extern long long g_SeisSolHardwareFlopsPlasticity;
+extern long long g_SeisSolNonZeroFlopsSource;
+extern long long g_SeisSolHardwareFlopsSource;
+
+// modeled memory traffic in bytes, accounted next to the flops of the same region
+extern long long g_SeisSolBytesLocal;
+extern long long g_SeisSolBytesNeighbor;
+extern long long g_SeisSolBytesOther;
+extern long long g_SeisSolBytesDynamicRupture;
+extern long long g_SeisSolBytesPlasticity;
+extern long long g_SeisSolBytesSource;
 
 void printPerformance(double wallTime);
 void printFlops();
@@ -0,0 +1,269 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Periodic export of MPI-reduced runtime metrics in the Prometheus text format.
+ **/
+
+#include "Metrics.hpp"
+
+#include "Modules/Modules.h"
+#include "Parallel/MPI.h"
+#include "SeisSol.h"
+
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace {
+//! resident set size of this process in bytes
+double residentSetSize() {
+  long pages = 0;
+  std::ifstream statm("/proc/self/statm");
+  long size = 0;
+  if (statm >> size >> pages) {
+    return static_cast<double>(pages) * sysconf(_SC_PAGESIZE);
+  }
+  return 0.0;
+}
+
+//! peak resident set size of this process in bytes
+double peakResidentSetSize() {
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    // kilobytes on Linux
+    return static_cast<double>(usage.ru_maxrss) * 1024.0;
+  }
+  return 0.0;
+}
+
+void describe(std::ostream& out, char const* name, char const* type, char const* help) {
+  out << "# HELP " << name << " " << help << "\n# TYPE " << name << " " << type << "\n";
+}
+} // namespace
+
+seissol::monitoring::MetricsExporter::~MetricsExporter() {
+  if (m_refreshThread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_stopCondition.notify_all();
+    m_refreshThread.join();
+  }
+}
+
+void seissol::monitoring::MetricsExporter::init() {
+  m_fileName = utils::Env::get<const char*>("SEISSOL_METRICS_FILE", "");
+  m_enabled = !m_fileName.empty();
+  if (!m_enabled) {
+    return;
+  }
+
+  const double interval = utils::Env::get<double>("SEISSOL_METRICS_INTERVAL", 1.0);
+  m_refreshInterval = utils::Env::get<double>("SEISSOL_METRICS_REFRESH", 10.0);
+  if (interval <= 0.0) {
+    logError() << "SEISSOL_METRICS_INTERVAL must be positive.";
+  }
+
+  logInfo(seissol::MPI::mpi.rank()) << "Exporting metrics to" << m_fileName << "every" << interval
+                                    << "simulated seconds.";
+
+  setSyncInterval(interval);
+  // after the writers, such that their time is accounted in this synchronization point
+  Modules::registerHook(*this, SYNCHRONIZATION_POINT, LOWEST);
+}
+
+void seissol::monitoring::MetricsExporter::start(double simulationTime) {
+  if (!m_enabled) {
+    return;
+  }
+
+  auto& timeManager = seissol::SeisSol::main.timeManager();
+  m_start = std::chrono::steady_clock::now();
+  m_lastWallTime = 0.0;
+  m_lastSimulationTime = simulationTime;
+  m_lastWaitTime = timeManager.getWaitTime();
+  m_lastCellUpdates = timeManager.getCellUpdates();
+  setSimulationTime(simulationTime);
+
+  if (seissol::MPI::mpi.rank() == 0 && m_refreshInterval > 0.0) {
+    m_refreshThread = std::thread(&MetricsExporter::refreshLoop, this);
+  }
+}
+
+void seissol::monitoring::MetricsExporter::stop() {
+  if (!m_enabled || seissol::MPI::mpi.rank() != 0) {
+    return;
+  }
+
+  if (m_refreshThread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_stopCondition.notify_all();
+    m_refreshThread.join();
+  }
+  write();
+}
+
+void seissol::monitoring::MetricsExporter::syncPoint(double currentTime) {
+  const int rank = seissol::MPI::mpi.rank();
+  auto& timeManager = seissol::SeisSol::main.timeManager();
+
+  const double now = wallTime();
+  const double elapsed = std::max(now - m_lastWallTime, std::numeric_limits<double>::min());
+  const double waitTime = timeManager.getWaitTime();
+  const double waitFraction = (waitTime - m_lastWaitTime) / elapsed;
+  const auto cellUpdates = timeManager.getCellUpdates();
+  const auto numberOfClusters = cellUpdates.size();
+
+  // per cluster: updates since the last synchronization point and in total, then the rank values
+  std::vector<double> sums(2 * numberOfClusters + 3);
+  for (std::size_t cluster = 0; cluster < numberOfClusters; ++cluster) {
+    sums[cluster] = cellUpdates[cluster] - m_lastCellUpdates[cluster];
+    sums[numberOfClusters + cluster] = cellUpdates[cluster];
+  }
+  const double rss = residentSetSize();
+  sums[2 * numberOfClusters] = waitFraction;
+  sums[2 * numberOfClusters + 1] = rss;
+  sums[2 * numberOfClusters + 2] = m_syncTime;
+  std::vector<double> maxima{waitFraction, rss, peakResidentSetSize(), m_syncTime};
+
+#ifdef USE_MPI
+  std::vector<double> totalSums(sums.size());
+  std::vector<double> totalMaxima(maxima.size());
+  MPI_Reduce(sums.data(), totalSums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, 0, seissol::MPI::mpi.comm());
+  MPI_Reduce(maxima.data(), totalMaxima.data(), maxima.size(), MPI_DOUBLE, MPI_MAX, 0, seissol::MPI::mpi.comm());
+  sums.swap(totalSums);
+  maxima.swap(totalMaxima);
+#endif
+
+  const double simulatedTimeRate = (currentTime - m_lastSimulationTime) / elapsed;
+  m_lastWallTime = now;
+  m_lastSimulationTime = currentTime;
+  m_lastWaitTime = waitTime;
+  m_lastCellUpdates = cellUpdates;
+
+  if (rank != 0) {
+    return;
+  }
+
+  const int ranks = seissol::MPI::mpi.size();
+  std::ostringstream out;
+  describe(out, "seissol_ranks", "gauge", "Number of compute ranks.");
+  out << "seissol_ranks " << ranks << "\n";
+  describe(out, "seissol_simulated_time_seconds", "gauge", "Simulated time at the last synchronization point.");
+  out << "seissol_simulated_time_seconds " << currentTime << "\n";
+  describe(out, "seissol_simulated_time_rate", "gauge", "Simulated seconds per wall-clock second since the previous synchronization point.");
+  out << "seissol_simulated_time_rate " << simulatedTimeRate << "\n";
+  describe(out, "seissol_cluster_cell_updates_per_second", "gauge", "Cell updates per wall-clock second of a time cluster, summed over all ranks.");
+  for (std::size_t cluster = 0; cluster < numberOfClusters; ++cluster) {
+    out << "seissol_cluster_cell_updates_per_second{cluster=\"" << cluster << "\"} " << sums[cluster] / elapsed << "\n";
+  }
+  describe(out, "seissol_cluster_cell_updates_total", "counter", "Cell updates of a time cluster, summed over all ranks.");
+  for (std::size_t cluster = 0; cluster < numberOfClusters; ++cluster) {
+    out << "seissol_cluster_cell_updates_total{cluster=\"" << cluster << "\"} " << sums[numberOfClusters + cluster] << "\n";
+  }
+  describe(out, "seissol_mpi_wait_fraction", "gauge", "Fraction of the wall time in which no cluster could progress, e.g. waiting for MPI.");
+  out << "seissol_mpi_wait_fraction{stat=\"mean\"} " << sums[2 * numberOfClusters] / ranks << "\n";
+  out << "seissol_mpi_wait_fraction{stat=\"max\"} " << maxima[0] << "\n";
+  describe(out, "seissol_memory_rss_bytes", "gauge", "Resident set size of the ranks.");
+  out << "seissol_memory_rss_bytes{stat=\"sum\"} " << sums[2 * numberOfClusters + 1] << "\n";
+  out << "seissol_memory_rss_bytes{stat=\"max\"} " << maxima[1] << "\n";
+  describe(out, "seissol_memory_peak_rss_bytes", "gauge", "Peak resident set size of the ranks.");
+  out << "seissol_memory_peak_rss_bytes{stat=\"max\"} " << maxima[2] << "\n";
+  describe(out, "seissol_sync_seconds_total", "counter", "Wall time in synchronization points and checkpoints, including waiting for asynchronous output.");
+  out << "seissol_sync_seconds_total{stat=\"mean\"} " << sums[2 * numberOfClusters + 2] / ranks << "\n";
+  out << "seissol_sync_seconds_total{stat=\"max\"} " << maxima[3] << "\n";
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_snapshot = out.str();
+    m_snapshotWallTime = now;
+  }
+  write();
+}
+
+void seissol::monitoring::MetricsExporter::write() {
+  // both threads use the same temporary file, only one of them may write and rename it at a time
+  std::lock_guard<std::mutex> writeLock(m_writeMutex);
+
+  std::string snapshot;
+  double snapshotWallTime = 0.0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    snapshot = m_snapshot;
+    snapshotWallTime = m_snapshotWallTime;
+  }
+  const double now = wallTime();
+
+  // write to a temporary file and rename it, such that readers never see a partial snapshot
+  const std::string temporaryName = m_fileName + ".tmp";
+  {
+    std::ofstream out(temporaryName);
+    if (!out) {
+      logWarning() << "Could not write metrics to" << temporaryName;
+      return;
+    }
+    out << snapshot;
+    describe(out, "seissol_wall_time_seconds", "gauge", "Wall time since the start of the simulation.");
+    out << "seissol_wall_time_seconds " << now << "\n";
+    describe(out, "seissol_seconds_since_sync", "gauge", "Wall time since the last synchronization point of the metrics.");
+    out << "seissol_seconds_since_sync " << now - snapshotWallTime << "\n";
+    describe(out, "seissol_live_simulated_time_seconds", "gauge", "Simulated time of the fastest cluster of rank 0.");
+    out << "seissol_live_simulated_time_seconds " << m_liveSimulationTime.load(std::memory_order_relaxed) << "\n";
+  }
+  if (std::rename(temporaryName.c_str(), m_fileName.c_str()) != 0) {
+    logWarning() << "Could not rename" << temporaryName << "to" << m_fileName;
+  }
+}
+
+void seissol::monitoring::MetricsExporter::refreshLoop() {
+  const auto interval = std::chrono::duration<double>(m_refreshInterval);
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stopCondition.wait_for(lock, interval, [this]() { return m_stop; })) {
+    lock.unlock();
+    write();
+    lock.lock();
+  }
+}
@@ -0,0 +1,131 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Periodic export of MPI-reduced runtime metrics in the Prometheus text format.
+ **/
+
+#ifndef MONITORING_METRICS_HPP_
+#define MONITORING_METRICS_HPP_
+
+#include "Modules/Module.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace seissol::monitoring {
+/**
+ * Reduces progress, per-cluster update rates, the time spent waiting for communication
+ * and in synchronization points, and the memory use of all ranks at its own
+ * synchronization points. Rank 0 writes the snapshot to a file, which a thread refreshes
+ * with the wall time and the simulated time of rank 0 in between.
+ **/
+class MetricsExporter : public Module {
+public:
+  MetricsExporter() = default;
+  ~MetricsExporter();
+
+  MetricsExporter(MetricsExporter const&) = delete;
+  MetricsExporter& operator=(MetricsExporter const&) = delete;
+
+  /**
+   * Reads the configuration and registers the synchronization point hook.
+   **/
+  void init();
+
+  //! Starts the wall clock and the refresh thread at the beginning of the simulation
+  void start(double simulationTime);
+
+  //! Stops the refresh thread and writes the final snapshot
+  void stop();
+
+  bool isEnabled() const {
+    return m_enabled;
+  }
+
+  //! Live simulated time of this rank
+  void setSimulationTime(double time) {
+    m_liveSimulationTime.store(time, std::memory_order_relaxed);
+  }
+
+  //! Accounts wall time spent in synchronization points and checkpoints
+  void addSyncTime(double seconds) {
+    m_syncTime += seconds;
+  }
+
+  void syncPoint(double currentTime) override;
+
+private:
+  double wallTime() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+  //! Writes the last snapshot and the live values on rank 0; called by the main and the refresh thread
+  void write();
+
+  void refreshLoop();
+
+  bool m_enabled = false;
+  std::string m_fileName;
+  double m_refreshInterval = 0.0;
+
+  std::chrono::steady_clock::time_point m_start{};
+  std::atomic<double> m_liveSimulationTime{0.0};
+  double m_syncTime = 0.0;
+
+  //! local values at the last synchronization point
+  double m_lastWallTime = 0.0;
+  double m_lastSimulationTime = 0.0;
+  double m_lastWaitTime = 0.0;
+  std::vector<double> m_lastCellUpdates;
+
+  //! reduced metrics of the last synchronization point, only on rank 0
+  std::mutex m_mutex;
+  std::string m_snapshot;
+  double m_snapshotWallTime = 0.0;
+
+  //! serializes writing and renaming the file between the main and the refresh thread
+  std::mutex m_writeMutex;
+
+  std::thread m_refreshThread;
+  std::condition_variable m_stopCondition;
+  bool m_stop = false;
+};
+} // namespace seissol::monitoring
+
+#endif
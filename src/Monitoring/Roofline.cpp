@@ -0,0 +1,217 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Machine balance of a rank and the position of the solver on the roofline.
+ **/
+
+#include "Roofline.hpp"
+#include "FlopCounter.hpp"
+#include "Stopwatch.h"
+
+#include <Numerical_aux/Statistics.h>
+#include <Parallel/MPI.h>
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+namespace {
+seissol::monitoring::MachineBalance balance;
+
+//! the first repetition only warms up
+constexpr unsigned ProbeRepetitions = 5;
+} // namespace
+
+auto seissol::monitoring::machineBalance() -> MachineBalance const& {
+  return balance;
+}
+
+void seissol::monitoring::measureMachineBalance() {
+  const int rank = seissol::MPI::mpi.rank();
+  balance.peakFlops = utils::Env::get<double>("SEISSOL_PEAK_GFLOPS", 0.0) * 1.e9;
+
+#ifdef ACL_DEVICE
+  // the bandwidth of the host does not bound the kernels on the device
+  return;
+#endif
+
+  // number of doubles per array, should exceed the last level cache of a rank by far
+  const auto size = utils::Env::get<std::size_t>("SEISSOL_STREAM_PROBE_SIZE", std::size_t(1) << 23);
+  if (size == 0) {
+    return;
+  }
+
+  // not value-initialized; the pages are first touched by the worker threads
+  std::unique_ptr<double[]> aStorage(new double[size]);
+  std::unique_ptr<double[]> bStorage(new double[size]);
+  std::unique_ptr<double[]> cStorage(new double[size]);
+  double* a = aStorage.get();
+  double* b = bStorage.get();
+  double* c = cStorage.get();
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t i = 0; i < size; ++i) {
+    a[i] = 1.0;
+    b[i] = 2.0;
+    c[i] = 0.0;
+  }
+
+  double bestTime = std::numeric_limits<double>::max();
+  for (unsigned repetition = 0; repetition < ProbeRepetitions; ++repetition) {
+#ifdef USE_MPI
+    MPI_Barrier(seissol::MPI::mpi.comm());
+#endif
+    Stopwatch stopwatch;
+    stopwatch.start();
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (std::size_t i = 0; i < size; ++i) {
+      c[i] = a[i] + 3.0 * b[i];
+    }
+    const double time = stopwatch.split();
+    if (repetition > 0) {
+      bestTime = std::min(bestTime, time);
+    }
+  }
+  // all ranks have to agree before the collective summary below
+  int valid = (c[size - 1] == 7.0) ? 1 : 0;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &valid, 1, MPI_INT, MPI_MIN, seissol::MPI::mpi.comm());
+#endif
+  if (valid == 0) {
+    logWarning(rank) << "STREAM probe returned a wrong result on at least one rank, ignoring the measured bandwidth.";
+    return;
+  }
+  balance.bandwidth = 3.0 * sizeof(double) * size / bestTime;
+
+  const auto summary = seissol::statistics::parallelSummary(balance.bandwidth * 1.e-9);
+  logInfo(rank) << "STREAM triad bandwidth per rank in GB/s (min / avg / max):"
+                << summary.min << "/" << summary.mean << "/" << summary.max;
+  if (balance.peakFlops > 0.0) {
+    logInfo(rank) << "Machine balance of rank 0:" << balance.peakFlops / balance.bandwidth << "FLOP/byte";
+  }
+}
+
+void seissol::monitoring::printRoofline(double wallTime) {
+  const int rank = seissol::MPI::mpi.rank();
+
+  enum Region {
+    Local = 0,
+    Neighbor,
+    DynamicRupture,
+    Plasticity,
+    Source,
+    Receiver,
+    NUM_REGIONS
+  };
+  const char* regionNames[NUM_REGIONS] = {"Local", "Neighbor", "Dynamic rupture", "Plasticity", "Sources", "Receivers"};
+
+  // hardware flops and bytes per region, followed by the machine balance
+  enum Counter {
+    StreamBandwidth = 2 * NUM_REGIONS,
+    PeakFlops,
+    NUM_COUNTERS
+  };
+  double counters[NUM_COUNTERS];
+  counters[2 * Local]              = g_SeisSolHardwareFlopsLocal;
+  counters[2 * Local + 1]          = g_SeisSolBytesLocal;
+  counters[2 * Neighbor]           = g_SeisSolHardwareFlopsNeighbor;
+  counters[2 * Neighbor + 1]       = g_SeisSolBytesNeighbor;
+  counters[2 * DynamicRupture]     = g_SeisSolHardwareFlopsDynamicRupture;
+  counters[2 * DynamicRupture + 1] = g_SeisSolBytesDynamicRupture;
+  counters[2 * Plasticity]         = g_SeisSolHardwareFlopsPlasticity;
+  counters[2 * Plasticity + 1]     = g_SeisSolBytesPlasticity;
+  counters[2 * Source]             = g_SeisSolHardwareFlopsSource;
+  counters[2 * Source + 1]         = g_SeisSolBytesSource;
+  counters[2 * Receiver]           = g_SeisSolHardwareFlopsOther;
+  counters[2 * Receiver + 1]       = g_SeisSolBytesOther;
+  counters[StreamBandwidth]        = balance.bandwidth;
+  counters[PeakFlops]              = balance.peakFlops;
+
+#ifdef USE_MPI
+  double totalCounters[NUM_COUNTERS];
+  MPI_Reduce(counters, totalCounters, NUM_COUNTERS, MPI_DOUBLE, MPI_SUM, 0, seissol::MPI::mpi.comm());
+#else
+  double* totalCounters = &counters[0];
+#endif
+
+  if (rank != 0) {
+    return;
+  }
+
+  double flops = 0.0;
+  double bytes = 0.0;
+  logInfo(rank) << "Modeled HW-GFLOP, GB and arithmetic intensity per region:";
+  for (unsigned region = 0; region < NUM_REGIONS; ++region) {
+    const double regionFlops = totalCounters[2 * region];
+    const double regionBytes = totalCounters[2 * region + 1];
+    flops += regionFlops;
+    bytes += regionBytes;
+    if (regionBytes > 0.0) {
+      logInfo(rank) << " " << regionNames[region] << ":" << regionFlops * 1.e-9 << "HW-GFLOP,"
+                    << regionBytes * 1.e-9 << "GB," << regionFlops / regionBytes << "FLOP/byte";
+    }
+  }
+  if (bytes <= 0.0 || wallTime <= 0.0) {
+    return;
+  }
+
+  const double intensity = flops / bytes;
+  const double flopsPerSecond = flops / wallTime;
+  const double bytesPerSecond = bytes / wallTime;
+  logInfo(rank) << "Achieved" << flopsPerSecond * 1.e-9 << "GFLOPS and" << bytesPerSecond * 1.e-9
+                << "GB/s at" << intensity << "FLOP/byte";
+
+  const double bandwidth = totalCounters[StreamBandwidth];
+  const double peakFlops = totalCounters[PeakFlops];
+  if (bandwidth > 0.0) {
+    logInfo(rank) << "Fraction of the STREAM bandwidth:" << 100.0 * bytesPerSecond / bandwidth << "%";
+  }
+  if (peakFlops > 0.0) {
+    logInfo(rank) << "Fraction of the peak performance:" << 100.0 * flopsPerSecond / peakFlops << "%";
+  }
+  if (bandwidth > 0.0 && peakFlops > 0.0) {
+    const double ridge = peakFlops / bandwidth;
+    const double attainable = std::min(peakFlops, intensity * bandwidth);
+    logInfo(rank) << (intensity < ridge ? "Bandwidth-bound" : "Compute-bound")
+                  << "(machine balance:" << ridge << "FLOP/byte),"
+                  << 100.0 * flopsPerSecond / attainable << "% of the attainable performance";
+  }
+}
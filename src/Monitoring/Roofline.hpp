@@ -0,0 +1,65 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Machine balance of a rank and the position of the solver on the roofline.
+ **/
+
+#ifndef MONITORING_ROOFLINE_HPP_
+#define MONITORING_ROOFLINE_HPP_
+
+namespace seissol::monitoring {
+struct MachineBalance {
+  //! sustained memory bandwidth of the rank in bytes per second (STREAM triad), 0 if unknown
+  double bandwidth = 0.0;
+  //! peak floating point performance of the rank in FLOP per second, 0 if unknown
+  double peakFlops = 0.0;
+};
+
+auto machineBalance() -> MachineBalance const&;
+
+/**
+ * Measures the memory bandwidth with a short STREAM triad run by all ranks at once,
+ * i.e., every rank gets its share of the bandwidth of the node. The peak performance
+ * is taken from SEISSOL_PEAK_GFLOPS.
+ **/
+void measureMachineBalance();
+
+/**
+ * Prints the modeled bytes and the arithmetic intensity per region and classifies the
+ * run as bandwidth- or compute-bound.
+ **/
+void printRoofline(double wallTime);
+} // namespace seissol::monitoring
+
+#endif
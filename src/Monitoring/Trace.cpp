@@ -0,0 +1,175 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Low-overhead timeline tracing of the time stepping, written in the Chrome trace format.
+ **/
+
+#include "Trace.hpp"
+
+#include <Parallel/MPI.h>
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+struct ThreadBuffer {
+  unsigned id;
+  std::string name;
+  std::vector<seissol::monitoring::Trace::Event> events;
+  //! total number of recorded events, the buffer keeps the last events.size() ones
+  std::uint64_t count = 0;
+};
+
+std::mutex buffersMutex;
+std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+std::size_t bufferSize = 0;
+
+ThreadBuffer* registerThread() {
+  std::lock_guard<std::mutex> lock(buffersMutex);
+  auto buffer = std::make_unique<ThreadBuffer>();
+  buffer->id = buffers.size();
+  buffer->name = "thread " + std::to_string(buffer->id);
+  buffer->events.resize(bufferSize);
+  buffers.push_back(std::move(buffer));
+  return buffers.back().get();
+}
+
+ThreadBuffer& threadBuffer() {
+  // registration happens once per thread; recording itself is lock-free
+  thread_local ThreadBuffer* buffer = registerThread();
+  return *buffer;
+}
+
+void writeMicroseconds(std::ostream& out, std::int64_t nanoseconds) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f", nanoseconds * 1.e-3);
+  out << buffer;
+}
+} // namespace
+
+void seissol::monitoring::Trace::initialize() {
+  s_enabled = utils::Env::get<int>("SEISSOL_TRACE", 0) != 0;
+  if (!s_enabled) {
+    return;
+  }
+
+  s_windowStart = utils::Env::get<double>("SEISSOL_TRACE_START", 0.0);
+  s_windowEnd = utils::Env::get<double>("SEISSOL_TRACE_END", std::numeric_limits<double>::infinity());
+  bufferSize = utils::Env::get<std::size_t>("SEISSOL_TRACE_BUFFER_SIZE", std::size_t(1) << 16);
+  if (bufferSize == 0) {
+    logError() << "SEISSOL_TRACE_BUFFER_SIZE must be positive.";
+  }
+
+  logInfo(seissol::MPI::mpi.rank()) << "Tracing the simulation time window [" << s_windowStart << ","
+                                    << s_windowEnd << ") with" << bufferSize << "events per thread.";
+
+  // align the time origins of the ranks approximately
+#ifdef USE_MPI
+  MPI_Barrier(seissol::MPI::mpi.comm());
+#endif
+  s_origin = std::chrono::steady_clock::now();
+
+  setThreadName("main");
+  setSimulationTime(0.0);
+}
+
+void seissol::monitoring::Trace::record(char const* name, std::int64_t begin, std::int64_t end, int cluster) {
+  auto& buffer = threadBuffer();
+  buffer.events[buffer.count % buffer.events.size()] = Event{name, begin, end, cluster};
+  ++buffer.count;
+}
+
+void seissol::monitoring::Trace::setThreadName(char const* name) {
+  if (s_enabled) {
+    threadBuffer().name = name;
+  }
+}
+
+void seissol::monitoring::Trace::write() {
+  if (!s_enabled) {
+    return;
+  }
+  s_active.store(false, std::memory_order_relaxed);
+
+  const int rank = seissol::MPI::mpi.rank();
+  const std::string fileName = std::string(utils::Env::get<const char*>("SEISSOL_TRACE_PREFIX", "trace"))
+                               + "-" + std::to_string(rank) + ".json";
+  std::ofstream out(fileName);
+  if (!out) {
+    logWarning(rank) << "Could not open" << fileName << "for writing the trace.";
+    return;
+  }
+
+  std::uint64_t dropped = 0;
+  bool first = true;
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+  std::lock_guard<std::mutex> lock(buffersMutex);
+  for (auto const& buffer : buffers) {
+    out << (first ? "\n" : ",\n");
+    first = false;
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":" << buffer->id
+        << ",\"args\":{\"name\":\"" << buffer->name << "\"}}";
+
+    const std::uint64_t size = buffer->events.size();
+    const std::uint64_t begin = buffer->count > size ? buffer->count - size : 0;
+    dropped += begin;
+    for (std::uint64_t i = begin; i < buffer->count; ++i) {
+      auto const& event = buffer->events[i % size];
+      out << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"seissol\",\"ph\":\"X\",\"ts\":";
+      writeMicroseconds(out, event.begin);
+      out << ",\"dur\":";
+      writeMicroseconds(out, event.end - event.begin);
+      out << ",\"pid\":" << rank << ",\"tid\":" << buffer->id;
+      if (event.cluster >= 0) {
+        out << ",\"args\":{\"cluster\":" << event.cluster << "}";
+      }
+      out << "}";
+    }
+  }
+  out << "\n]}\n";
+
+  if (dropped > 0) {
+    logWarning(rank) << "The trace buffers overflowed; the" << dropped
+                     << "oldest events were dropped. Increase SEISSOL_TRACE_BUFFER_SIZE.";
+  }
+  logInfo(rank) << "Wrote trace to" << fileName;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Low-overhead timeline tracing of the time stepping, written in the Chrome trace format.
+ **/
+
+#ifndef MONITORING_TRACE_HPP_
+#define MONITORING_TRACE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace seissol::monitoring {
+/**
+ * Events are recorded into a ring buffer per thread, such that recording needs neither locks
+ * nor atomics apart from the check whether tracing is active. Tracing is active while the
+ * simulation time of the fastest cluster is in the window given by SEISSOL_TRACE_START and
+ * SEISSOL_TRACE_END. Event names have to be string literals.
+ **/
+class Trace {
+public:
+  struct Event {
+    char const* name;
+    std::int64_t begin;
+    std::int64_t end;
+    int cluster;
+  };
+
+  /**
+   * Reads the configuration and sets the time origin of this rank. Collective.
+   **/
+  static void initialize();
+
+  static bool active() {
+    return s_active.load(std::memory_order_relaxed);
+  }
+
+  //! Activates or deactivates tracing depending on the simulation time
+  static void setSimulationTime(double time) {
+    if (s_enabled) {
+      s_active.store(time >= s_windowStart && time < s_windowEnd, std::memory_order_relaxed);
+    }
+  }
+
+  //! Nanoseconds since the time origin
+  static std::int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_origin).count();
+  }
+
+  static void record(char const* name, std::int64_t begin, std::int64_t end, int cluster = -1);
+
+  //! Names the calling thread in the trace
+  static void setThreadName(char const* name);
+
+  /**
+   * Writes the events of all threads to <SEISSOL_TRACE_PREFIX>-<rank>.json. Must not be
+   * called while other threads record events.
+   **/
+  static void write();
+
+private:
+  static inline bool s_enabled = false;
+  static inline std::atomic<bool> s_active{false};
+  static inline double s_windowStart = 0.0;
+  static inline double s_windowEnd = 0.0;
+  static inline std::chrono::steady_clock::time_point s_origin{};
+};
+
+/**
+ * Records the lifetime of the scope as an event if tracing was active at its start.
+ **/
+class TraceScope {
+public:
+  explicit TraceScope(char const* name, int cluster = -1)
+    : m_name(name), m_cluster(cluster), m_begin(Trace::active() ? Trace::now() : -1) {}
+
+  ~TraceScope() {
+    if (m_begin >= 0) {
+      Trace::record(m_name, m_begin, Trace::now(), m_cluster);
+    }
+  }
+
+  TraceScope(TraceScope const&) = delete;
+  TraceScope& operator=(TraceScope const&) = delete;
+
+private:
+  char const* m_name;
+  int m_cluster;
+  std::int64_t m_begin;
+};
+} // namespace seissol::monitoring
+
+#endif
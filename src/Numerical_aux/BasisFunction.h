@@ -145,6 +145,21 @@ public:
         return std::inner_product(m_data.begin(), m_data.end(), coeffIter, static_cast<T>(0));
     }
 
+    /**
+     * Same as above for coefficients which are stride elements apart,
+     * e.g. those of one of several fused simulations.
+     * @param coeffs pointer to the first coefficient
+     * @param stride distance between two consecutive coefficients
+     */
+    template<class U>
+    T evalWithCoeffs(const U* coeffs, unsigned int stride) const
+    {
+        T result = static_cast<T>(0);
+        for (unsigned int i = 0; i < m_data.size(); i++)
+            result += m_data[i] * coeffs[i*stride];
+        return result;
+    }
+
     /**
      * Returns the amount of Basis functions this class represents.
      */
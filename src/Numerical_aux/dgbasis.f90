@@ -300,6 +300,7 @@ contains
     real        :: J
     real        :: prod(MESH%LocalElemType(iElem))
     real        :: vecP(3), x0(3)
+    real        :: a(3), b(3), normal(3)
     logical     :: inside
     !-------------------------------------------------------------------------!
     intent(IN)  :: xP, yP, zP, iElem, epsilon, MESH
@@ -373,7 +374,16 @@ contains
             vecP(1) = xP - MESH%VRTX%xyNode(1,MESH%ELEM%Vertex(VertexSide(iSide,1),iElem)) 
             vecP(2) = yP - MESH%VRTX%xyNode(2,MESH%ELEM%Vertex(VertexSide(iSide,1),iElem)) 
             vecP(3) = zP - MESH%VRTX%xyNode(3,MESH%ELEM%Vertex(VertexSide(iSide,1),iElem)) 
-            prod(iSide) = dot_product( vecP, DISC%Galerkin%geoNormals(:,iSide,iElem) )
+            ! Side normal, computed as in BuildSpecialDGGeometry3D_new
+            a(:) = MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide(iSide,4),iElem)) - &
+                   MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide(iSide,3),iElem))
+            b(:) = MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide(iSide,2),iElem)) - &
+                   MESH%VRTX%xyNode(:,MESH%ELEM%Vertex(VertexSide(iSide,3),iElem))
+            normal(1) = a(2)*b(3) - a(3)*b(2)
+            normal(2) = a(3)*b(1) - a(1)*b(3)
+            normal(3) = a(1)*b(2) - a(2)*b(1)
+            normal(:) = normal(:) / sqrt(sum(normal(:)**2))
+            prod(iSide) = dot_product( vecP, normal )
             if(prod(iSide).gt.epsilon) then
                 inside = .false. 
             else
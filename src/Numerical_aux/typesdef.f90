@@ -196,6 +196,7 @@ MODULE TypesDef
      REAL, POINTER                          :: geoNormals(:,:)                  !< Side normal vectors
      REAL, POINTER                          :: geoTangent1(:,:)                 !< Vector 1 in the side plane
      REAL, POINTER                          :: geoTangent2(:,:)                 !< Vector 2 in the side plane
+     REAL, POINTER                          :: geoSurfaces(:)                   !< Area of the fault sides
 
      REAL(KIND=8), allocatable, dimension( :, :, : )    :: forwardRotation  !< forward rotation matrix from xyz- to face-normal-space
      REAL(KIND=8), allocatable, dimension( :, :, : )    :: backwardRotation !< backward rotation matrix from face-normal-space to x-y-z space
@@ -375,12 +376,6 @@ MODULE TypesDef
     INTEGER           :: nTimeGP                     !< Nr of time Gausspoints
     LOGICAL           :: init = .FALSE.              !< Initialization status
     LOGICAL           :: linearLW                    !< Use linear LW procedure ?
-    !< DG main array which stores the degrees of freedom
-    ! Interoperability with C needs continuous arrays in memory.
-    !   Reference: Intel® Fortran Compiler XE 13.0 User and Reference Guides
-    !              "Because its elements do not need to be contiguous in memory, a Fortran pointer target or assumed-shape array cannot be passed to C.
-    !               However, you can pass an allocated allocatable array to C, and you can associate an array allocated in C with a Fortran pointer."
-    REAL(KIND=8), allocatable   :: dgvar(:,:,:,:)               !< storage of all unknowns (solution).
     REAL, POINTER         :: DOFStress(:,:,:) => NULL()         !< DOF's for the initial stress loading for the plastic calculations
     REAL, POINTER         :: plasticParameters(:,:) => NULL()
     REAL, POINTER         :: pstrain(:,:) => NULL()             !< plastic strain
@@ -388,14 +383,8 @@ MODULE TypesDef
 !    integer              :: nSourceTermElems !< number of elemens having a source term
 !    REAL(KIND=8), allocatable  :: dgsourceterms(:,:,:)         !< storage of source terms
 !    integer, allocatable :: indicesOfSourceTermsElems(:) !< indices of elements having a source term
-    REAL, POINTER     :: DGTaylor(:,:,:,:) => NULL() !< Work array for local dt DG
     real              :: totcputime
     REAL, POINTER     :: OutFlow(:,:,:,:) => NULL()  !< Outflowing flux for backpropagation
-    !< Geometry
-    REAL, POINTER     :: geoNormals(:,:,:) => NULL() !< Side normal vectors
-    REAL, POINTER     :: geoTangent1(:,:,:) => NULL()!< Vector 1 in the side plane
-    REAL, POINTER     :: geoTangent2(:,:,:) => NULL()!< Vector 2 in the side plane
-    REAL, POINTER     :: geoSurfaces(:,:) => NULL()  !< Triangle surface in 2D for fault
     !< Other variables related to the DG - Method
     REAL, POINTER     :: KMatrix(:,:) => NULL()      !< Precalculated i. integrals
     REAL, POINTER     :: F1Matrix(:,:) => NULL()     !< Precalculated b. integrals
@@ -1421,7 +1410,6 @@ MODULE TypesDef
      real, dimension(:), allocatable        :: dt_convectiv
 !     REAL                         , POINTER :: dt_viscos(:)                    ! aheineck @TODO not referenced in the code -> commented
      logical, dimension(:), allocatable     :: mask
-     real, dimension(:), allocatable        :: dtmin
      !< FaceAdjustment und
      !< Viscous Part
      REAL                         , POINTER :: rh(:) => NULL()
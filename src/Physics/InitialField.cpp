@@ -1,6 +1,7 @@
 #include <cmath>
 #include <array>
 #include <numeric>
+#include <algorithm>
 
 #include <Kernels/precision.hpp>
 #include <Physics/InitialField.h>
@@ -13,6 +14,59 @@
 
 extern seissol::Interoperability e_interoperability;
 
+void seissol::physics::InitialField::evaluateBatch(double time,
+                                                   std::vector<std::array<double, 3>> const& points,
+                                                   std::vector<CellMaterialData const*> const& materialData,
+                                                   yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  if (materialData.empty()) {
+    return;
+  }
+  const unsigned pointsPerElement = points.size() / materialData.size();
+  const unsigned numberOfQuantities = dofsQP.shape(1);
+
+  std::vector<std::array<double, 3>> elementPoints(pointsPerElement);
+  std::vector<real> elementDofsData(pointsPerElement * numberOfQuantities);
+  auto elementDofs = yateto::DenseTensorView<2,real,unsigned>(elementDofsData.data(), {pointsPerElement, numberOfQuantities});
+  for (size_t element = 0; element < materialData.size(); ++element) {
+    const size_t offset = element * pointsPerElement;
+    std::copy_n(points.begin() + offset, pointsPerElement, elementPoints.begin());
+    evaluate(time, elementPoints, *materialData[element], elementDofs);
+    for (unsigned j = 0; j < numberOfQuantities; ++j) {
+      for (unsigned i = 0; i < pointsPerElement; ++i) {
+        dofsQP(offset + i, j) = elementDofs(i, j);
+      }
+    }
+  }
+}
+
+void seissol::physics::ScaledField::evaluate(double time,
+                                             std::vector<std::array<double, 3>> const& points,
+                                             const CellMaterialData& materialData,
+                                             yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  m_field->evaluate(time, points, materialData, dofsQP);
+  scale(dofsQP);
+}
+
+void seissol::physics::ScaledField::evaluateBatch(double time,
+                                                  std::vector<std::array<double, 3>> const& points,
+                                                  std::vector<CellMaterialData const*> const& materialData,
+                                                  yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  m_field->evaluateBatch(time, points, materialData, dofsQP);
+  scale(dofsQP);
+}
+
+void seissol::physics::ScaledField::scale(yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  for (unsigned j = 0; j < dofsQP.shape(1); ++j) {
+    for (unsigned i = 0; i < dofsQP.shape(0); ++i) {
+      dofsQP(i, j) *= m_scale;
+    }
+  }
+}
+
 seissol::physics::Planarwave::Planarwave(const CellMaterialData& materialData, 
                double phase,
                std::array<double, 3> kVec,
@@ -39,26 +93,41 @@ seissol::physics::Planarwave::Planarwave(const CellMaterialData& materialData,
 
 void seissol::physics::Planarwave::evaluate(double time,
                                             std::vector<std::array<double, 3>> const& points,
-					    const CellMaterialData& materialData,
-                                            yateto::DenseTensorView<2,real,unsigned>& dofsQP ) const
+                                            const CellMaterialData& materialData,
+                                            yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  evaluatePoints(time, points, dofsQP);
+}
+
+void seissol::physics::Planarwave::evaluateBatch(double time,
+                                                 std::vector<std::array<double, 3>> const& points,
+                                                 std::vector<CellMaterialData const*> const&,
+                                                 yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  evaluatePoints(time, points, dofsQP);
+}
+
+void seissol::physics::Planarwave::evaluatePoints(double time,
+                                                  std::vector<std::array<double, 3>> const& points,
+                                                  yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
 {
   dofsQP.setZero();
 
   auto R = yateto::DenseTensorView<2,std::complex<double>>(const_cast<std::complex<double>*>(m_eigenvectors.data()), {NUMBER_OF_QUANTITIES, NUMBER_OF_QUANTITIES});
   for (unsigned v = 0; v < m_varField.size(); ++v) {
     const auto omega =  m_lambdaA[m_varField[v]];
-    for (unsigned j = 0; j < dofsQP.shape(1); ++j) {
-      for (size_t i = 0; i < points.size(); ++i) {
-        dofsQP(i,j) += (R(j, m_varField[v]) * m_ampField[v] *
+    for (size_t i = 0; i < points.size(); ++i) {
+      // the phase is the same for all quantities
+      const auto wave = m_ampField[v] *
                         std::exp(std::complex<double>(0.0, 1.0) * (
-                          omega * time - m_kVec[0]*points[i][0] - m_kVec[1]*points[i][1] - m_kVec[2]*points[i][2] + std::complex<double>(m_phase, 0)))).real();
+                          omega * time - m_kVec[0]*points[i][0] - m_kVec[1]*points[i][1] - m_kVec[2]*points[i][2] + std::complex<double>(m_phase, 0)));
+      for (unsigned j = 0; j < dofsQP.shape(1); ++j) {
+        dofsQP(i,j) += (R(j, m_varField[v]) * wave).real();
       }
     }
   }
 }
 
-
-
 seissol::physics::SuperimposedPlanarwave::SuperimposedPlanarwave(const CellMaterialData& materialData, real phase)
   : m_kVec({{{M_PI, 0.0, 0.0},
              {0.0, M_PI, 0.0},
@@ -70,28 +139,49 @@ seissol::physics::SuperimposedPlanarwave::SuperimposedPlanarwave(const CellMater
 { 
 }
 
-void seissol::physics::SuperimposedPlanarwave::evaluate( double time,
-                                                         std::vector<std::array<double, 3>> const& points,
-                                                         const CellMaterialData& materialData,
-                                                         yateto::DenseTensorView<2,real,unsigned>& dofsQP ) const
+template<typename EvaluatePlanarwave>
+void seissol::physics::SuperimposedPlanarwave::superimpose(unsigned numberOfPoints,
+                                                           yateto::DenseTensorView<2,real,unsigned>& dofsQP,
+                                                           EvaluatePlanarwave&& evaluatePlanarwave) const
 {
   dofsQP.setZero();
- 
-  real dofsPW_data[tensor::dofsQP::size()];
-  yateto::DenseTensorView<2,real,unsigned> dofsPW = init::dofsQP::view::create(dofsPW_data);
+
+  const unsigned numberOfQuantities = dofsQP.shape(1);
+  std::vector<real> dofsPW_data(numberOfPoints * numberOfQuantities);
+  auto dofsPW = yateto::DenseTensorView<2,real,unsigned>(dofsPW_data.data(), {numberOfPoints, numberOfQuantities});
 
   for (int pw = 0; pw < 3; pw++) {
     //evaluate each planarwave
-    m_pw.at(pw).evaluate(time, points, materialData, dofsPW);
+    evaluatePlanarwave(m_pw.at(pw), dofsPW);
     //and add results together
-    for (unsigned j = 0; j < dofsQP.shape(1); ++j) {
-      for (size_t i = 0; i < points.size(); ++i) {
+    for (unsigned j = 0; j < numberOfQuantities; ++j) {
+      for (size_t i = 0; i < numberOfPoints; ++i) {
         dofsQP(i,j) += dofsPW(i,j);
       }
     }
   }
 }
 
+void seissol::physics::SuperimposedPlanarwave::evaluate(double time,
+                                                        std::vector<std::array<double, 3>> const& points,
+                                                        const CellMaterialData& materialData,
+                                                        yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  superimpose(points.size(), dofsQP, [&](Planarwave const& planarwave, yateto::DenseTensorView<2,real,unsigned>& dofsPW) {
+    planarwave.evaluate(time, points, materialData, dofsPW);
+  });
+}
+
+void seissol::physics::SuperimposedPlanarwave::evaluateBatch(double time,
+                                                             std::vector<std::array<double, 3>> const& points,
+                                                             std::vector<CellMaterialData const*> const& materialData,
+                                                             yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  superimpose(points.size(), dofsQP, [&](Planarwave const& planarwave, yateto::DenseTensorView<2,real,unsigned>& dofsPW) {
+    planarwave.evaluateBatch(time, points, materialData, dofsPW);
+  });
+}
+
 seissol::physics::TravellingWave::TravellingWave(const CellMaterialData& materialData, const TravellingWaveParameters& travellingWaveParameters)
   //Set phase to 0.5*M_PI, so we have a zero at the origin
   //The wave travels in direction of kVec
@@ -110,24 +200,41 @@ seissol::physics::TravellingWave::TravellingWave(const CellMaterialData& materia
 }
 
 void seissol::physics::TravellingWave::evaluate(double time,
-				       	        std::vector<std::array<double, 3>> const& points,
-				       	        const CellMaterialData& materialData,
-				       	        yateto::DenseTensorView<2,real,unsigned>& dofsQp) const {
-  dofsQp.setZero();
+                                                std::vector<std::array<double, 3>> const& points,
+                                                const CellMaterialData& materialData,
+                                                yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  evaluatePoints(time, points, dofsQP);
+}
+
+void seissol::physics::TravellingWave::evaluateBatch(double time,
+                                                     std::vector<std::array<double, 3>> const& points,
+                                                     std::vector<CellMaterialData const*> const&,
+                                                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  evaluatePoints(time, points, dofsQP);
+}
+
+void seissol::physics::TravellingWave::evaluatePoints(double time,
+                                                      std::vector<std::array<double, 3>> const& points,
+                                                      yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  dofsQP.setZero();
 
   auto R = yateto::DenseTensorView<2,std::complex<double>>(const_cast<std::complex<double>*>(m_eigenvectors.data()), {NUMBER_OF_QUANTITIES, NUMBER_OF_QUANTITIES});
   for (unsigned v = 0; v < m_varField.size(); ++v) {
     const auto omega =  m_lambdaA[m_varField[v]];
-    for (unsigned j = 0; j < dofsQp.shape(1); ++j) {
-      for (size_t i = 0; i < points.size(); ++i) {
-        auto arg = std::complex<double>(0.0, 1.0) * (
-                          omega * time
-                        - m_kVec[0]*(points[i][0] - m_origin[0]) 
-                        - m_kVec[1]*(points[i][1] - m_origin[1]) 
-                        - m_kVec[2]*(points[i][2] - m_origin[2]) 
-                        + m_phase);
-        if(arg.imag() > -0.5*M_PI && arg.imag() < 1.5*M_PI) {
-          dofsQp(i,j) += (R(j,m_varField[v]) * m_ampField[v] * std::exp(arg)).real();
+    for (size_t i = 0; i < points.size(); ++i) {
+      auto arg = std::complex<double>(0.0, 1.0) * (
+                        omega * time
+                      - m_kVec[0]*(points[i][0] - m_origin[0])
+                      - m_kVec[1]*(points[i][1] - m_origin[1])
+                      - m_kVec[2]*(points[i][2] - m_origin[2])
+                      + m_phase);
+      if(arg.imag() > -0.5*M_PI && arg.imag() < 1.5*M_PI) {
+        const auto wave = m_ampField[v] * std::exp(arg);
+        for (unsigned j = 0; j < dofsQP.shape(1); ++j) {
+          dofsQP(i,j) += (R(j,m_varField[v]) * wave).real();
         }
       }
     }
@@ -135,84 +242,144 @@ void seissol::physics::TravellingWave::evaluate(double time,
 }
 
 void seissol::physics::ScholteWave::evaluate(double time,
-					     std::vector<std::array<double, 3>> const& points,
-					     const CellMaterialData& materialData,
-					     yateto::DenseTensorView<2,real,unsigned>& dofsQp) const {
+                                             std::vector<std::array<double, 3>> const& points,
+                                             const CellMaterialData& materialData,
+                                             yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  // a single element, without allocating a list of materials
+  CellMaterialData const* material = &materialData;
+  evaluatePoints(time, points, &material, 1, dofsQP);
+}
+
+void seissol::physics::ScholteWave::evaluateBatch(double time,
+                                                  std::vector<std::array<double, 3>> const& points,
+                                                  std::vector<CellMaterialData const*> const& materialData,
+                                                  yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  if (materialData.empty()) {
+    return;
+  }
+  evaluatePoints(time, points, materialData.data(), materialData.size(), dofsQP);
+}
+
+void seissol::physics::ScholteWave::evaluatePoints(double time,
+                                                   std::vector<std::array<double, 3>> const& points,
+                                                   CellMaterialData const* const* materialData,
+                                                   size_t numberOfElements,
+                                                   yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
 #ifndef USE_ANISOTROPIC
   const real omega = 2.0 * std::acos(-1);
+  const double omega2 = static_cast<double>(omega) * omega;
+  const size_t pointsPerElement = points.size() / numberOfElements;
 
   for (size_t i = 0; i < points.size(); ++i) {
     const auto& x = points[i];
-    const bool isAcousticPart = std::abs(materialData.local.mu) < std::numeric_limits<real>::epsilon();
+    const bool isAcousticPart = std::abs(materialData[i / pointsPerElement]->local.mu) < std::numeric_limits<real>::epsilon();
     const auto x_1 = x[0];
     const auto x_3 = x[2];
     const auto t = time;
+    const auto sinPhase = std::sin(omega*t - 1.406466352506808*omega*x_1);
+    const auto cosPhase = std::cos(omega*t - 1.406466352506808*omega*x_1);
     if (isAcousticPart) {
-      dofsQp(i,0) = 0.35944997730200889*std::pow(omega, 2)*std::exp(-0.98901344820674908*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1); // sigma_xx
-      dofsQp(i,1) = 0.35944997730200889*std::pow(omega, 2)*std::exp(-0.98901344820674908*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1); // sigma_yy
-      dofsQp(i,2) = 0.35944997730200889*std::pow(omega, 2)*std::exp(-0.98901344820674908*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1); // sigma_zz
-      dofsQp(i,3) = 0; // sigma_xy
-      dofsQp(i,4) = 0; // sigma_yz
-      dofsQp(i,5) = 0; // sigma_xz
-      dofsQp(i,6) = -0.50555429848461109*std::pow(omega, 2)*std::exp(-0.98901344820674908*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1); // u
-      dofsQp(i,7) = 0; // v
-      dofsQp(i,8) = 0.35550086150929727*std::pow(omega, 2)*std::exp(-0.98901344820674908*omega*x_3)*std::cos(omega*t - 1.406466352506808*omega*x_1); // w
+      const auto decay = omega2*std::exp(-0.98901344820674908*omega*x_3);
+      dofsQP(i,0) = 0.35944997730200889*decay*sinPhase; // sigma_xx
+      dofsQP(i,1) = 0.35944997730200889*decay*sinPhase; // sigma_yy
+      dofsQP(i,2) = 0.35944997730200889*decay*sinPhase; // sigma_zz
+      dofsQP(i,3) = 0; // sigma_xy
+      dofsQP(i,4) = 0; // sigma_yz
+      dofsQP(i,5) = 0; // sigma_xz
+      dofsQP(i,6) = -0.50555429848461109*decay*sinPhase; // u
+      dofsQP(i,7) = 0; // v
+      dofsQP(i,8) = 0.35550086150929727*decay*cosPhase; // w
     } else {
-      dofsQp(i,0) = -2.7820282741590652*std::pow(omega, 2)*std::exp(0.98901344820674908*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1) + 3.5151973269883681*std::pow(omega, 2)*std::exp(1.2825031256883821*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1); // sigma_xx
-      dofsQp(i,1) = -6.6613381477509402e-16*std::pow(omega, 2)*std::exp(0.98901344820674908*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1) + 0.27315475753283058*std::pow(omega, 2)*std::exp(1.2825031256883821*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1); // sigma_yy
-      dofsQp(i,2) = 2.7820282741590621*std::pow(omega, 2)*std::exp(0.98901344820674908*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1) - 2.4225782968570462*std::pow(omega, 2)*std::exp(1.2825031256883821*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1); // sigma_zz
-      dofsQp(i,3) = 0; // sigma_xy
-      dofsQp(i,4) = 0; // sigma_yz
-      dofsQp(i,5) = -2.956295201467618*std::pow(omega, 2)*std::exp(0.98901344820674908*omega*x_3)*std::cos(omega*t - 1.406466352506808*omega*x_1) + 2.9562952014676029*std::pow(omega, 2)*std::exp(1.2825031256883821*omega*x_3)*std::cos(omega*t - 1.406466352506808*omega*x_1); // sigma_xz
-      dofsQp(i,6) = 0.98901344820675241*std::pow(omega, 2)*std::exp(0.98901344820674908*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1) - 1.1525489264912381*std::pow(omega, 2)*std::exp(1.2825031256883821*omega*x_3)*std::sin(omega*t - 1.406466352506808*omega*x_1); // u
-      dofsQp(i,7) = 0; // v
-      dofsQp(i,8) = 1.406466352506812*std::pow(omega, 2)*std::exp(0.98901344820674908*omega*x_3)*std::cos(omega*t - 1.406466352506808*omega*x_1) - 1.050965490997515*std::pow(omega, 2)*std::exp(1.2825031256883821*omega*x_3)*std::cos(omega*t - 1.406466352506808*omega*x_1); // w
+      const auto decay1 = omega2*std::exp(0.98901344820674908*omega*x_3);
+      const auto decay2 = omega2*std::exp(1.2825031256883821*omega*x_3);
+      dofsQP(i,0) = (-2.7820282741590652*decay1 + 3.5151973269883681*decay2)*sinPhase; // sigma_xx
+      dofsQP(i,1) = (-6.6613381477509402e-16*decay1 + 0.27315475753283058*decay2)*sinPhase; // sigma_yy
+      dofsQP(i,2) = (2.7820282741590621*decay1 - 2.4225782968570462*decay2)*sinPhase; // sigma_zz
+      dofsQP(i,3) = 0; // sigma_xy
+      dofsQP(i,4) = 0; // sigma_yz
+      dofsQP(i,5) = (-2.956295201467618*decay1 + 2.9562952014676029*decay2)*cosPhase; // sigma_xz
+      dofsQP(i,6) = (0.98901344820675241*decay1 - 1.1525489264912381*decay2)*sinPhase; // u
+      dofsQP(i,7) = 0; // v
+      dofsQP(i,8) = (1.406466352506812*decay1 - 1.050965490997515*decay2)*cosPhase; // w
     }
   }
 #else
-  dofsQp.setZero();
+  dofsQP.setZero();
 #endif
 }
 
 void seissol::physics::SnellsLaw::evaluate(double time,
-					   std::vector<std::array<double, 3>> const& points,
-					   const CellMaterialData& materialData,
-					   yateto::DenseTensorView<2,real,unsigned>& dofsQp) const {
+                                           std::vector<std::array<double, 3>> const& points,
+                                           const CellMaterialData& materialData,
+                                           yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  // a single element, without allocating a list of materials
+  CellMaterialData const* material = &materialData;
+  evaluatePoints(time, points, &material, 1, dofsQP);
+}
+
+void seissol::physics::SnellsLaw::evaluateBatch(double time,
+                                                std::vector<std::array<double, 3>> const& points,
+                                                std::vector<CellMaterialData const*> const& materialData,
+                                                yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  if (materialData.empty()) {
+    return;
+  }
+  evaluatePoints(time, points, materialData.data(), materialData.size(), dofsQP);
+}
+
+void seissol::physics::SnellsLaw::evaluatePoints(double time,
+                                                 std::vector<std::array<double, 3>> const& points,
+                                                 CellMaterialData const* const* materialData,
+                                                 size_t numberOfElements,
+                                                 yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
 #ifndef USE_ANISOTROPIC
   const double pi = std::acos(-1);
   const double omega = 2.0 * pi;
+  const size_t pointsPerElement = points.size() / numberOfElements;
 
   for (size_t i = 0; i < points.size(); ++i) {
     const auto &x = points[i];
-    const bool isAcousticPart = std::abs(materialData.local.mu) < std::numeric_limits<real>::epsilon();
+    const bool isAcousticPart = std::abs(materialData[i / pointsPerElement]->local.mu) < std::numeric_limits<real>::epsilon();
 
     const auto x_1 = x[0];
     const auto x_3 = x[2];
     const auto t = time;
     if (isAcousticPart) {
-      dofsQp(i,0) = 1.0*omega*std::sin(omega*t - omega*(0.19866933079506119*x_1 + 0.98006657784124163*x_3)) + 0.48055591432167399*omega*std::sin(omega*t - omega*(0.19866933079506149*x_1 - 0.98006657784124152*x_3)); // sigma_xx
-      dofsQp(i,1) = 1.0*omega*std::sin(omega*t - omega*(0.19866933079506119*x_1 + 0.98006657784124163*x_3)) + 0.48055591432167399*omega*std::sin(omega*t - omega*(0.19866933079506149*x_1 - 0.98006657784124152*x_3)); // sigma_yy
-      dofsQp(i,2) = 1.0*omega*std::sin(omega*t - omega*(0.19866933079506119*x_1 + 0.98006657784124163*x_3)) + 0.48055591432167399*omega*std::sin(omega*t - omega*(0.19866933079506149*x_1 - 0.98006657784124152*x_3)); // sigma_zz
-      dofsQp(i,3) = 0; // sigma_xy
-      dofsQp(i,4) = 0; // sigma_yz
-      dofsQp(i,5) = 0; // sigma_xz
-      dofsQp(i,6) = -0.19866933079506119*omega*std::sin(omega*t - omega*(0.19866933079506119*x_1 + 0.98006657784124163*x_3)) - 0.095471721907895893*omega*std::sin(omega*t - omega*(0.19866933079506149*x_1 - 0.98006657784124152*x_3)); // u
-      dofsQp(i,7) = 0; // v
-      dofsQp(i,8) = -0.98006657784124163*omega*std::sin(omega*t - omega*(0.19866933079506119*x_1 + 0.98006657784124163*x_3)) + 0.47097679041061191*omega*std::sin(omega*t - omega*(0.19866933079506149*x_1 - 0.98006657784124152*x_3)); // w
+      // incident and reflected wave
+      const auto wave1 = omega*std::sin(omega*t - omega*(0.19866933079506119*x_1 + 0.98006657784124163*x_3));
+      const auto wave2 = omega*std::sin(omega*t - omega*(0.19866933079506149*x_1 - 0.98006657784124152*x_3));
+      dofsQP(i,0) = 1.0*wave1 + 0.48055591432167399*wave2; // sigma_xx
+      dofsQP(i,1) = 1.0*wave1 + 0.48055591432167399*wave2; // sigma_yy
+      dofsQP(i,2) = 1.0*wave1 + 0.48055591432167399*wave2; // sigma_zz
+      dofsQP(i,3) = 0; // sigma_xy
+      dofsQP(i,4) = 0; // sigma_yz
+      dofsQP(i,5) = 0; // sigma_xz
+      dofsQP(i,6) = -0.19866933079506119*wave1 - 0.095471721907895893*wave2; // u
+      dofsQP(i,7) = 0; // v
+      dofsQP(i,8) = -0.98006657784124163*wave1 + 0.47097679041061191*wave2; // w
     } else {
-      dofsQp(i,0) = -0.59005639909185559*omega*std::sin(omega*t - 1.0/2.0*omega*(0.39733866159012299*x_1 + 0.91767204817721759*x_3)) + 0.55554011463785213*omega*std::sin(omega*t - 1.0/3.0*omega*(0.59600799238518454*x_1 + 0.8029785009656123*x_3)); // sigma_xx
-      dofsQp(i,1) = 0.14460396298676709*omega*std::sin(omega*t - 1.0/3.0*omega*(0.59600799238518454*x_1 + 0.8029785009656123*x_3)); // sigma_yy
-      dofsQp(i,2) = 0.59005639909185559*omega*std::sin(omega*t - 1.0/2.0*omega*(0.39733866159012299*x_1 + 0.91767204817721759*x_3)) + 0.89049951522981918*omega*std::sin(omega*t - 1.0/3.0*omega*(0.59600799238518454*x_1 + 0.8029785009656123*x_3)); // sigma_zz
-      dofsQp(i,3) = 0; // sigma_xy
-      dofsQp(i,4) = 0; // sigma_yz
-      dofsQp(i,5) = -0.55363837274201066*omega*std::sin(omega*t - 1.0/2.0*omega*(0.39733866159012299*x_1 + 0.91767204817721759*x_3)) + 0.55363837274201*omega*std::sin(omega*t - 1.0/3.0*omega*(0.59600799238518454*x_1 + 0.8029785009656123*x_3)); // sigma_xz
-      dofsQp(i,6) = 0.37125533967075403*omega*std::sin(omega*t - 1.0/2.0*omega*(0.39733866159012299*x_1 + 0.91767204817721759*x_3)) - 0.2585553530120539*omega*std::sin(omega*t - 1.0/3.0*omega*(0.59600799238518454*x_1 + 0.8029785009656123*x_3)); // u
-      dofsQp(i,7) = 0; // v
-      dofsQp(i,8) = -0.16074816713222639*omega*std::sin(omega*t - 1.0/2.0*omega*(0.39733866159012299*x_1 + 0.91767204817721759*x_3)) - 0.34834162029840349*omega*std::sin(omega*t - 1.0/3.0*omega*(0.59600799238518454*x_1 + 0.8029785009656123*x_3)); // w
+      // transmitted P and S wave
+      const auto wave1 = omega*std::sin(omega*t - 1.0/2.0*omega*(0.39733866159012299*x_1 + 0.91767204817721759*x_3));
+      const auto wave2 = omega*std::sin(omega*t - 1.0/3.0*omega*(0.59600799238518454*x_1 + 0.8029785009656123*x_3));
+      dofsQP(i,0) = -0.59005639909185559*wave1 + 0.55554011463785213*wave2; // sigma_xx
+      dofsQP(i,1) = 0.14460396298676709*wave2; // sigma_yy
+      dofsQP(i,2) = 0.59005639909185559*wave1 + 0.89049951522981918*wave2; // sigma_zz
+      dofsQP(i,3) = 0; // sigma_xy
+      dofsQP(i,4) = 0; // sigma_yz
+      dofsQP(i,5) = -0.55363837274201066*wave1 + 0.55363837274201*wave2; // sigma_xz
+      dofsQP(i,6) = 0.37125533967075403*wave1 - 0.2585553530120539*wave2; // u
+      dofsQP(i,7) = 0; // v
+      dofsQP(i,8) = -0.16074816713222639*wave1 - 0.34834162029840349*wave2; // w
     }
   }
 #else
-  dofsQp.setZero();
+  dofsQP.setZero();
 #endif
 }
 
@@ -225,96 +392,108 @@ seissol::physics::Ocean::Ocean(int mode, double gravitationalAcceleration)
 void seissol::physics::Ocean::evaluate(double time,
                                        std::vector<std::array<double, 3>> const& points,
                                        const CellMaterialData& materialData,
-                                       yateto::DenseTensorView<2,real,unsigned>& dofsQp) const {
-#ifndef USE_ANISOTROPIC
-  for (size_t i = 0; i < points.size(); ++i) {
-    const auto x = points[i][0];
-    const auto y = points[i][1];
-    const auto z = points[i][2];
-    const auto t = time;
+                                       yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  // a single element, without allocating a list of materials
+  CellMaterialData const* material = &materialData;
+  evaluatePoints(time, points, &material, 1, dofsQP);
+}
 
-    const auto g = gravitationalAcceleration;
-    if (std::abs(g - 9.81e-3) > 10e-15) {
-      logError() << "Ocean scenario only supports g=9.81e-3 currently!";
-    }
-    if (materialData.local.mu != 0.0) {
+void seissol::physics::Ocean::evaluateBatch(double time,
+                                            std::vector<std::array<double, 3>> const& points,
+                                            std::vector<CellMaterialData const*> const& materialData,
+                                            yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+  if (materialData.empty()) {
+    return;
+  }
+  evaluatePoints(time, points, materialData.data(), materialData.size(), dofsQP);
+}
+
+void seissol::physics::Ocean::evaluatePoints(double time,
+                                             std::vector<std::array<double, 3>> const& points,
+                                             CellMaterialData const* const* materialData,
+                                             size_t numberOfElements,
+                                             yateto::DenseTensorView<2,real,unsigned>& dofsQP) const
+{
+#ifndef USE_ANISOTROPIC
+  const auto g = gravitationalAcceleration;
+  if (std::abs(g - 9.81e-3) > 10e-15) {
+    logError() << "Ocean scenario only supports g=9.81e-3 currently!";
+  }
+  for (size_t element = 0; element < numberOfElements; ++element) {
+    if (materialData[element]->local.mu != 0.0) {
       logError() << "Ocean scenario only works for acoustic material (mu = 0.0)!";
     }
-    const double pi = std::acos(-1);
-    const double rho = materialData.local.rho;
+  }
+
+  const double pi = std::acos(-1);
 
-    const double Lx = 10.0; // km
-    const double Ly = 10.0; // km
-    const double k_x = pi / Lx; // 1/km
-    const double k_y = pi / Ly; // 1/km
+  const double Lx = 10.0; // km
+  const double Ly = 10.0; // km
+  const double k_x = pi / Lx; // 1/km
+  const double k_y = pi / Ly; // 1/km
 
-    constexpr auto k_stars = std::array<double, 3>{
-      0.4452003497054692,
-      1.5733628061766445,
-      4.713305873881573
-    };
+  constexpr auto k_stars = std::array<double, 3>{
+    0.4452003497054692,
+    1.5733628061766445,
+    4.713305873881573
+  };
 
-    // Note: Could be computed on the fly but it's better to pre-compute them with higher precision!
-    constexpr auto omegas = std::array<double, 3>{
-      0.0427240277969087,
-      2.4523337594491745,
-      7.1012991617572165
-    };
+  // Note: Could be computed on the fly but it's better to pre-compute them with higher precision!
+  constexpr auto omegas = std::array<double, 3>{
+    0.0427240277969087,
+    2.4523337594491745,
+    7.1012991617572165
+  };
 
-    const auto k_star = k_stars[mode];
-    const auto omega = omegas[mode];
+  const auto k_star = k_stars[mode];
+  const auto omega = omegas[mode];
 
-    const auto B = g * k_star / (omega * omega);
-    constexpr auto scalingFactor = 1;
+  const auto B = g * k_star / (omega * omega);
+  constexpr auto scalingFactor = 1;
+
+  const auto t = time;
+  const auto sinOmegaT = std::sin(omega * t);
+  const auto cosOmegaT = std::cos(omega * t);
+  const size_t pointsPerElement = points.size() / numberOfElements;
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto x = points[i][0];
+    const auto y = points[i][1];
+    const auto z = points[i][2];
+    const double rho = materialData[i / pointsPerElement]->local.rho;
+
+    const auto sinX = std::sin(k_x * x);
+    const auto cosX = std::cos(k_x * x);
+    const auto sinY = std::sin(k_y * y);
+    const auto cosY = std::cos(k_y * y);
 
     // Shear stresses are zero for elastic
-    dofsQp(i, 3) = 0.0;
-    dofsQp(i, 4) = 0.0;
-    dofsQp(i, 5) = 0.0;
+    dofsQP(i, 3) = 0.0;
+    dofsQP(i, 4) = 0.0;
+    dofsQP(i, 5) = 0.0;
 
+    double depthProfile, depthProfileDerivative;
     if (mode == 0) {
       // Gravity mode
-      const auto pressure = -std::sin(k_x * x) * std::sin(k_y * y) * std::sin(omega * t) *
-                            (std::sinh(k_star * z) + B * std::cosh(k_star * z));
-      dofsQp(i, 0) = scalingFactor * pressure;
-      dofsQp(i, 1) = scalingFactor * pressure;
-      dofsQp(i, 2) = scalingFactor * pressure;
-
-      dofsQp(i, 6) =
-          scalingFactor * (k_x / (omega * rho)) * std::cos(k_x * x) * std::sin(k_y * y) * std::cos(omega * t) *
-          (std::sinh(k_star * z)
-           + B * std::cosh(k_star * z));
-      dofsQp(i, 7) =
-          scalingFactor * (k_y / (omega * rho)) * std::sin(k_x * x) * std::cos(k_y * y) * std::cos(omega * t) *
-          (std::sinh(k_star * z)
-           + B * std::cosh(k_star * z));
-      dofsQp(i, 8) =
-          scalingFactor * (k_star / (omega * rho)) * std::sin(k_x * x) * std::sin(k_y * y) * std::cos(omega * t) *
-          (std::cosh(k_star * z)
-           + B * std::sinh(k_star * z));
+      depthProfile = std::sinh(k_star * z) + B * std::cosh(k_star * z);
+      depthProfileDerivative = std::cosh(k_star * z) + B * std::sinh(k_star * z);
     } else {
       // Elastic-acoustic mode
-      const auto pressure = -std::sin(k_x * x) * std::sin(k_y * y) * std::sin(omega * t) *
-                            (std::sin(k_star * z) + B * std::cos(k_star * z));
-      dofsQp(i, 0) = scalingFactor * pressure;
-      dofsQp(i, 1) = scalingFactor * pressure;
-      dofsQp(i, 2) = scalingFactor * pressure;
-      dofsQp(i, 6) =
-          scalingFactor * (k_x / (omega * rho)) * std::cos(k_x * x) * std::sin(k_y * y) * std::cos(omega * t) *
-          (std::sin(k_star * z)
-           + B * std::cos(k_star * z));
-      dofsQp(i, 7) =
-          scalingFactor * (k_y / (omega * rho)) * std::sin(k_x * x) * std::cos(k_y * y) * std::cos(omega * t) *
-          (std::sin(k_star * z)
-           + B * std::cos(k_star * z));
-      dofsQp(i, 8) =
-          scalingFactor * (k_star / (omega * rho)) * std::sin(k_x * x) * std::sin(k_y * y) * std::cos(omega * t) *
-          (std::cos(k_star * z)
-           - B * std::sin(k_star * z));
+      depthProfile = std::sin(k_star * z) + B * std::cos(k_star * z);
+      depthProfileDerivative = std::cos(k_star * z) - B * std::sin(k_star * z);
     }
 
+    const auto pressure = -sinX * sinY * sinOmegaT * depthProfile;
+    dofsQP(i, 0) = scalingFactor * pressure;
+    dofsQP(i, 1) = scalingFactor * pressure;
+    dofsQP(i, 2) = scalingFactor * pressure;
+    dofsQP(i, 6) = scalingFactor * (k_x / (omega * rho)) * cosX * sinY * cosOmegaT * depthProfile;
+    dofsQP(i, 7) = scalingFactor * (k_y / (omega * rho)) * sinX * cosY * cosOmegaT * depthProfile;
+    dofsQP(i, 8) = scalingFactor * (k_star / (omega * rho)) * sinX * sinY * cosOmegaT * depthProfileDerivative;
   }
 #else
-  dofsQp.setZero();
+  dofsQP.setZero();
 #endif
 }
@@ -4,6 +4,7 @@
 #include <vector>
 #include <array>
 #include <complex>
+#include <memory>
 #include "Initializer/typedefs.hpp"
 #include <Kernels/precision.hpp>
 #include <generated_code/init.h>
@@ -17,6 +18,17 @@ namespace seissol {
                             std::vector<std::array<double, 3>> const& points,
                             const CellMaterialData& materialData,
                             yateto::DenseTensorView<2,real,unsigned>& dofsQP) const = 0;
+
+      /**
+       * Evaluates the field for a block of elements at once.
+       * points contains the same number of points for every element, element after element,
+       * materialData contains one entry per element, and dofsQP has the shape (points.size(), #quantities).
+       * The default implementation calls evaluate for every element.
+       */
+      virtual void evaluateBatch(double time,
+                                 std::vector<std::array<double, 3>> const& points,
+                                 std::vector<CellMaterialData const*> const& materialData,
+                                 yateto::DenseTensorView<2,real,unsigned>& dofsQP) const;
     };
 
     class ZeroField : public InitialField {
@@ -27,6 +39,34 @@ namespace seissol {
                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override {
         dofsQP.setZero();
       }
+      void evaluateBatch(double,
+                         std::vector<std::array<double, 3>> const&,
+                         std::vector<CellMaterialData const*> const&,
+                         yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override {
+        dofsQP.setZero();
+      }
+    };
+
+    //! Scales another initial field, e.g. for the members of fused simulations
+    class ScaledField : public InitialField {
+    public:
+      ScaledField(std::shared_ptr<InitialField> field, double scale)
+        : m_field(std::move(field)), m_scale(scale) {}
+
+      void evaluate(double time,
+                    std::vector<std::array<double, 3>> const& points,
+                    const CellMaterialData& materialData,
+                    yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+      void evaluateBatch(double time,
+                         std::vector<std::array<double, 3>> const& points,
+                         std::vector<CellMaterialData const*> const& materialData,
+                         yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+
+    private:
+      void scale(yateto::DenseTensorView<2,real,unsigned>& dofsQP) const;
+
+      std::shared_ptr<InitialField> m_field;
+      double m_scale;
     };
 
     //A planar wave travelling in direction kVec
@@ -55,7 +95,16 @@ namespace seissol {
                      std::vector<std::array<double, 3>> const& points,
                      const CellMaterialData& materialData,
                      yateto::DenseTensorView<2,real,unsigned>& dofsQP ) const override;
+      void evaluateBatch(double time,
+                         std::vector<std::array<double, 3>> const& points,
+                         std::vector<CellMaterialData const*> const& materialData,
+                         yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
     protected:
+      //! The wave does not depend on the material of the elements
+      void evaluatePoints(double time,
+                          std::vector<std::array<double, 3>> const& points,
+                          yateto::DenseTensorView<2,real,unsigned>& dofsQP) const;
+
       const std::vector<int>                                        m_varField;
       const std::vector<std::complex<double>>                       m_ampField;
       const double                                                  m_phase;
@@ -74,7 +123,16 @@ namespace seissol {
                      std::vector<std::array<double, 3>> const& points,
                      const CellMaterialData& materialData,
                      yateto::DenseTensorView<2,real,unsigned>& dofsQP ) const override;
+      void evaluateBatch(double time,
+                         std::vector<std::array<double, 3>> const& points,
+                         std::vector<CellMaterialData const*> const& materialData,
+                         yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
     private:
+      template<typename EvaluatePlanarwave>
+      void superimpose(unsigned numberOfPoints,
+                       yateto::DenseTensorView<2,real,unsigned>& dofsQP,
+                       EvaluatePlanarwave&& evaluatePlanarwave) const;
+
       const std::array<std::array<double, 3>, 3>  m_kVec;
       const double                                m_phase;
       std::array<Planarwave, 3>                   m_pw;
@@ -89,7 +147,15 @@ namespace seissol {
                     std::vector<std::array<double, 3>> const& points,
                     const CellMaterialData& materialData,
                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+      void evaluateBatch(double time,
+                         std::vector<std::array<double, 3>> const& points,
+                         std::vector<CellMaterialData const*> const& materialData,
+                         yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
       private:
+      void evaluatePoints(double time,
+                          std::vector<std::array<double, 3>> const& points,
+                          yateto::DenseTensorView<2,real,unsigned>& dofsQP) const;
+
       std::array<double, 3> m_origin;
     };
 
@@ -100,6 +166,17 @@ namespace seissol {
                     std::vector<std::array<double, 3>> const& points,
                     const CellMaterialData& materialData,
                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+      void evaluateBatch(double time,
+                         std::vector<std::array<double, 3>> const& points,
+                         std::vector<CellMaterialData const*> const& materialData,
+                         yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+    private:
+      //! Evaluates the points of numberOfElements > 0 elements with one material per element
+      void evaluatePoints(double time,
+                          std::vector<std::array<double, 3>> const& points,
+                          CellMaterialData const* const* materialData,
+                          size_t numberOfElements,
+                          yateto::DenseTensorView<2,real,unsigned>& dofsQP) const;
     };
     class SnellsLaw : public InitialField {
     public:
@@ -108,6 +185,17 @@ namespace seissol {
                     std::vector<std::array<double, 3>> const& points,
                     const CellMaterialData& materialData,
                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+      void evaluateBatch(double time,
+                         std::vector<std::array<double, 3>> const& points,
+                         std::vector<CellMaterialData const*> const& materialData,
+                         yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+    private:
+      //! Evaluates the points of numberOfElements > 0 elements with one material per element
+      void evaluatePoints(double time,
+                          std::vector<std::array<double, 3>> const& points,
+                          CellMaterialData const* const* materialData,
+                          size_t numberOfElements,
+                          yateto::DenseTensorView<2,real,unsigned>& dofsQP) const;
     };
     /*
      * From
@@ -129,6 +217,17 @@ namespace seissol {
                         std::vector<std::array<double, 3>> const& points,
                         const CellMaterialData& materialData,
                         yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+          void evaluateBatch(double time,
+                             std::vector<std::array<double, 3>> const& points,
+                             std::vector<CellMaterialData const*> const& materialData,
+                             yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+      private:
+          //! Evaluates the points of numberOfElements > 0 elements with one material per element
+          void evaluatePoints(double time,
+                              std::vector<std::array<double, 3>> const& points,
+                              CellMaterialData const* const* materialData,
+                              size_t numberOfElements,
+                              yateto::DenseTensorView<2,real,unsigned>& dofsQP) const;
       };
   }
 }
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
 #include <string>
 #ifdef _OPENMP
 #include <omp.h>
@@ -113,76 +114,117 @@ void AnalysisWriter::printAnalysis(double simulationTime) {
 
     // Note: We iterate over mesh cells by id to avoid
     // cells that are duplicates.
-    std::vector<std::array<double, 3>> quadraturePointsXyz(numQuadPoints);
+    // The analytical solution is evaluated for blocks of elements at once.
+    constexpr unsigned blockSize = 32;
+    const unsigned numberOfBlocks = (elements.size() + blockSize - 1) / blockSize;
 
-    alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
-    alignas(ALIGNMENT) real analyticalSolutionData[numQuadPoints*numberOfQuantities];
 #ifdef _OPENMP
-    // Note: Adding default(none) leads error when using gcc-8
-#pragma omp parallel for shared(elements, vertices, iniFields, quadraturePoints, globalData, errsLInfLocal, simulationTime, ltsLut, lts, sim, quadratureWeights, elemsLInfLocal, errsL2Local, errsL1Local, analyticalsL1Local, analyticalsL2Local, analyticalsLInfLocal) firstprivate(quadraturePointsXyz) private(numericalSolutionData, analyticalSolutionData)
+#pragma omp parallel
+    {
 #endif
-    for (std::size_t meshId = 0; meshId < elements.size(); ++meshId) {
 #ifdef _OPENMP
       const int curThreadId = omp_get_thread_num();
 #else
       const int curThreadId = 0;
 #endif
-      auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
-      auto analyticalSolution = yateto::DenseTensorView<2,real>(analyticalSolutionData, {numQuadPoints, numberOfQuantities});
-
-      // Needed to weight the integral.
-      const auto volume = MeshTools::volume(elements[meshId], vertices);
-      const auto jacobiDet = 6 * volume;
-
-      // Compute global position of quadrature points.
-      double const* elementCoords[4];
-      for (unsigned v = 0; v < 4; ++v) {
-        elementCoords[v] = vertices[elements[meshId].vertices[ v ] ].coords;
-      }
-      for (unsigned int i = 0; i < numQuadPoints; ++i) {
-        seissol::transformations::tetrahedronReferenceToGlobal(elementCoords[0], elementCoords[1], elementCoords[2], elementCoords[3], quadraturePoints[i], quadraturePointsXyz[i].data());
-      }
+      std::vector<std::array<double, 3>> quadraturePointsXyz;
+      quadraturePointsXyz.reserve(blockSize * numQuadPoints);
+      std::vector<CellMaterialData const*> materials;
+      materials.reserve(blockSize);
+      std::vector<real> analyticalSolutionData(blockSize * numQuadPoints * numberOfQuantities);
 
-      // Evaluate numerical solution at quad. nodes
-      kernel::evalAtQP krnl;
-      krnl.evalAtQP = globalData->evalAtQPMatrix;
-      krnl.dofsQP = numericalSolutionData;
-      krnl.Q = ltsLut->lookup(lts->dofs, meshId);
-      krnl.execute();
-
-      // Evaluate analytical solution at quad. nodes
-      const CellMaterialData& material = ltsLut->lookup(lts->material, meshId);
-      iniFields[sim % iniFields.size()]->evaluate(simulationTime,
-						  quadraturePointsXyz,
-						  material,
-						  analyticalSolution);
+      alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
+      auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
 #ifdef MULTIPLE_SIMULATIONS
       auto numSub = numericalSolution.subtensor(sim, yateto::slice<>(), yateto::slice<>());
 #else
       auto numSub = numericalSolution;
 #endif
 
-      for (size_t i = 0; i < numQuadPoints; ++i) {
-        const auto curWeight = jacobiDet * quadratureWeights[i];
-        for (size_t v = 0; v < numberOfQuantities; ++v) {
-          const auto curError = std::abs(numSub(i,v) - analyticalSolution(i,v));
-          const auto curAnalytical = std::abs(analyticalSolution(i,v));
-
-          errsL1Local[curThreadId][v] += curWeight * curError;
-          errsL2Local[curThreadId][v] += curWeight * curError * curError;
-          analyticalsL1Local[curThreadId][v] += curWeight * curAnalytical;
-          analyticalsL2Local[curThreadId][v] += curWeight * curAnalytical * curAnalytical;
+      kernel::evalAtQP krnl;
+      krnl.evalAtQP = globalData->evalAtQPMatrix;
+      krnl.dofsQP = numericalSolutionData;
 
-          if (curError > errsLInfLocal[curThreadId][v]) {
-            errsLInfLocal[curThreadId][v] = curError;
-            elemsLInfLocal[curThreadId][v] = meshId;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (unsigned block = 0; block < numberOfBlocks; ++block) {
+        const unsigned firstMeshId = block * blockSize;
+        const unsigned numberOfElements = std::min(blockSize, static_cast<unsigned>(elements.size()) - firstMeshId);
+        const unsigned numberOfPoints = numberOfElements * numQuadPoints;
+
+        // Compute global position of quadrature points.
+        quadraturePointsXyz.resize(numberOfPoints);
+        materials.resize(numberOfElements);
+        for (unsigned element = 0; element < numberOfElements; ++element) {
+          const unsigned meshId = firstMeshId + element;
+          double const* elementCoords[4];
+          for (unsigned v = 0; v < 4; ++v) {
+            elementCoords[v] = vertices[elements[meshId].vertices[ v ] ].coords;
           }
-          if (curAnalytical > analyticalsLInfLocal[curThreadId][v]) {
-            analyticalsLInfLocal[curThreadId][v] = curAnalytical;
+          for (unsigned int i = 0; i < numQuadPoints; ++i) {
+            seissol::transformations::tetrahedronReferenceToGlobal(elementCoords[0], elementCoords[1], elementCoords[2], elementCoords[3], quadraturePoints[i], quadraturePointsXyz[element * numQuadPoints + i].data());
+          }
+          materials[element] = &ltsLut->lookup(lts->material, meshId);
+        }
+
+        // Evaluate analytical solution at quad. nodes of the block
+        auto analyticalSolution = yateto::DenseTensorView<2,real,unsigned>(analyticalSolutionData.data(), {numberOfPoints, numberOfQuantities});
+        iniFields[sim % iniFields.size()]->evaluateBatch(simulationTime,
+                                                         quadraturePointsXyz,
+                                                         materials,
+                                                         analyticalSolution);
+
+        for (unsigned element = 0; element < numberOfElements; ++element) {
+          const unsigned meshId = firstMeshId + element;
+          const unsigned offset = element * numQuadPoints;
+
+          // Needed to weight the integral.
+          const auto volume = MeshTools::volume(elements[meshId], vertices);
+          const auto jacobiDet = 6 * volume;
+
+          // Evaluate numerical solution at quad. nodes
+          krnl.Q = ltsLut->lookup(lts->dofs, meshId);
+          krnl.execute();
+
+          for (size_t v = 0; v < numberOfQuantities; ++v) {
+            double errL1 = 0.0;
+            double errL2 = 0.0;
+            double errLInf = -1.0;
+            double analyticalL1 = 0.0;
+            double analyticalL2 = 0.0;
+            double analyticalLInf = -1.0;
+#pragma omp simd reduction(+:errL1,errL2,analyticalL1,analyticalL2) reduction(max:errLInf,analyticalLInf)
+            for (unsigned i = 0; i < numQuadPoints; ++i) {
+              const double curError = std::abs(numSub(i,v) - analyticalSolution(offset + i,v));
+              const double curAnalytical = std::abs(analyticalSolution(offset + i,v));
+
+              errL1 += quadratureWeights[i] * curError;
+              errL2 += quadratureWeights[i] * curError * curError;
+              analyticalL1 += quadratureWeights[i] * curAnalytical;
+              analyticalL2 += quadratureWeights[i] * curAnalytical * curAnalytical;
+              errLInf = std::max(errLInf, curError);
+              analyticalLInf = std::max(analyticalLInf, curAnalytical);
+            }
+
+            errsL1Local[curThreadId][v] += jacobiDet * errL1;
+            errsL2Local[curThreadId][v] += jacobiDet * errL2;
+            analyticalsL1Local[curThreadId][v] += jacobiDet * analyticalL1;
+            analyticalsL2Local[curThreadId][v] += jacobiDet * analyticalL2;
+
+            if (errLInf > errsLInfLocal[curThreadId][v]) {
+              errsLInfLocal[curThreadId][v] = errLInf;
+              elemsLInfLocal[curThreadId][v] = meshId;
+            }
+            if (analyticalLInf > analyticalsLInfLocal[curThreadId][v]) {
+              analyticalsLInfLocal[curThreadId][v] = analyticalLInf;
+            }
           }
         }
       }
+#ifdef _OPENMP
     }
+#endif
 
     for (int i = 0; i < numThreads; ++i) {
       for (unsigned v = 0; v < numberOfQuantities; ++v) {
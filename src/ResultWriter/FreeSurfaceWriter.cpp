@@ -163,11 +163,16 @@ void seissol::writer::FreeSurfaceWriter::init(  MeshReader const&
 	bufferId = addSyncBuffer(vertices, nVertices * 3 * sizeof(double));
 	assert(bufferId == FreeSurfaceWriterExecutor::VERTICES);
 
+	// The members of fused simulations are stored one after another
 	for (auto & velocity : m_freeSurfaceIntegrator->velocities) {
-		addBuffer(velocity, nCells * sizeof(real));
+		for (unsigned member = 0; member < initializers::Ensemble::NumberOfMembers; ++member) {
+			addBuffer(velocity + member * nCells, nCells * sizeof(real));
+		}
 	}
 	for (auto & displacement : m_freeSurfaceIntegrator->displacements) {
-		addBuffer(displacement, nCells * sizeof(real));
+		for (unsigned member = 0; member < initializers::Ensemble::NumberOfMembers; ++member) {
+			addBuffer(displacement + member * nCells, nCells * sizeof(real));
+		}
 	}
 	addBuffer(m_freeSurfaceIntegrator->locationFlags.data(), nCells * sizeof(double));
 
@@ -217,7 +222,7 @@ void seissol::writer::FreeSurfaceWriter::write(double time)
 	FreeSurfaceParam param;
 	param.time = time;
 
-	for (unsigned i = 0; i < 2*FREESURFACE_NUMBER_OF_COMPONENTS + 1; ++i) {
+	for (unsigned i = 0; i < 2*FREESURFACE_NUMBER_OF_COMPONENTS*initializers::Ensemble::NumberOfMembers + 1; ++i) {
 		sendBuffer(FreeSurfaceWriterExecutor::VARIABLES0 + i);
 	}
 
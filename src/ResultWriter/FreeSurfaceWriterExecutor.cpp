@@ -42,6 +42,7 @@
 #include <string>
 #include <vector>
 
+#include <Initializer/Ensemble.h>
 #include <Solver/FreeSurfaceIntegrator.h>
 #include "utils/logger.h"
 #include "FreeSurfaceWriterExecutor.h"
@@ -71,10 +72,20 @@ void seissol::writer::FreeSurfaceWriterExecutor::execInit(const async::ExecInfo
 		std::string outputName(static_cast<const char*>(info.buffer(OUTPUT_PREFIX)));
 		outputName += "-surface";
 
-    m_numVariables = 2*FREESURFACE_NUMBER_OF_COMPONENTS + 1;
+    // Velocities and displacements are written for every member of fused simulations
+    constexpr unsigned numMembers = seissol::initializers::Ensemble::NumberOfMembers;
+    m_numVariables = 2*FREESURFACE_NUMBER_OF_COMPONENTS*numMembers + 1;
+    m_variableNames.clear();
+    for (unsigned int i = 0; i < 2*FREESURFACE_NUMBER_OF_COMPONENTS; i++) {
+      for (unsigned member = 0; member < numMembers; ++member) {
+        m_variableNames.push_back(numMembers > 1 ? LABELS[i] + ("_" + std::to_string(member)) : std::string(LABELS[i]));
+      }
+    }
+    m_variableNames.push_back(LABELS[2*FREESURFACE_NUMBER_OF_COMPONENTS]);
+
 		std::vector<const char*> variables;
-		for (unsigned int i = 0; i < m_numVariables; i++) {
-      variables.push_back(LABELS[i]);
+		for (const auto& name : m_variableNames) {
+      variables.push_back(name.c_str());
 		}
 
 		// TODO get the timestep from the checkpoint
@@ -40,6 +40,9 @@
 #ifndef FREESURFACEWRITEREXECUTOR_H
 #define FREESURFACEWRITEREXECUTOR_H
 
+#include <string>
+#include <vector>
+
 #include "xdmfwriter/XdmfWriter.h"
 #include "async/ExecInfo.h"
 
@@ -79,6 +82,9 @@ private:
 	xdmfwriter::XdmfWriter<xdmfwriter::TRIANGLE, double, real>* m_xdmfWriter;
   unsigned m_numVariables;
 
+	/** Names of the written variables */
+	std::vector<std::string> m_variableNames;
+
 	/** Backend stopwatch */
 	Stopwatch m_stopwatch;
 
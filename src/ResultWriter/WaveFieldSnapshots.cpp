@@ -0,0 +1,202 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2026, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Wave field snapshots which are recorded by the time clusters independently of the synchronization points.
+ **/
+
+#include <algorithm>
+#include <cassert>
+
+#include "WaveFieldSnapshots.h"
+#include "WaveFieldWriter.h"
+#include "Parallel/MPI.h"
+#include <Initializer/MemoryAllocator.h>
+#include <generated_code/tensor.h>
+
+seissol::writer::WaveFieldSnapshots::WaveFieldSnapshots(WaveFieldWriter &writer, double interval, const real* dofs)
+	: m_writer(writer),
+	  m_interval(interval),
+	  m_startTime(0),
+	  m_dofs(dofs),
+	  m_size(0),
+	  m_numberOfClusters(0),
+	  m_firstOutput(1)
+{
+#ifdef USE_MPI
+	MPI_Comm_dup(seissol::MPI::mpi.comm(), &m_comm);
+#endif // USE_MPI
+}
+
+seissol::writer::WaveFieldSnapshots::~WaveFieldSnapshots()
+{
+	assert(m_snapshots.empty());
+
+	for (real* buffer : m_freeBuffers)
+		seissol::memory::free(buffer);
+
+#ifdef USE_MPI
+	MPI_Comm_free(&m_comm);
+#endif // USE_MPI
+}
+
+void seissol::writer::WaveFieldSnapshots::initialize(unsigned int numberOfClusters, unsigned int numberOfCells)
+{
+	m_numberOfClusters = numberOfClusters;
+	m_size = static_cast<std::size_t>(numberOfCells) * tensor::Q::size();
+	m_nextOutputs.assign(numberOfClusters, m_firstOutput);
+
+	// At least one snapshot is always pending, allocate it during the setup
+	m_freeBuffers.push_back(allocateBuffer());
+
+	logInfo(seissol::MPI::mpi.rank()) << "Wave field snapshots are recorded by the time clusters, every pending snapshot requires"
+		<< m_size * sizeof(real) / (1024. * 1024.) << "MiB.";
+}
+
+void seissol::writer::WaveFieldSnapshots::setStartTime(double time)
+{
+	assert(m_snapshots.empty());
+
+	m_startTime = time;
+	m_firstOutput = 1;
+	std::fill(m_nextOutputs.begin(), m_nextOutputs.end(), m_firstOutput);
+}
+
+std::vector<seissol::writer::WaveFieldSnapshots::Target> seissol::writer::WaveFieldSnapshots::take(unsigned int cluster, double end)
+{
+	std::vector<Target> targets;
+
+	unsigned long &next = m_nextOutputs[cluster];
+	while (outputTime(next) < end) {
+		Snapshot &snapshot = pending(next);
+		assert(snapshot.missingClusters > 0);
+		snapshot.missingClusters--;
+		targets.push_back({snapshot.time, snapshot.dofs});
+
+		next++;
+	}
+
+	return targets;
+}
+
+void seissol::writer::WaveFieldSnapshots::progress(bool wait)
+{
+	// Snapshots are completed in order since every cluster records them in order
+	for (Snapshot &snapshot : m_snapshots) {
+		if (snapshot.complete)
+			continue;
+		if (snapshot.missingClusters > 0)
+			break;
+
+#ifdef USE_MPI
+		MPI_Ibarrier(m_comm, &snapshot.request);
+#endif // USE_MPI
+		snapshot.complete = true;
+	}
+
+	// Write in order of the output times, this order is the same on all ranks
+	while (!m_snapshots.empty() && m_snapshots.front().complete) {
+		Snapshot &snapshot = m_snapshots.front();
+
+#ifdef USE_MPI
+		if (wait) {
+			MPI_Wait(&snapshot.request, MPI_STATUS_IGNORE);
+		} else {
+			int done = 0;
+			MPI_Test(&snapshot.request, &done, MPI_STATUS_IGNORE);
+			if (!done)
+				break;
+		}
+#endif // USE_MPI
+
+		m_writer.write(snapshot.time, snapshot.dofs);
+
+		m_freeBuffers.push_back(snapshot.dofs);
+		m_snapshots.pop_front();
+		m_firstOutput++;
+	}
+}
+
+void seissol::writer::WaveFieldSnapshots::synchronize(double time, double timeTolerance)
+{
+	// Snapshots at the synchronization time are not within the time step of any cluster,
+	// take them directly from the DOFs
+	unsigned long output = m_firstOutput;
+	for (; outputTime(output) < time + timeTolerance; output++) {
+		Snapshot &snapshot = pending(output);
+		if (snapshot.missingClusters > 0) {
+			real* const dofs = snapshot.dofs;
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(static)
+#endif // _OPENMP
+			for (std::size_t i = 0; i < m_size; i++)
+				dofs[i] = m_dofs[i];
+			snapshot.missingClusters = 0;
+		}
+	}
+
+	for (unsigned long &next : m_nextOutputs)
+		next = std::max(next, output);
+
+	progress(true);
+}
+
+seissol::writer::WaveFieldSnapshots::Snapshot& seissol::writer::WaveFieldSnapshots::pending(unsigned long output)
+{
+	assert(output >= m_firstOutput);
+
+	const std::size_t position = output - m_firstOutput;
+	assert(position <= m_snapshots.size());
+	if (position == m_snapshots.size()) {
+		Snapshot snapshot;
+		snapshot.time = outputTime(output);
+		snapshot.dofs = allocateBuffer();
+		snapshot.missingClusters = m_numberOfClusters;
+		snapshot.complete = false;
+		m_snapshots.push_back(snapshot);
+	}
+
+	return m_snapshots[position];
+}
+
+real* seissol::writer::WaveFieldSnapshots::allocateBuffer()
+{
+	if (!m_freeBuffers.empty()) {
+		real* buffer = m_freeBuffers.back();
+		m_freeBuffers.pop_back();
+		return buffer;
+	}
+
+	seissol::memory::ScopedMemoryTag tag("Output/wave field snapshots");
+	return static_cast<real*>(seissol::memory::allocate(m_size * sizeof(real), PAGESIZE_HEAP));
+}
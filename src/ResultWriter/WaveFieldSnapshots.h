@@ -0,0 +1,200 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2026, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Wave field snapshots which are recorded by the time clusters independently of the synchronization points.
+ **/
+
+#ifndef WAVE_FIELD_SNAPSHOTS_H
+#define WAVE_FIELD_SNAPSHOTS_H
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif // USE_MPI
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include <Initializer/typedefs.hpp>
+
+namespace seissol
+{
+
+namespace writer
+{
+
+class WaveFieldWriter;
+
+/**
+ * Copies of the DOFs at the output times of the wave field.
+ *
+ * Every time cluster evaluates the Taylor expansion of its cells at all output times within its
+ * next time step and stores the result in the snapshot of the respective output time
+ * (see {@link take}). A snapshot is written as soon as all local clusters recorded it and all
+ * ranks completed it (non-blocking barrier). The snapshots are written in order of their output
+ * times on all ranks, hence the collective I/O of the writer is matched even though the ranks
+ * reach the output times at different points of their time stepping.
+ *
+ * The snapshots mirror the layout of the DOFs in the LTS tree, i.e. the mapping of the wave field
+ * writer can be used as is.
+ */
+class WaveFieldSnapshots
+{
+public:
+	/** Output time and DOFs of a snapshot which has to be recorded by a cluster */
+	struct Target
+	{
+		double time;
+		real* dofs;
+	};
+
+private:
+	struct Snapshot
+	{
+		/** The output time */
+		double time;
+
+		/** The recorded DOFs */
+		real* dofs;
+
+		/** Number of local clusters which did not record this snapshot yet */
+		unsigned int missingClusters;
+
+#ifdef USE_MPI
+		/** Non-blocking barrier which completes when all ranks recorded this snapshot */
+		MPI_Request request;
+#endif // USE_MPI
+
+		/** True if all local clusters recorded the snapshot (and the barrier is posted) */
+		bool complete;
+	};
+
+	/** The writer of the snapshots */
+	WaveFieldWriter &m_writer;
+
+	/** The output interval */
+	double m_interval;
+
+	/** The start time of the simulation */
+	double m_startTime;
+
+	/** The DOFs of the LTS tree */
+	const real* m_dofs;
+
+	/** Number of reals in the DOFs of the LTS tree */
+	std::size_t m_size;
+
+	/** Number of local clusters */
+	unsigned int m_numberOfClusters;
+
+	/** Index of the next output time of every cluster */
+	std::vector<unsigned long> m_nextOutputs;
+
+	/** Index of the output time of the first pending snapshot */
+	unsigned long m_firstOutput;
+
+	/** Pending snapshots in order of their output time */
+	std::deque<Snapshot> m_snapshots;
+
+	/** Buffers of written snapshots which can be reused */
+	std::vector<real*> m_freeBuffers;
+
+#ifdef USE_MPI
+	/** Communicator of the non-blocking barriers */
+	MPI_Comm m_comm;
+#endif // USE_MPI
+
+public:
+	WaveFieldSnapshots(WaveFieldWriter &writer, double interval, const real* dofs);
+
+	~WaveFieldSnapshots();
+
+	/**
+	 * @param numberOfClusters The number of local time clusters
+	 * @param numberOfCells The number of cells with DOFs in the LTS tree
+	 */
+	void initialize(unsigned int numberOfClusters, unsigned int numberOfCells);
+
+	/**
+	 * Sets the start time of the simulation. The first snapshot is recorded one interval later;
+	 * the initial wave field is written by the writer itself.
+	 */
+	void setStartTime(double time);
+
+	/**
+	 * @return The DOFs of the LTS tree; the position of a cell's DOFs relative to these is the
+	 *  position of the cell in the snapshots.
+	 */
+	const real* dofs() const
+	{
+		return m_dofs;
+	}
+
+	/**
+	 * Returns all snapshots with an output time before <code>end</code> which have not been
+	 * recorded by the cluster yet. The snapshots are counted as recorded by the cluster, i.e. the
+	 * cluster has to fill its cells in all returned snapshots before calling {@link progress}.
+	 */
+	std::vector<Target> take(unsigned int cluster, double end);
+
+	/**
+	 * Writes all snapshots which are completed on all ranks.
+	 *
+	 * @param wait Wait for the completion on the other ranks
+	 */
+	void progress(bool wait = false);
+
+	/**
+	 * Called when all clusters reached a synchronization point. Records the snapshots at the
+	 * synchronization time from the DOFs and writes all snapshots until this time.
+	 */
+	void synchronize(double time, double timeTolerance);
+
+private:
+	double outputTime(unsigned long output) const
+	{
+		return m_startTime + output * m_interval;
+	}
+
+	/** @return The pending snapshot of the output, created if necessary */
+	Snapshot& pending(unsigned long output);
+
+	real* allocateBuffer();
+};
+
+}
+
+}
+
+#endif // WAVE_FIELD_SNAPSHOTS_H
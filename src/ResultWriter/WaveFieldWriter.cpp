@@ -37,8 +37,10 @@
  * @section DESCRIPTION
  */
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <vector>
 
 #include "SeisSol.h"
 #include "WaveFieldWriter.h"
@@ -46,6 +48,8 @@
 #include "Geometry/refinement/MeshRefiner.h"
 #include "Monitoring/instrumentation.fpp"
 #include <Modules/Modules.h>
+#include <Initializer/MemoryAllocator.h>
+#include <utils/env.h>
 
 void seissol::writer::WaveFieldWriter::setUp()
 {
@@ -67,6 +71,18 @@ void seissol::writer::WaveFieldWriter::enable()
 	seissol::SeisSol::main.checkPointManager().header().add(m_timestepComp);
 }
 
+void seissol::writer::WaveFieldWriter::setWaveFieldInterval(double interval)
+{
+#ifndef ACL_DEVICE
+	m_decoupled = utils::Env::get<bool>("SEISSOL_DECOUPLED_WAVEFIELD_OUTPUT", false);
+#endif // ACL_DEVICE
+
+	if (m_decoupled)
+		m_interval = interval;
+	else
+		setSyncInterval(interval);
+}
+
 seissol::refinement::TetrahedronRefiner<double>* seissol::writer::WaveFieldWriter::createRefiner(int refinement) {
   int const rank = seissol::MPI::mpi.rank();
   refinement::TetrahedronRefiner<double>* tetRefiner = 0L;
@@ -155,7 +171,9 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 	async::Module<WaveFieldWriterExecutor, WaveFieldInitParam, WaveFieldParam>::init();
 
   Modules::registerHook(*this, SIMULATION_START);
-  Modules::registerHook(*this, SYNCHRONIZATION_POINT);
+  // Decoupled snapshots are written while the clusters advance in time
+  if (!m_decoupled)
+    Modules::registerHook(*this, SYNCHRONIZATION_POINT);
 
 	const int rank = seissol::MPI::mpi.rank();
 
@@ -174,12 +192,15 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 	//
 	// High order I/O
 	//
-	m_numVariables = numVars + WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES;
+	// Every member of fused simulations gets its own set of variables
+	const unsigned int numMembers = initializers::Ensemble::NumberOfMembers;
+	const unsigned int numWaveVariables = numVars * numMembers;
+	m_numVariables = numWaveVariables + WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES;
 	m_outputFlags = new bool[m_numVariables];
-	for (size_t i = 0; i < numVars; i++)
-		m_outputFlags[i] = (outputMask[i] != 0);
+	for (size_t i = 0; i < numWaveVariables; i++)
+		m_outputFlags[i] = (outputMask[i % numVars] != 0);
 	for (size_t i = 0; i < WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES; i++) 
-		m_outputFlags[numVars + i] = (pstrain != 0L) && (plasticityMask[i] != 0L);
+		m_outputFlags[numWaveVariables + i] = (pstrain != 0L) && (plasticityMask[i] != 0L);
 
 	// WARNING: The m_outputFlags memory might be directly used by the executor.
 	// Do not modify this array after the following line
@@ -275,7 +296,7 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 			<< meshRefiner->getNumVertices();
 	// Initialize the variable subsampler
 	m_variableSubsampler = std::make_unique<refinement::VariableSubsampler<double>>(
-			numElems, *tetRefiner, order, numVars, numAlignedDOF);
+			numElems, *tetRefiner, order, numVars, numAlignedDOF, numMembers);
 	m_variableSubsamplerPStrain = std::make_unique<refinement::VariableSubsampler<double>>(
 			numElems, *tetRefiner, order, static_cast<unsigned int>(WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES) , numAlignedDOF);
 
@@ -297,6 +318,7 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 	for (unsigned int i = 0; i < m_numVariables; i++) {
 		if (m_outputFlags[i]) {
 			unsigned int id = addBuffer(0L, meshRefiner->getNumCells() * sizeof(real));
+			seissol::memory::accountMemory("Output/wave field", meshRefiner->getNumCells() * sizeof(real));
 			if (!first) {
 				param.bufferIds[VARIABLE0] = id;
 				first = true;
@@ -346,6 +368,7 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 
 		for (int i = 1; i < numLowVars; i++)
 			addBuffer(0L, pLowMeshRefiner->getNumCells() * sizeof(real));
+		seissol::memory::accountMemory("Output/wave field", std::max(numLowVars, 1) * pLowMeshRefiner->getNumCells() * sizeof(real));
 
 		// Save number of cells
 		m_numLowCells = pLowMeshRefiner->getNumCells();
@@ -403,10 +426,13 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 	m_variableBufferIds[0] = param.bufferIds[VARIABLE0];
 	m_variableBufferIds[1] = param.bufferIds[LOWVARIABLE0];
 
+	if (m_decoupled)
+		m_snapshots = std::make_unique<WaveFieldSnapshots>(*this, m_interval, dofs);
+
 	delete meshRefiner;
 }
 
-void seissol::writer::WaveFieldWriter::write(double time)
+void seissol::writer::WaveFieldWriter::write(double time, const real* dofs)
 {
 	SCOREP_USER_REGION("WaveFieldWriter_write", SCOREP_USER_REGION_TYPE_FUNCTION);
 
@@ -425,6 +451,11 @@ void seissol::writer::WaveFieldWriter::write(double time)
 
 	logInfo(rank) << "Writing wave field at time" << utils::nospace <<  time << '.';
 
+	// Subsample all selected variables in a single pass over the DOFs (and the plastic strain)
+	const unsigned int numWaveVariables = m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES;
+	std::vector<int> waveVariables, pstrainVariables;
+	std::vector<real*> waveBuffers, pstrainBuffers;
+	std::vector<unsigned int> bufferIds;
 	unsigned int nextId = m_variableBufferIds[0];
 	for (unsigned int i = 0; i < m_numVariables; i++) {
 		if (!m_outputFlags[i])
@@ -432,42 +463,50 @@ void seissol::writer::WaveFieldWriter::write(double time)
 
 		real* managedBuffer = async::Module<WaveFieldWriterExecutor,
 				WaveFieldInitParam, WaveFieldParam>::managedBuffer<real*>(nextId);
-		if (i < m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES) {
-			m_variableSubsampler->get(m_dofs, m_map, i, managedBuffer);
+		if (i < numWaveVariables) {
+			waveVariables.push_back(i);
+			waveBuffers.push_back(managedBuffer);
 		} else {
-			m_variableSubsamplerPStrain->get(m_pstrain, m_map, 
-			i - (m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES), managedBuffer);
-		}
-		for (unsigned int j = 0; j < m_numCells; j++) {
-			if (!std::isfinite(managedBuffer[j])) {
- 				logError() << "Detected Inf/NaN in volume output. Aborting.";
-			}
+			pstrainVariables.push_back(i - numWaveVariables);
+			pstrainBuffers.push_back(managedBuffer);
 		}
-		sendBuffer(nextId, m_numCells*sizeof(real));
+		bufferIds.push_back(nextId);
 
 		nextId++;
 	}
 
-	// nextId is required in a manner similar to above for writing integrated variables
-	nextId = 0;
+	bool finite = true;
+	if (!waveVariables.empty())
+		finite = m_variableSubsampler->get(dofs, m_map, waveVariables, waveBuffers.data());
+	if (!pstrainVariables.empty())
+		finite = m_variableSubsamplerPStrain->get(m_pstrain, m_map, pstrainVariables, pstrainBuffers.data()) && finite;
+	if (!finite)
+		logError() << "Detected Inf/NaN in volume output. Aborting.";
+
+	for (unsigned int id : bufferIds)
+		sendBuffer(id, m_numCells*sizeof(real));
 
 	if (m_integrals) {
+		// Only the selected integrated variables are stored, in the same order as their buffers
+		std::vector<real*> integralBuffers;
 		for (unsigned int i = 0; i < WaveFieldWriterExecutor::NUM_INTEGRATED_VARIABLES; i++) {
 			if (!m_lowOutputFlags[i])
 				continue;
-			real* managedBuffer = async::Module<WaveFieldWriterExecutor,
-			WaveFieldInitParam, WaveFieldParam>::managedBuffer<real*>(m_variableBufferIds[1]+nextId);
+			integralBuffers.push_back(async::Module<WaveFieldWriterExecutor,
+				WaveFieldInitParam, WaveFieldParam>::managedBuffer<real*>(m_variableBufferIds[1]+integralBuffers.size()));
+		}
 
 #ifdef _OPENMP
-			#pragma omp parallel for schedule(static)
+		#pragma omp parallel for schedule(static)
 #endif // _OPENMP
-			for (unsigned int j = 0; j < m_numLowCells; j++)
-				managedBuffer[j] = m_integrals[m_map[j]
-						* m_numIntegratedVariables + nextId];
-
-			sendBuffer(m_variableBufferIds[1]+nextId, m_numLowCells*sizeof(real));
-			nextId++;
+		for (unsigned int j = 0; j < m_numLowCells; j++) {
+			const real* cellIntegrals = &m_integrals[m_map[j] * m_numIntegratedVariables];
+			for (std::size_t i = 0; i < integralBuffers.size(); i++)
+				integralBuffers[i][j] = cellIntegrals[i];
 		}
+
+		for (unsigned int i = 0; i < integralBuffers.size(); i++)
+			sendBuffer(m_variableBufferIds[1]+i, m_numLowCells*sizeof(real));
 	}
 
 	WaveFieldParam param;
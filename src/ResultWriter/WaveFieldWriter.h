@@ -56,6 +56,7 @@
 #include "Checkpoint/DynStruct.h"
 #include "Geometry/refinement/VariableSubSampler.h"
 #include "Monitoring/Stopwatch.h"
+#include "WaveFieldSnapshots.h"
 #include "WaveFieldWriterExecutor.h"
 #include <Modules/Module.h>
 
@@ -86,6 +87,15 @@ class WaveFieldWriter : private async::Module<WaveFieldWriterExecutor, WaveField
 	/** Variable buffer ids (high and low order variables) */
 	int m_variableBufferIds[2];
 
+	/** True if the snapshots are recorded by the time clusters instead of at synchronization points */
+	bool m_decoupled;
+
+	/** The output interval (if decoupled from the synchronization points) */
+	double m_interval;
+
+	/** The snapshots recorded by the time clusters */
+	std::unique_ptr<WaveFieldSnapshots> m_snapshots;
+
 	/** The output prefix for the filename */
 	std::string m_outputPrefix;
 
@@ -150,6 +160,8 @@ public:
 	WaveFieldWriter()
 		: m_enabled(false),
 		  m_extractRegion(false),
+		  m_decoupled(false),
+		  m_interval(0),
 		  m_numVariables(0),
 		  m_outputFlags(0L),
 		  m_lowOutputFlags(0L),
@@ -185,13 +197,13 @@ public:
 	 */
 	void setUp();
 
-  void setWaveFieldInterval(double interval) {
-    setSyncInterval(interval);
-  }
+	void setWaveFieldInterval(double interval);
 
 	/**
 	 * Initialize the wave field ouput
 	 *
+	 * @param numAlignedDOF The number of DOFs of one variable in the DOF array, including
+	 *  all fused simulations
 	 * @param map The mapping from the cell order to dofs order
 	 * @param timeTolerance The tolerance in the time for ignoring duplicate time steps
 	 */
@@ -205,7 +217,24 @@ public:
 	/**
 	 * Write a time step
 	 */
-	void write(double time);
+	void write(double time)
+	{
+		write(time, m_dofs);
+	}
+
+	/**
+	 * Write a time step from a snapshot of the degrees of freedom
+	 */
+	void write(double time, const real* dofs);
+
+	/**
+	 * @return The snapshots which have to be recorded by the time clusters or
+	 *  nullptr if the output is done at synchronization points
+	 */
+	WaveFieldSnapshots* snapshots()
+	{
+		return m_snapshots.get();
+	}
 
 	/**
 	 * Close wave field writer and free resources
@@ -223,6 +252,8 @@ public:
 
 		m_stopwatch.printTime("Time wave field writer frontend:");
 
+		m_snapshots.reset();
+
 		delete [] m_outputFlags;
 		m_outputFlags = 0L;
 		delete [] m_lowOutputFlags;
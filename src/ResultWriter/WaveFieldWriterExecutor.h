@@ -43,6 +43,7 @@
 #include "Parallel/MPI.h"
 
 #include <cassert>
+#include <string>
 #include <vector>
 
 #include "utils/logger.h"
@@ -53,6 +54,8 @@
 
 #include "Monitoring/Stopwatch.h"
 
+#include "Initializer/Ensemble.h"
+
 namespace seissol
 {
 
@@ -105,6 +108,9 @@ private:
 	/** Flag indicated which variables should be written */
 	const bool* m_outputFlags;
 
+	/** Names of the written variables */
+	std::vector<std::string> m_variableNames;
+
 	/** Flags indicating which low order variables should be written */
 	const bool* m_lowOutputFlags;
 
@@ -174,17 +180,30 @@ public:
 			"eta"
 		};
 
-		std::vector<const char*> variables;
-		for (unsigned int i = 0; i < m_numVariables; i++) {
-			if (m_outputFlags[i]) {
+		// The wave field variables are repeated for every member of fused simulations
+		const unsigned int numMembers = initializers::Ensemble::NumberOfMembers;
+		const unsigned int numWaveVariables = m_numVariables - NUM_PLASTICITY_VARIABLES;
+		const unsigned int numVars = numWaveVariables / numMembers;
 #ifdef USE_POROELASTIC
-				assert(i < 20);
+		assert(numVars + NUM_PLASTICITY_VARIABLES <= 20);
 #else
-				assert(i < 16);
+		assert(numVars + NUM_PLASTICITY_VARIABLES <= 16);
 #endif
-				variables.push_back(varNames[i]);
+
+		m_variableNames.clear();
+		for (unsigned int i = 0; i < m_numVariables; i++) {
+			if (m_outputFlags[i]) {
+				if (i >= numWaveVariables)
+					m_variableNames.push_back(varNames[i - numWaveVariables + numVars]);
+				else if (numMembers > 1)
+					m_variableNames.push_back(varNames[i % numVars] + std::to_string(i / numVars));
+				else
+					m_variableNames.push_back(varNames[i]);
       }
 		}
+		std::vector<const char*> variables;
+		for (const auto& name : m_variableNames)
+			variables.push_back(name.c_str());
 
 #ifdef USE_MPI
 	// Split the communicator into two - those containing vertices and those
@@ -101,7 +101,7 @@ CONTAINS
        ENDIF
        IF (DISC%DynRup%magnitude_out(iFace)) THEN
            ! magnitude = scalar seismic moment = slip per element * element face * shear modulus
-           magnitude = magnitude + DISC%DynRup%averaged_Slip(iFace)*DISC%Galerkin%geoSurfaces(iSide,iElem)*MaterialVal(iElem,2)
+           magnitude = magnitude + DISC%DynRup%averaged_Slip(iFace)*MESH%Fault%geoSurfaces(iFace)*MaterialVal(iElem,2)
        ENDIF
     ENDDO
 #ifdef PARALLEL
@@ -249,9 +249,9 @@ CONTAINS
                       +DISC%DynRup%TracXZ(iBndGP,iFace)*DISC%DynRup%SlipRate2(iBndGP,iFace))/DISC%Galerkin%nBndGP
        ENDDO
        ! magnitude = scalar seismic moment = slip per element * element face * shear modulus
-       MomentRate = MomentRate + averageSR*DISC%Galerkin%geoSurfaces(iSide,iElem)*MaterialVal(iElem,2)
+       MomentRate = MomentRate + averageSR*MESH%Fault%geoSurfaces(iFace)*MaterialVal(iElem,2)
        ! frictional energy, integrate over each element
-       FrictionalEnRate = FrictionalEnRate + averageFER*DISC%Galerkin%geoSurfaces(iSide,iElem)
+       FrictionalEnRate = FrictionalEnRate + averageFER*MESH%Fault%geoSurfaces(iFace)
     ENDDO
     !
     ! Write output
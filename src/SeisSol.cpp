@@ -51,11 +51,13 @@
 #endif // _OPENMP
 
 #include "utils/args.h"
+#include "utils/env.h"
 
 #include "SeisSol.h"
 #include "Modules/Modules.h"
 #include "Parallel/MPI.h"
 #include "Parallel/Pin.h"
+#include "Monitoring/Roofline.hpp"
 
 // Autogenerated file
 #include "version.h"
@@ -70,7 +72,7 @@ bool seissol::SeisSol::init(int argc, char* argv[])
 #ifdef USE_COMM_THREAD
 	MPI::mpi.requireThreadsafe();
 #endif // USE_COMM_THREAD
-	if (async::Config::mode() != async::SYNC)
+	if (async::Config::mode() != async::SYNC || utils::Env::get<bool>("SEISSOL_CHECKPOINT_ASYNC", false))
 		MPI::mpi.requireThreadsafe();
 
 #ifdef USE_ASAGI
@@ -172,7 +174,13 @@ bool seissol::SeisSol::init(int argc, char* argv[])
   if (!m_asyncIO.init())
 	  return false;
 
+  // after the I/O ranks have been split off
+  monitoring::measureMachineBalance();
+  m_metricsExporter.init();
+  m_ensemble.init();
+
   m_parameterFile = args.getAdditionalArgument("file", "PARAMETER.par");
+  m_setupCache.init();
   m_memoryManager->initialize();
   return true;
 }
@@ -60,6 +60,9 @@
 #include "ResultWriter/FaultWriter.h"
 
 #include "ResultWriter/AnalysisWriter.h"
+#include "Monitoring/Metrics.hpp"
+#include "Initializer/Ensemble.h"
+#include "Initializer/SetupCache.h"
 #include <memory>
 
 #include "Parallel/Pin.h"
@@ -135,6 +138,15 @@ private:
   //! Receiver writer module
   writer::ReceiverWriter m_receiverWriter;
 
+  //! Runtime metrics module
+  monitoring::MetricsExporter m_metricsExporter;
+
+  //! Per-member inputs of fused simulations
+  initializers::Ensemble m_ensemble;
+
+  //! Cache of setup results
+  initializers::SetupCache m_setupCache;
+
 
 private:
 	/**
@@ -248,6 +260,30 @@ public:
 		return m_receiverWriter;
 	}
 
+	/**
+	 * Get the runtime metrics module
+	 */
+	monitoring::MetricsExporter& metricsExporter()
+	{
+		return m_metricsExporter;
+	}
+
+	/**
+	 * Get the description of the members of fused simulations
+	 */
+	initializers::Ensemble const& ensemble() const
+	{
+		return m_ensemble;
+	}
+
+	/**
+	 * Get the cache of setup results
+	 */
+	initializers::SetupCache& setupCache()
+	{
+		return m_setupCache;
+	}
+
 	/**
 	 * Set the mesh reader
 	 */
@@ -39,6 +39,7 @@
 
 #include "FreeSurfaceIntegrator.h"
 
+#include <Initializer/Ensemble.h>
 #include <Initializer/MemoryAllocator.h>
 #include <Initializer/MemoryManager.h>
 #include <Kernels/common.hpp>
@@ -106,6 +107,16 @@ void seissol::solver::FreeSurfaceIntegrator::initialize(  unsigned maxRefinement
 void seissol::solver::FreeSurfaceIntegrator::calculateOutput()
 {
   unsigned offset = 0;
+
+  // subTriangleDofs has the shape (member, sub triangle, component) for fused simulations
+#ifdef MULTIPLE_SIMULATIONS
+  unsigned memberStride = tensor::subTriangleDofs::size(triRefiner.maxDepth) / (FREESURFACE_NUMBER_OF_COMPONENTS * numberOfSubTriangles);
+  unsigned componentStride = memberStride * numberOfSubTriangles;
+#else
+  unsigned memberStride = 1;
+  unsigned componentStride = numberOfAlignedSubTriangles;
+#endif
+
   seissol::initializers::LayerMask ghostMask(Ghost);
   for (auto surfaceLayer = surfaceLtsTree.beginLeaf(ghostMask);
        surfaceLayer != surfaceLtsTree.endLeaf(); ++surfaceLayer) {
@@ -115,7 +126,7 @@ void seissol::solver::FreeSurfaceIntegrator::calculateOutput()
     auto boundaryMapping = surfaceLayer->var(surfaceLts.boundaryMapping);
 
 #ifdef _OPENMP
-    #pragma omp parallel for schedule(static) default(none) shared(offset, surfaceLayer, dofs, boundaryMapping, displacementDofs, side)
+    #pragma omp parallel for schedule(static) default(none) shared(offset, surfaceLayer, dofs, boundaryMapping, displacementDofs, side, memberStride, componentStride)
 #endif // _OPENMP
     for (unsigned face = 0; face < surfaceLayer->getNumberOfCells(); ++face) {
       real subTriangleDofs[tensor::subTriangleDofs::size(FREESURFACE_MAX_REFINEMENT)] __attribute__((aligned(ALIGNMENT)));
@@ -127,18 +138,19 @@ void seissol::solver::FreeSurfaceIntegrator::calculateOutput()
       vkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
       vkrnl.execute(triRefiner.maxDepth);
 
+      // the output of the members is stored one after another
       auto addOutput = [&] (real* output[FREESURFACE_NUMBER_OF_COMPONENTS]) {
         for (unsigned component = 0; component < FREESURFACE_NUMBER_OF_COMPONENTS; ++component) {
-          real* target = output[component] + offset + face * numberOfSubTriangles;
-          /// @yateto_todo fix for multiple simulations
-          real* source = subTriangleDofs + component * numberOfAlignedSubTriangles; 
-          for (unsigned subtri = 0; subtri < numberOfSubTriangles; ++subtri) {
-            target[subtri] = source[subtri];
-            if (!std::isfinite(source[subtri])) {
-              logError() << "Detected Inf/NaN in free surface output. Aborting.";
+          for (unsigned member = 0; member < seissol::initializers::Ensemble::NumberOfMembers; ++member) {
+            real* target = output[component] + member * totalNumberOfTriangles + offset + face * numberOfSubTriangles;
+            real* source = subTriangleDofs + component * componentStride + member;
+            for (unsigned subtri = 0; subtri < numberOfSubTriangles; ++subtri) {
+              target[subtri] = source[subtri * memberStride];
+              if (!std::isfinite(target[subtri])) {
+                logError() << "Detected Inf/NaN in free surface output. Aborting.";
+              }
             }
           }
-
         }
       };
 
@@ -292,6 +304,7 @@ void seissol::solver::FreeSurfaceIntegrator::initializeSurfaceLTSTree(  seissol:
   };
 
   surfaceLtsTree.setNumberOfTimeClusters(ltsTree->numChildren());
+  surfaceLtsTree.setMemoryTag("Free surface");
   surfaceLtsTree.fixate();
 
   totalNumberOfFreeSurfaces = 0;
@@ -326,9 +339,10 @@ void seissol::solver::FreeSurfaceIntegrator::initializeSurfaceLTSTree(  seissol:
   surfaceLtsTree.allocateVariables();
   surfaceLtsTree.touchVariables();
 
+  seissol::memory::ScopedMemoryTag memoryTag("Free surface/output");
   for (unsigned dim = 0; dim < FREESURFACE_NUMBER_OF_COMPONENTS; ++dim) {
-    velocities[dim]     = (real*) seissol::memory::allocate(totalNumberOfTriangles * sizeof(real), ALIGNMENT);
-    displacements[dim]  = (real*) seissol::memory::allocate(totalNumberOfTriangles * sizeof(real), ALIGNMENT);
+    velocities[dim]     = (real*) seissol::memory::allocate(seissol::initializers::Ensemble::NumberOfMembers * totalNumberOfTriangles * sizeof(real), ALIGNMENT);
+    displacements[dim]  = (real*) seissol::memory::allocate(seissol::initializers::Ensemble::NumberOfMembers * totalNumberOfTriangles * sizeof(real), ALIGNMENT);
   }
   locationFlags = std::vector<double>(totalNumberOfTriangles, 0.0);
 
@@ -42,11 +42,14 @@
 
 #include <cstddef>
 #include <cstring>
+#include <type_traits>
+#include <vector>
 
 #include "Interoperability.h"
 #include "time_stepping/TimeManager.h"
 #include "SeisSol.h"
 #include <Initializer/CellLocalMatrices.h>
+#include <Initializer/MemoryAllocator.h>
 #include <Initializer/InitialFieldProjection.h>
 #include <Initializer/ParameterDB.h>
 #include <Initializer/time_stepping/common.hpp>
@@ -77,6 +80,10 @@ extern "C" {
     e_interoperability.initializeClusteredLts( i_clustering, enableFreeSurfaceIntegration, usePlasticity );
   }
 
+  bool c_interoperability_isSetupStopped() {
+    return e_interoperability.isSetupStopped();
+  }
+
   void c_interoperability_initializeMemoryLayout(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity) {
     e_interoperability.initializeMemoryLayout(clustering, enableFreeSurfaceIntegration, usePlasticity);
   }
@@ -97,6 +104,11 @@ extern "C" {
   {
     e_interoperability.setInitialConditionType(type);
   }
+
+  void c_interoperability_accountMemory(char* tag, long long bytes)
+  {
+    seissol::memory::accountMemory(tag, bytes);
+  }
   
   void c_interoperability_setupNRFPointSources(char* nrfFileName)
   {
@@ -179,8 +191,8 @@ extern "C" {
     e_interoperability.initializeFault(modelFileName, gpwise, bndPoints, numberOfBndPoints);
   }
 
-  void c_interoperability_enableDynamicRupture() {
-    e_interoperability.enableDynamicRupture();
+  void c_interoperability_enableDynamicRupture( int frictionLaw ) {
+    e_interoperability.enableDynamicRupture( frictionLaw );
   }
 
   void c_interoperability_setMaterial( int    i_meshId,
@@ -370,7 +382,7 @@ void c_interoperability_report_device_memory_status() {
  * C++ functions
  */
 seissol::Interoperability::Interoperability() :
-  m_initialConditionType(),  m_domain(nullptr), m_ltsTree(nullptr), m_lts(nullptr), m_ltsFaceToMeshFace(nullptr) // reset domain pointer
+  m_initialConditionType(),  m_domain(nullptr), m_ltsTree(nullptr), m_lts(nullptr), m_ltsFaceToMeshFace(nullptr), m_setupStopped(false), m_frictionLaw(-1) // reset domain pointer
 {
 }
 
@@ -439,15 +451,21 @@ void seissol::Interoperability::initializeClusteredLts(int clustering,
                                                                       numberOfDRCopyFaces,
                                                                       numberOfDRInteriorFaces );
 
-  seissol::SeisSol::main.getMemoryManager().fixateLtsTree(m_timeStepping,
-                                                          m_meshStructure,
-                                                          numberOfDRCopyFaces,
-                                                          numberOfDRInteriorFaces,
-                                                          usePlasticity);
+  const bool allocated = seissol::SeisSol::main.getMemoryManager().fixateLtsTree(m_timeStepping,
+                                                                                 m_meshStructure,
+                                                                                 numberOfDRCopyFaces,
+                                                                                 numberOfDRInteriorFaces,
+                                                                                 usePlasticity);
 
   delete[] numberOfDRCopyFaces;
   delete[] numberOfDRInteriorFaces;
 
+  if (!allocated) {
+    // memory dry run, the driver skips the remaining setup and the simulation
+    m_setupStopped = true;
+    return;
+  }
+
   m_ltsTree = seissol::SeisSol::main.getMemoryManager().getLtsTree();
   m_lts = seissol::SeisSol::main.getMemoryManager().getLts();
 
@@ -564,6 +582,28 @@ void seissol::Interoperability::initializeModel(  char*   materialFileName,
   
   //first initialize the (visco-)elastic part
   auto nElements = seissol::SeisSol::main.meshReader().getElements().size();
+
+  // the easi queries are skipped if a previous run of the same configuration cached the results
+  auto& setupCache = seissol::SeisSol::main.setupCache();
+  setupCache.addEasiFile(materialFileName);
+  setupCache.addValue(anelasticity);
+  setupCache.addValue(plasticity);
+  setupCache.addValue(anisotropy);
+  setupCache.addValue(poroelasticity);
+  const std::size_t numMaterialVals = anisotropy ? 22 : (poroelasticity ? 10 : (anelasticity ? 5 : 3));
+  std::vector<seissol::initializers::SetupCache::Block> cachedModel{
+    {materialVal, numMaterialVals * nElements * sizeof(double)},
+    {waveSpeeds, 3 * nElements * sizeof(double)}};
+  if (plasticity) {
+    cachedModel.push_back({bulkFriction, nElements * sizeof(double)});
+    cachedModel.push_back({plastCo, nElements * sizeof(double)});
+    cachedModel.push_back({iniStress, 6 * nElements * sizeof(double)});
+  }
+  if (setupCache.read("model", cachedModel)) {
+    logInfo(seissol::MPI::mpi.rank()) << "Material parameters restored from the setup cache.";
+    return;
+  }
+
   seissol::initializers::ElementBarycentreGenerator queryGen(seissol::SeisSol::main.meshReader());
   auto calcWaveSpeeds = [&] (seissol::model::Material* material, int pos) {
     waveSpeeds[pos] = material->getMaxWaveSpeed();
@@ -669,6 +709,8 @@ void seissol::Interoperability::initializeModel(  char*   materialFileName,
       }
     } 
   }
+
+  setupCache.write("model", cachedModel);
 }
 
 void seissol::Interoperability::fitAttenuation( double rho,
@@ -691,6 +733,9 @@ void seissol::Interoperability::initializeFault( char*   modelFileName,
                                                  double* bndPoints,
                                                  int     numberOfBndPoints )
 {
+  // the fault model is part of the setup cache key of all following steps
+  seissol::SeisSol::main.setupCache().addEasiFile(modelFileName);
+
   seissol::initializers::FaultParameterDB parameterDB;
   for (auto const& kv : m_faultParameters) {
     parameterDB.addParameter(kv.first, kv.second);
@@ -708,8 +753,19 @@ void seissol::Interoperability::initializeFault( char*   modelFileName,
   }
 }
 
-void seissol::Interoperability::enableDynamicRupture() {
+void seissol::Interoperability::enableDynamicRupture( int frictionLaw ) {
   // DR is always enabled if there are dynamic rupture cells
+  m_frictionLaw = frictionLaw;
+#ifdef MULTIPLE_SIMULATIONS
+  // the friction state is shared by the fused simulations, which would couple differing members
+  if (seissol::SeisSol::main.ensemble().isConfigured()) {
+    logError() << "Dynamic rupture is not supported with an ensemble description (SEISSOL_ENSEMBLE_FILE).";
+  }
+#endif
+}
+
+bool seissol::Interoperability::frictionLawAllowsLockedFaces() const {
+  return m_frictionLaw == 0 || m_frictionLaw == 2;
 }
 
 void seissol::Interoperability::setMaterial(int i_meshId, int i_side, double* i_materialVal, int i_numMaterialVals)
@@ -735,6 +791,14 @@ void seissol::Interoperability::setMaterial(int i_meshId, int i_side, double* i_
 #else 
   new(material) seissol::model::ElasticMaterial(i_materialVal, i_numMaterialVals);
 #endif
+
+  // the cell-local matrices depend on the final material parameters, e.g. after fitting the attenuation
+  auto& setupCache = seissol::SeisSol::main.setupCache();
+  if (setupCache.enabled()) {
+    setupCache.addValue(i_meshId);
+    setupCache.addValue(i_side);
+    setupCache.addData(i_materialVal, i_numMaterialVals * sizeof(double));
+  }
 }
 
 void seissol::Interoperability::setInitialLoading( int i_meshId, double *i_initialLoading ) {
@@ -770,11 +834,43 @@ void seissol::Interoperability::initializeCellLocalMatrices(bool usePlasticity)
 {
   // \todo Move this to some common initialization place
   MeshReader& meshReader = seissol::SeisSol::main.meshReader();
-  seissol::initializers::initializeCellLocalMatrices( meshReader,
-                                                      m_ltsTree,
-                                                      m_lts,
-                                                      &m_ltsLut,
-                                                      m_timeStepping);
+
+  // The cell-local matrices depend on the mesh and the material (added in setMaterial), on the
+  // order of the cells in the LTS tree, on the time step widths of the clusters and on the cluster of
+  // every cell.
+  static_assert(std::is_trivially_copyable_v<LocalIntegrationData>);
+  static_assert(std::is_trivially_copyable_v<NeighboringIntegrationData>);
+  auto& setupCache = seissol::SeisSol::main.setupCache();
+  if (setupCache.enabled()) {
+    setupCache.addData(m_ltsLut.getLtsToMeshLut(m_lts->material.mask),
+                       m_ltsTree->getNumberOfCells(m_lts->material.mask) * sizeof(unsigned));
+    setupCache.addData(m_timeStepping.globalCflTimeStepWidths,
+                       m_timeStepping.numberOfGlobalClusters * sizeof(double));
+    std::vector<unsigned> cellClusterIds;
+    cellClusterIds.reserve(m_ltsTree->getNumberOfCells(m_lts->material.mask));
+    for (unsigned cluster = 0; cluster < m_ltsTree->numChildren(); ++cluster) {
+      auto& clusterTree = m_ltsTree->child(cluster);
+      for (auto it = clusterTree.beginLeaf(m_lts->material.mask); it != clusterTree.endLeaf(); ++it) {
+        cellClusterIds.insert(cellClusterIds.end(), it->getNumberOfCells(), m_timeStepping.clusterIds[cluster]);
+      }
+    }
+    setupCache.addData(cellClusterIds.data(), cellClusterIds.size() * sizeof(unsigned));
+  }
+  std::vector<seissol::initializers::SetupCache::Block> cachedMatrices;
+  for (auto it = m_ltsTree->beginLeaf(m_lts->localIntegration.mask); it != m_ltsTree->endLeaf(); ++it) {
+    cachedMatrices.push_back({it->var(m_lts->localIntegration), it->getNumberOfCells() * sizeof(LocalIntegrationData)});
+    cachedMatrices.push_back({it->var(m_lts->neighboringIntegration), it->getNumberOfCells() * sizeof(NeighboringIntegrationData)});
+  }
+  if (setupCache.read("cell-local-matrices", cachedMatrices)) {
+    logInfo(seissol::MPI::mpi.rank()) << "Cell local matrices restored from the setup cache.";
+  } else {
+    seissol::initializers::initializeCellLocalMatrices( meshReader,
+                                                        m_ltsTree,
+                                                        m_lts,
+                                                        &m_ltsLut,
+                                                        m_timeStepping);
+    setupCache.write("cell-local-matrices", cachedMatrices);
+  }
 
   initializers::MemoryManager& memoryManager = seissol::SeisSol::main.getMemoryManager();
   seissol::initializers::initializeDynamicRuptureMatrices( meshReader,
@@ -917,7 +1013,7 @@ void seissol::Interoperability::initializeIO(
 	// Initialize wave field output
 	seissol::SeisSol::main.waveFieldWriter().init(
       numberOfQuantities, CONVERGENCE_ORDER,
-      NUMBER_OF_ALIGNED_BASIS_FUNCTIONS,
+      tensor::Q::size() / numberOfQuantities,
       seissol::SeisSol::main.meshReader(),
       LtsClusteringData,
       reinterpret_cast<const real*>(m_ltsTree->var(m_lts->dofs)),
@@ -926,6 +1022,8 @@ void seissol::Interoperability::initializeIO(
       m_ltsLut.getMeshToLtsLut(m_lts->dofs.mask)[0],
       refinement, outputMask, plasticityMask, outputRegionBounds,
       type);
+  seissol::SeisSol::main.timeManager().setWaveFieldSnapshots(seissol::SeisSol::main.waveFieldWriter(),
+                                                              m_ltsTree->getNumberOfCells(m_lts->dofs.mask));
 
 	// Initialize free surface output
 	seissol::SeisSol::main.freeSurfaceWriter().init(
@@ -1008,6 +1106,22 @@ void seissol::Interoperability::initInitialConditions()
   }
   logInfo(MPI::mpi.rank()) << "Using initial condition " << initialConditionDescription << ".";
 
+#ifdef MULTIPLE_SIMULATIONS
+  // scale the initial field of every fused simulation individually
+  auto const& ensemble = seissol::SeisSol::main.ensemble();
+  if (ensemble.isConfigured()) {
+    std::vector<std::shared_ptr<physics::InitialField>> fields;
+    for (auto& field : m_iniConds) {
+      fields.emplace_back(std::move(field));
+    }
+    m_iniConds.clear();
+    for (unsigned s = 0; s < MULTIPLE_SIMULATIONS; ++s) {
+      m_iniConds.emplace_back(new physics::ScaledField(fields[s % fields.size()],
+                                                       ensemble.member(s).initialFieldScale));
+    }
+  }
+#endif
+
 }
 
 void seissol::Interoperability::projectInitialField()
@@ -98,6 +98,12 @@ class seissol::Interoperability {
     //! Set of parameters that have to be initialized for dynamic rupture
     std::unordered_map<std::string, double*> m_faultParameters;
 
+    //! True if the setup stopped after the memory dry run
+    bool m_setupStopped;
+
+    //! friction law of dynamic rupture (EQN%FL), -1 if dynamic rupture is disabled
+    int m_frictionLaw;
+
     //! Vector of initial conditions
     std::vector<std::unique_ptr<physics::InitialField>> m_iniConds;
 
@@ -152,6 +158,14 @@ class seissol::Interoperability {
    void initializeClusteredLts(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity);
    void initializeMemoryLayout(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity);
 
+   /**
+    * Returns true if the setup stopped in initializeClusteredLts since this is a memory dry run
+    * (see seissol::memory::isMemoryDryRun). The remaining setup and the simulation are skipped.
+    **/
+   bool isSetupStopped() const {
+     return m_setupStopped;
+   }
+
 #if defined(USE_NETCDF) && !defined(NETCDF_PASSIVE)
    //! \todo Documentation
    void setupNRFPointSources( char const* fileName );
@@ -206,8 +220,17 @@ class seissol::Interoperability {
 
   /**
    * Enables dynamic rupture.
+   *
+   * @param frictionLaw friction law (EQN%FL).
    **/
-   void enableDynamicRupture();
+   void enableDynamicRupture( int frictionLaw );
+
+   /**
+    * Returns true if the friction law is stateless for a locked face without incoming waves:
+    * A zero Godunov state yields a zero imposed state and leaves the friction state unchanged.
+    * This holds for the time-independent laws without state variable (no fault, linear slip weakening).
+    **/
+   bool frictionLawAllowsLockedFaces() const;
 
    /**
     * Set material parameters for cell
@@ -44,10 +44,13 @@
 #include "Simulator.h"
 #include "SeisSol.h"
 #include "Interoperability.h"
+#include "Initializer/MemoryAllocator.h"
 #include "time_stepping/TimeManager.h"
 #include "Modules/Modules.h"
 #include "Monitoring/Stopwatch.h"
 #include "Monitoring/FlopCounter.hpp"
+#include "Monitoring/Roofline.hpp"
+#include "Monitoring/Trace.hpp"
 #include "ResultWriter/AnalysisWriter.h"
 
 extern seissol::Interoperability e_interoperability;
@@ -81,6 +84,9 @@ void seissol::Simulator::setCurrentTime( double i_currentTime ) {
 void seissol::Simulator::simulate() {
   SCOREP_USER_REGION( "simulate", SCOREP_USER_REGION_TYPE_FUNCTION )
 
+  // all memory of the setup has been allocated by now
+  seissol::memory::printMemoryFootprint();
+
   Stopwatch stopwatch;
   stopwatch.start();
 
@@ -102,9 +108,14 @@ void seissol::Simulator::simulate() {
   m_checkPointTime = m_currentTime;
   Modules::setSimulationStartTime(m_currentTime);
 
+  // the trace has to be set up before the communication thread records events
+  seissol::monitoring::Trace::initialize();
+
   // start the communication thread (if applicable)
   seissol::SeisSol::main.timeManager().startCommunicationThread();
 
+  seissol::SeisSol::main.metricsExporter().start(m_currentTime);
+
   // derive next synchronization time
   double upcomingTime = m_finalTime;
   // NOTE: This will not call the module specific implementation of the synchronization hook
@@ -127,14 +138,18 @@ void seissol::Simulator::simulate() {
     upcomingTime = m_finalTime;
 
     // Check all synchronization point hooks
+    Stopwatch syncStopwatch;
+    syncStopwatch.start();
     upcomingTime = std::min(upcomingTime, Modules::callSyncHook(m_currentTime, l_timeTolerance));
 
     // write checkpoint if required
     if( std::abs( m_currentTime - ( m_checkPointTime + m_checkPointInterval ) ) < l_timeTolerance ) {
+      seissol::monitoring::TraceScope trace("checkpoint");
       const unsigned int faultTimeStep = seissol::SeisSol::main.faultWriter().timestep();
       seissol::SeisSol::main.checkPointManager().write(m_currentTime, faultTimeStep);
       m_checkPointTime += m_checkPointInterval;
     }
+    seissol::SeisSol::main.metricsExporter().addSyncTime(syncStopwatch.stop());
     upcomingTime = std::min(upcomingTime, m_checkPointTime + m_checkPointInterval);
 
     printPerformance(stopwatch.split());
@@ -145,6 +160,9 @@ void seissol::Simulator::simulate() {
   // stop the communication thread (if applicable)
   seissol::SeisSol::main.timeManager().stopCommunicationThread();
 
+  seissol::monitoring::Trace::write();
+  seissol::SeisSol::main.metricsExporter().stop();
+
   double wallTime = stopwatch.split();
   logInfo(seissol::MPI::mpi.rank()) << "Elapsed time (via clock_gettime):" << wallTime << "seconds.";
 
@@ -153,5 +171,7 @@ void seissol::Simulator::simulate() {
   seissol::SeisSol::main.analysisWriter().printAnalysis(m_currentTime);
 
   printFlops();
+  seissol::monitoring::printRoofline(wallTime);
+  seissol::SeisSol::main.timeManager().printClusterPerformance();
 
 }
@@ -92,7 +92,6 @@ CONTAINS
                OptionalFields%sound(       MESH%nElem)    , &                    ! Allocate
                OptionalFields%mask(        MESH%nElem)    , &                    ! Allocate
                OptionalFields%dt_convectiv(MESH%nElem)    , &                    ! Allocate
-               OptionalFields%dtmin       (MESH%nElem)    , &                    ! Allocate
                STAT = allocStat                             )                    ! Allocate
     !                                                                            !
     IF (allocstat .NE. 0 ) THEN                                                  ! Error Handler
@@ -122,9 +121,6 @@ CONTAINS
     IF (allocated(OptionalFields%mask)) THEN           !
         DEALLOCATE(OptionalFields%mask)                 ! Deallocate
     END IF
-    if (allocated(OptionalFields%dtmin)) then
-        deallocate(OptionalFields%dtmin)
-    end if
 ! aheineck, @TODO, not referecned in the code, commented                                              !
 !    IF (ASSOCIATED(OptionalFields%dt_viscos)) THEN      !
 !        DEALLOCATE(OptionalFields%dt_viscos)            ! Deallocate
@@ -147,6 +143,7 @@ CONTAINS
     INTEGER                               :: iElem, iNeighbor, iSide
     INTEGER                               :: idxNeighbors(MESH%GlobalElemType)
     REAL                                  :: rho, C(6,6)
+    REAL, ALLOCATABLE                     :: dtmin(:)
     !--------------------------------------------------------------------------
     INTENT(IN)                            :: EQN, MESH, IO, MPI
     INTENT(INOUT)                         :: OptionalFields
@@ -199,18 +196,20 @@ CONTAINS
     !
     IF(DISC%Galerkin%DGMethod.EQ.3) THEN
       DISC%LocalDt(:) = OptionalFields%dt_convectiv(:)
+      ALLOCATE(dtmin(MESH%nElem))
       DO iElem = 1, MESH%nElem
-        OptionalFields%dtmin(iElem) = DISC%LocalDt(iElem)
+        dtmin(iElem) = DISC%LocalDt(iElem)
         DO iSide = 1, MESH%LocalElemType(iElem)
             iNeighbor = MESH%ELEM%SideNeighbor(iSide,iElem)
             IF(iNeighbor.LE.MESH%nElem) THEN
-                OptionalFields%dtmin(iElem) = MIN(OptionalFields%dtmin(iElem), DISC%LocalDt(iNeighbor))
+                dtmin(iElem) = MIN(dtmin(iElem), DISC%LocalDt(iNeighbor))
             ENDIF
         ENDDO
       ENDDO
       DO iElem = 1, MESH%nElem
-        DISC%LocalDt(iElem) = OptionalFields%dtmin(iElem)
+        DISC%LocalDt(iElem) = dtmin(iElem)
       ENDDO
+      DEALLOCATE(dtmin)
       !
       DO iElem = 1, MESH%nElem
         ! Match printtime if necessary
@@ -165,7 +165,7 @@ CONTAINS
 
     ! enable dynamic rupture if requested
     if( eqn%dr==1 ) then
-      call c_interoperability_enableDynamicRupture()
+      call c_interoperability_enableDynamicRupture( eqn%FL )
     endif
 
     ! check whether the device memory allocated at this point
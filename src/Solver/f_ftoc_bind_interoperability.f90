@@ -62,6 +62,15 @@ module f_ftoc_bind_interoperability
     end subroutine
   end interface
 
+  interface
+    subroutine c_interoperability_accountMemory( tag, bytes ) bind( C, name='c_interoperability_accountMemory' )
+      use iso_c_binding, only: c_char, c_long_long
+      implicit none
+      character(kind=c_char), dimension(*), intent(in) :: tag
+      integer(kind=c_long_long), value                 :: bytes
+    end subroutine
+  end interface
+
   interface 
    subroutine c_interoperability_setTravellingWaveInformation( origin, kVec, ampField ) bind( C, name='c_interoperability_setTravellingWaveInformation')
       use iso_c_binding, only: c_double
@@ -91,6 +100,13 @@ module f_ftoc_bind_interoperability
     end subroutine
   end interface
 
+  interface
+    logical(kind=c_bool) function c_interoperability_isSetupStopped() bind( C, name='c_interoperability_isSetupStopped' )
+      use iso_c_binding, only: c_bool
+      implicit none
+    end function
+  end interface
+
   interface
     subroutine c_interoperability_initializeMemoryLayout(clustering, enableFreeSurfaceIntegration, usePlasticity) bind( C, name='c_interoperability_initializeMemoryLayout' )
       use iso_c_binding
@@ -260,7 +276,10 @@ module f_ftoc_bind_interoperability
   end interface
 
   interface c_interoperability_enableDynamicRupture
-    subroutine c_interoperability_enableDynamicRupture() bind( C, name='c_interoperability_enableDynamicRupture' )
+    subroutine c_interoperability_enableDynamicRupture( frictionLaw ) bind( C, name='c_interoperability_enableDynamicRupture' )
+      use iso_c_binding
+      implicit none
+      integer(kind=c_int), value :: frictionLaw
     end subroutine
   end interface
 
@@ -0,0 +1,188 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2026, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Per-layer work lists of the cells with nodal boundary conditions.
+ **/
+
+#include "BoundaryFaceLists.h"
+
+#include <Initializer/MemoryAllocator.h>
+#include <Initializer/MemoryManager.h>
+#include "utils/logger.h"
+
+#include <cassert>
+
+#include <yateto.h>
+
+seissol::time_stepping::BoundaryFaceLists::~BoundaryFaceLists() {
+  seissol::memory::free(m_timeIntegrated);
+  seissol::memory::free(m_averageDisplacements);
+  seissol::memory::free(m_derivatives);
+}
+
+void seissol::time_stepping::BoundaryFaceLists::initialize( unsigned                         numberOfCells,
+                                                            CellLocalInformation const*      cellInformation,
+                                                            CellBoundaryMapping const      (*boundaryMapping)[4],
+                                                            CellMaterialData const*          material,
+                                                            real* const*                     derivatives,
+                                                            real* const                    (*faceDisplacements)[4] ) {
+  assert(!m_initialized);
+
+  m_boundaryCellIds.assign(numberOfCells, NoBoundaryCell);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    bool hasBoundary = false;
+    for (unsigned face = 0; face < 4; ++face) {
+      hasBoundary |= seissol::initializers::requiresNodalFlux(cellInformation[cell].faceTypes[face]);
+    }
+
+    if (hasBoundary) {
+      m_boundaryCellIds[cell] = m_boundaryCells.size();
+      m_boundaryCells.push_back(cell);
+    } else {
+      m_regularCells.push_back(cell);
+    }
+  }
+
+  m_analyticalNodes.resize(4 * m_boundaryCells.size());
+  unsigned numberOfGravityCellsWithoutDerivatives = 0;
+  for (unsigned boundaryCell = 0; boundaryCell < m_boundaryCells.size(); ++boundaryCell) {
+    const unsigned cell = m_boundaryCells[boundaryCell];
+    bool hasFreeSurfaceGravity = false, hasDirichlet = false, hasAnalytical = false;
+    for (unsigned face = 0; face < 4; ++face) {
+      switch (cellInformation[cell].faceTypes[face]) {
+      case FaceType::freeSurfaceGravity:
+        hasFreeSurfaceGravity = true;
+        break;
+      case FaceType::dirichlet:
+        hasDirichlet = true;
+        break;
+      case FaceType::analytical:
+        {
+        hasAnalytical = true;
+        const real* nodes = boundaryMapping[cell][face].nodes;
+        assert(nodes != nullptr);
+        auto& faceNodes = m_analyticalNodes[4 * boundaryCell + face];
+        faceNodes.resize(tensor::INodal::Shape[0]);
+        for (unsigned node = 0; node < faceNodes.size(); ++node) {
+          faceNodes[node] = {nodes[3*node], nodes[3*node+1], nodes[3*node+2]};
+        }
+        break;
+        }
+      default:
+        break;
+      }
+    }
+
+    // a cell appears at most once per list, hence the cells of a list may be processed in parallel
+    if (hasFreeSurfaceGravity) {
+      m_freeSurfaceGravityCells.push_back(boundaryCell);
+      if (derivatives[cell] == nullptr) {
+        ++numberOfGravityCellsWithoutDerivatives;
+      }
+    }
+    if (hasDirichlet) {
+      m_dirichletCells.push_back(boundaryCell);
+    }
+    if (hasAnalytical) {
+      m_analyticalCells.push_back(boundaryCell);
+    }
+  }
+
+  seissol::memory::ScopedMemoryTag memoryTag("Boundary");
+  if (!m_boundaryCells.empty()) {
+    m_timeIntegrated = static_cast<real*>(seissol::memory::allocate(m_boundaryCells.size() * tensor::I::size() * sizeof(real), ALIGNMENT));
+  }
+
+  // the gravity faces need the derivatives after the ADER step of all cells of the layer
+  constexpr std::size_t derivativesSize = yateto::computeFamilySize<tensor::dQ>();
+  if (numberOfGravityCellsWithoutDerivatives > 0) {
+    m_derivatives = static_cast<real*>(seissol::memory::allocate(numberOfGravityCellsWithoutDerivatives * derivativesSize * sizeof(real), ALIGNMENT));
+  }
+  m_derivativesScratch.assign(m_boundaryCells.size(), nullptr);
+
+  unsigned numberOfScratchDerivatives = 0;
+  for (unsigned boundaryCell : m_freeSurfaceGravityCells) {
+    const unsigned cell = m_boundaryCells[boundaryCell];
+    real* cellDerivatives = derivatives[cell];
+    if (cellDerivatives == nullptr) {
+      cellDerivatives = m_derivatives + numberOfScratchDerivatives * derivativesSize;
+      m_derivativesScratch[boundaryCell] = cellDerivatives;
+      ++numberOfScratchDerivatives;
+    }
+
+    m_gravityFaceOffsets.push_back(m_gravityFaces.size());
+    for (unsigned face = 0; face < 4; ++face) {
+      if (cellInformation[cell].faceTypes[face] == FaceType::freeSurfaceGravity) {
+        if (faceDisplacements[cell][face] == nullptr) {
+          logError() << "Missing face displacements of a face with gravitational free surface boundary condition.";
+        }
+        m_gravityDisplacements.push_back(faceDisplacements[cell][face]);
+        m_gravityFaces.push_back(GravitationalFreeSurfaceBc::prepareFace(face,
+                                                                         boundaryMapping[cell][face],
+                                                                         cellDerivatives,
+                                                                         material[cell]));
+      }
+    }
+  }
+  m_gravityFaceOffsets.push_back(m_gravityFaces.size());
+
+  // MemoryManager::deriveFaceDisplacementsBucket places the gravity faces first, in the order of the cells
+  for (unsigned gravityFace = 1; gravityFace < m_gravityDisplacements.size(); ++gravityFace) {
+    if (m_gravityDisplacements[gravityFace] != m_gravityDisplacements[0] + gravityFace * tensor::faceDisplacement::size()) {
+      m_contiguousGravityDisplacements = false;
+      break;
+    }
+  }
+  if (!m_contiguousGravityDisplacements) {
+    logWarning() << "The displacements of the gravity faces of a layer are not contiguous, falling back to the integration face by face.";
+  }
+
+  if (!m_gravityFaces.empty()) {
+    m_averageDisplacements = static_cast<real*>(seissol::memory::allocate(m_gravityFaces.size() * tensor::averageNormalDisplacement::size() * sizeof(real), ALIGNMENT));
+  }
+
+  m_initialized = true;
+}
+
+std::vector<unsigned> const& seissol::time_stepping::BoundaryFaceLists::cells(FaceType faceType) const {
+  switch (faceType) {
+  case FaceType::freeSurfaceGravity:
+    return m_freeSurfaceGravityCells;
+  case FaceType::dirichlet:
+    return m_dirichletCells;
+  default:
+    assert(faceType == FaceType::analytical);
+    return m_analyticalCells;
+  }
+}
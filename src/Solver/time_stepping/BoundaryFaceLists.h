@@ -0,0 +1,196 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2026, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Per-layer work lists of the cells with nodal boundary conditions.
+ **/
+
+#ifndef BOUNDARYFACELISTS_H_
+#define BOUNDARYFACELISTS_H_
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#include <Initializer/typedefs.hpp>
+#include <generated_code/tensor.h>
+#include "Equations/elastic/Kernels/GravitationalFreeSurfaceBC.h"
+
+namespace seissol {
+  namespace time_stepping {
+    class BoundaryFaceLists;
+  }
+}
+
+/**
+ * Splits a layer into regular cells and cells with at least one face which requires a nodal
+ * boundary condition (free surface with gravity, Dirichlet or analytical). The local integration
+ * of the regular cells runs without any boundary condition, the boundary conditions are evaluated
+ * afterwards in a separate pass per face type on the persistent time integrated DOFs of the cells.
+ **/
+class seissol::time_stepping::BoundaryFaceLists {
+  private:
+    //! cells without nodal boundary conditions
+    std::vector<unsigned> m_regularCells;
+
+    //! cells with at least one nodal boundary condition
+    std::vector<unsigned> m_boundaryCells;
+
+    //! position of every cell in m_boundaryCells or NoBoundaryCell
+    std::vector<unsigned> m_boundaryCellIds;
+
+    //! positions in m_boundaryCells of the cells with at least one face of the respective type
+    std::vector<unsigned> m_freeSurfaceGravityCells;
+    std::vector<unsigned> m_dirichletCells;
+    std::vector<unsigned> m_analyticalCells;
+
+    //! nodes of the analytical faces in global coordinates (4 entries per boundary cell)
+    std::vector<std::vector<std::array<double, 3>>> m_analyticalNodes;
+
+    //! faces with gravitational free surface boundary condition in the order of the cells
+    std::vector<GravityFace> m_gravityFaces;
+
+    //! first gravity face of every entry of m_freeSurfaceGravityCells (CSR format)
+    std::vector<unsigned> m_gravityFaceOffsets;
+
+    //! displacements of the gravity faces, which come first in the displacement bucket of the layer
+    std::vector<real*> m_gravityDisplacements;
+
+    //! true if the displacements of the gravity faces are stored contiguously in the order of m_gravityFaces
+    bool m_contiguousGravityDisplacements = true;
+
+    //! time integrated DOFs of the boundary cells
+    real* m_timeIntegrated = nullptr;
+
+    //! average normal displacements at the nodes of the gravity faces
+    real* m_averageDisplacements = nullptr;
+
+    //! time derivatives of the gravity cells which do not store their derivatives
+    real* m_derivatives = nullptr;
+    std::vector<real*> m_derivativesScratch;
+
+    bool m_initialized = false;
+
+  public:
+    static constexpr unsigned NoBoundaryCell = std::numeric_limits<unsigned>::max();
+
+    BoundaryFaceLists() = default;
+    BoundaryFaceLists(BoundaryFaceLists const&) = delete;
+    BoundaryFaceLists& operator=(BoundaryFaceLists const&) = delete;
+
+    ~BoundaryFaceLists();
+
+    /**
+     * Derives the work lists of a layer, copies the nodes of the analytical faces and
+     * precomputes the data of the gravity faces.
+     *
+     * @param numberOfCells number of cells in the layer.
+     * @param cellInformation cell local information of the layer.
+     * @param boundaryMapping boundary mappings of the layer.
+     * @param material material of the layer.
+     * @param derivatives time derivatives of the layer.
+     * @param faceDisplacements face displacements of the layer.
+     **/
+    void initialize( unsigned                         numberOfCells,
+                     CellLocalInformation const*      cellInformation,
+                     CellBoundaryMapping const      (*boundaryMapping)[4],
+                     CellMaterialData const*          material,
+                     real* const*                     derivatives,
+                     real* const                    (*faceDisplacements)[4] );
+
+    bool isInitialized() const {
+      return m_initialized;
+    }
+
+    std::vector<unsigned> const& regularCells() const {
+      return m_regularCells;
+    }
+
+    std::vector<unsigned> const& boundaryCells() const {
+      return m_boundaryCells;
+    }
+
+    unsigned boundaryCellId(unsigned cell) const {
+      return m_boundaryCellIds[cell];
+    }
+
+    /**
+     * @return positions in boundaryCells() of the cells with at least one face of the given type.
+     **/
+    std::vector<unsigned> const& cells(FaceType faceType) const;
+
+    std::vector<std::array<double, 3>> const& analyticalNodes(unsigned boundaryCell, unsigned face) const {
+      return m_analyticalNodes[4 * boundaryCell + face];
+    }
+
+    real* timeIntegrated(unsigned boundaryCell) {
+      return m_timeIntegrated + boundaryCell * tensor::I::size();
+    }
+
+    /**
+     * @return derivatives to be used in the ADER step of a boundary cell, nullptr if the
+     *         derivatives of the cell are not required later on.
+     **/
+    real* derivativesScratch(unsigned boundaryCell) {
+      return m_derivativesScratch[boundaryCell];
+    }
+
+    std::vector<GravityFace> const& gravityFaces() const {
+      return m_gravityFaces;
+    }
+
+    /**
+     * @return first gravity face of the index-th entry of cells(FaceType::freeSurfaceGravity).
+     **/
+    unsigned gravityFaceOffset(unsigned index) const {
+      return m_gravityFaceOffsets[index];
+    }
+
+    /**
+     * @return true if the displacements of all gravity faces are stored contiguously, such that the
+     *         faces may be integrated in batches. Otherwise, they have to be integrated face by face.
+     **/
+    bool hasContiguousGravityDisplacements() const {
+      return m_contiguousGravityDisplacements;
+    }
+
+    real* gravityDisplacements(unsigned gravityFace) {
+      return m_gravityDisplacements[gravityFace];
+    }
+
+    real* averageDisplacement(unsigned gravityFace) {
+      return m_averageDisplacements + gravityFace * tensor::averageNormalDisplacement::size();
+    }
+};
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2026, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Dynamic rupture faces which are locked without incoming waves.
+ **/
+
+#include "LockedDrFaces.h"
+
+#include <algorithm>
+
+#include <yateto.h>
+
+namespace {
+  bool isZero(real const* data, unsigned size) {
+    return std::all_of(data, data + size, [](real value) { return value == 0.0; });
+  }
+}
+
+void seissol::time_stepping::LockedDrFaces::update( unsigned           numberOfFaces,
+                                                    real const* const* timeDerivativePlus,
+                                                    real const* const* timeDerivativeMinus,
+                                                    bool               includeLocked ) {
+  m_locked.resize(numberOfFaces, 0);
+  constexpr unsigned derivativesSize = yateto::computeFamilySize<tensor::dQ>();
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned face = 0; face < numberOfFaces; ++face) {
+    if (m_locked[face]) {
+      m_locked[face] = isZero(timeDerivativePlus[face], derivativesSize) && isZero(timeDerivativeMinus[face], derivativesSize);
+    }
+  }
+
+  m_activeFaces.clear();
+  for (unsigned face = 0; face < numberOfFaces; ++face) {
+    if (!m_locked[face] || includeLocked) {
+      m_activeFaces.push_back(face);
+    }
+  }
+}
+
+bool seissol::time_stepping::LockedDrFaces::classify( unsigned    face,
+                                                      real const  QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                                                      real const  QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                                                      real const* imposedStatePlus,
+                                                      real const* imposedStateMinus ) {
+  const bool locked = isZero(&QInterpolatedPlus[0][0], CONVERGENCE_ORDER * tensor::QInterpolated::size())
+                      && isZero(&QInterpolatedMinus[0][0], CONVERGENCE_ORDER * tensor::QInterpolated::size())
+                      && isZero(imposedStatePlus, tensor::QInterpolated::size())
+                      && isZero(imposedStateMinus, tensor::QInterpolated::size());
+  m_locked[face] = locked;
+  return locked;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2026, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Dynamic rupture faces which are locked without incoming waves.
+ **/
+
+#ifndef LOCKEDDRFACES_H_
+#define LOCKEDDRFACES_H_
+
+#include <vector>
+
+#include <Initializer/typedefs.hpp>
+#include <generated_code/tensor.h>
+
+namespace seissol {
+  namespace time_stepping {
+    class LockedDrFaces;
+  }
+}
+
+/**
+ * Tracks the dynamic rupture faces of a layer whose friction law may be skipped.
+ * A face is locked if its last evaluation had a zero Godunov state on both sides and imposed a zero state.
+ * For the time-independent friction laws without state variable, such an evaluation is a fixed point:
+ * The face stays locked as long as the time derivatives of both sides are zero.
+ **/
+class seissol::time_stepping::LockedDrFaces {
+  private:
+    //! 1 if the last friction law evaluation of a face had zero input and output
+    std::vector<char> m_locked;
+
+    //! faces which require the friction law in the current step
+    std::vector<unsigned> m_activeFaces;
+
+  public:
+    /**
+     * Unlocks the faces with nonzero time derivatives at a side and derives the faces which require the friction law.
+     *
+     * @param numberOfFaces number of faces in the layer.
+     * @param timeDerivativePlus time derivatives of the plus sides.
+     * @param timeDerivativeMinus time derivatives of the minus sides.
+     * @param includeLocked true if locked faces require the friction law as well (verification of the classification).
+     **/
+    void update( unsigned           numberOfFaces,
+                 real const* const* timeDerivativePlus,
+                 real const* const* timeDerivativeMinus,
+                 bool               includeLocked );
+
+    bool isLocked(unsigned face) const {
+      return m_locked[face] != 0;
+    }
+
+    std::vector<unsigned> const& activeFaces() const {
+      return m_activeFaces;
+    }
+
+    /**
+     * Classifies a face after the evaluation of the friction law.
+     *
+     * @return true if the face is locked.
+     **/
+    bool classify( unsigned    face,
+                   real const  QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                   real const  QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                   real const* imposedStatePlus,
+                   real const* imposedStateMinus );
+};
+
+#endif
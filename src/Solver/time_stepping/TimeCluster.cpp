@@ -82,7 +82,11 @@
 #include <Kernels/TimeCommon.h>
 #include <Kernels/DynamicRupture.h>
 #include <Monitoring/FlopCounter.hpp>
+#include <Monitoring/Trace.hpp>
+#include <ResultWriter/WaveFieldSnapshots.h>
+#include <utils/env.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
@@ -94,6 +98,18 @@ extern volatile unsigned int* volatile g_handleSends;
 //! fortran interoperability
 extern seissol::Interoperability e_interoperability;
 
+#ifdef USE_MPI
+namespace {
+//! records the span from posting the requests of a message queue until all of them completed
+void traceCommunication(char const* name, std::int64_t& postTime, int cluster, bool complete) {
+  if (complete && postTime >= 0) {
+    seissol::monitoring::Trace::record(name, postTime, seissol::monitoring::Trace::now(), cluster);
+    postTime = -1;
+  }
+}
+} // namespace
+#endif
+
 seissol::time_stepping::TimeCluster::TimeCluster( unsigned int                   i_clusterId,
                                                   unsigned int                   i_globalClusterId,
                                                   bool usePlasticity,
@@ -118,12 +134,13 @@ seissol::time_stepping::TimeCluster::TimeCluster( unsigned int
  m_lts(                     i_lts                      ),
  m_dynRup(                  i_dynRup                   ),
  // cells
- m_cellToPointSources(      NULL                       ),
- m_numberOfCellToPointSourcesMappings(0                ),
+ m_pointSourceMapping(      NULL                       ),
  m_pointSources(            NULL                       ),
+ m_nextPointSourceMapping(  0                          ),
 
  m_loopStatistics(          i_loopStatistics           ),
- m_receiverCluster(          nullptr                   )
+ m_receiverCluster(          nullptr                   ),
+ m_waveFieldSnapshots(       nullptr                   )
 {
     // assert all pointers are valid
     assert( m_meshStructure                            != nullptr );
@@ -147,6 +164,10 @@ seissol::time_stepping::TimeCluster::TimeCluster( unsigned int
   m_receiverTime                  = 0;
   m_timeStepWidth                 = 0;
   m_subTimeStart                  = 0;
+  for( unsigned int l_difference = 0; l_difference < MaximumLtsClusterDifference-1; l_difference++ ) {
+    m_farSubTimeStarts[l_difference]   = 0;
+    m_farResetLtsBuffers[l_difference] = false;
+  }
   m_numberOfFullUpdates           = 0;
   m_fullUpdateTime                = 0;
   m_predictionTime                = 0;
@@ -162,10 +183,36 @@ seissol::time_stepping::TimeCluster::TimeCluster( unsigned int
   m_dynamicRuptureKernel.setGlobalData(i_globalData);
 
   computeFlops();
+  computeBytes();
+
+#ifndef ACL_DEVICE
+  if (usePlasticity) {
+    m_plasticityBounds = seissol::kernels::Plasticity::computeNodalBounds(m_globalDataOnHost);
+    const unsigned maxLayerCells = std::max(i_clusterData->child<Copy>().getNumberOfCells(),
+                                            i_clusterData->child<Interior>().getNumberOfCells());
+    m_plasticityMayYield.resize(maxLayerCells);
+    m_plasticityCandidates.resize(maxLayerCells);
+  }
+
+  m_skipLockedDrFaces = m_dynamicRuptureFaces && utils::Env::get<bool>("SEISSOL_DR_SKIP_LOCKED", false);
+  m_verifyLockedDrFaces = m_skipLockedDrFaces && utils::Env::get<bool>("SEISSOL_DR_VERIFY_LOCKED", false);
+
+  if (utils::Env::get<bool>("SEISSOL_FUSED_INTERIOR", false)) {
+    seissol::initializers::Layer& interior = i_clusterData->child<Interior>();
+    m_fusedInterior.initialize(interior.getNumberOfCells(),
+                               interior.var(m_lts->cellInformation),
+                               interior.var(m_lts->faceNeighbors),
+                               interior.var(m_lts->buffers),
+                               interior.var(m_lts->derivatives),
+                               utils::Env::get<unsigned>("SEISSOL_FUSED_TILE_SIZE", 64));
+    m_useFusedInterior = m_fusedInterior.numberOfFusedCells() > 0;
+  }
+#endif
 
   m_regionComputeLocalIntegration = m_loopStatistics->getRegion("computeLocalIntegration");
   m_regionComputeNeighboringIntegration = m_loopStatistics->getRegion("computeNeighboringIntegration");
   m_regionComputeDynamicRupture = m_loopStatistics->getRegion("computeDynamicRupture");
+  m_regionComputeFusedIntegration = m_loopStatistics->getRegion("computeFusedIntegration");
 }
 
 seissol::time_stepping::TimeCluster::~TimeCluster() {
@@ -174,13 +221,23 @@ seissol::time_stepping::TimeCluster::~TimeCluster() {
 #endif
 }
 
-void seissol::time_stepping::TimeCluster::setPointSources( sourceterm::CellToPointSourcesMapping const* i_cellToPointSources,
-                                                           unsigned i_numberOfCellToPointSourcesMappings,
+void seissol::time_stepping::TimeCluster::setPointSources( sourceterm::ClusterMapping const* i_pointSourceMapping,
                                                            sourceterm::PointSources const* i_pointSources )
 {
-  m_cellToPointSources = i_cellToPointSources;
-  m_numberOfCellToPointSourcesMappings = i_numberOfCellToPointSourcesMappings;
+  m_pointSourceMapping = i_pointSourceMapping;
   m_pointSources = i_pointSources;
+  m_nextPointSourceMapping = 0;
+  m_activePointSourceMappings.clear();
+  m_activePointSourceMappings.reserve(i_pointSourceMapping->numberOfMappings);
+
+  // moment scaling and rank-1 update per source, read and write of the DOFs per cell
+  const bool isNRF = (i_pointSources->mode == sourceterm::PointSources::NRF);
+  m_flops_nonZero[PointSource] = sourceterm::PointSources::TensorSize
+                                 + (isNRF ? kernel::sourceNRF::NonZeroFlops : kernel::sourceFSRM::NonZeroFlops);
+  m_flops_hardware[PointSource] = sourceterm::PointSources::TensorSize
+                                  + (isNRF ? kernel::sourceNRF::HardwareFlops : kernel::sourceFSRM::HardwareFlops);
+  m_bytes[PointSource] = sizeof(real) * (tensor::mInvJInvPhisAtSources::size() + sourceterm::PointSources::TensorSize);
+  m_bytes[PointSourceCell] = sizeof(real) * 2 * tensor::Q::size();
 }
 
 void seissol::time_stepping::TimeCluster::writeReceivers() {
@@ -191,6 +248,58 @@ void seissol::time_stepping::TimeCluster::writeReceivers() {
   }
 }
 
+void seissol::time_stepping::TimeCluster::writeWaveFieldSnapshots() {
+#ifndef ACL_DEVICE
+  SCOREP_USER_REGION( "writeWaveFieldSnapshots", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+  if (m_waveFieldSnapshots == nullptr) {
+    return;
+  }
+
+  const auto snapshots = m_waveFieldSnapshots->take(m_clusterId, m_fullUpdateTime + m_timeStepWidth);
+  if (snapshots.empty()) {
+    return;
+  }
+
+  seissol::monitoring::TraceScope trace("waveFieldSnapshots", m_globalClusterId);
+
+  // the position of a cell's DOFs in the tree is its position in the snapshots
+  const real* treeDofs = m_waveFieldSnapshots->dofs();
+
+  unsigned numberOfCells = 0;
+  for (auto* layer : {&m_clusterData->child<Copy>(), &m_clusterData->child<Interior>()}) {
+    kernels::LocalData::Loader loader;
+    loader.load(*m_lts, *layer);
+    kernels::LocalTmp tmp;
+
+#ifdef _OPENMP
+    #pragma omp parallel for private(tmp) schedule(static)
+#endif
+    for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
+      alignas(ALIGNMENT) real timeIntegrated[tensor::I::size()];
+      alignas(ALIGNMENT) real timeDerivatives[yateto::computeFamilySize<tensor::dQ>()];
+
+      auto data = loader.entry(cell);
+      m_timeKernel.computeAder(m_timeStepWidth, data, tmp, timeIntegrated, timeDerivatives);
+
+      const std::size_t offset = data.dofs - treeDofs;
+      for (auto const& snapshot : snapshots) {
+        m_timeKernel.computeTaylorExpansion(snapshot.time, m_fullUpdateTime, timeDerivatives, snapshot.dofs + offset);
+      }
+    }
+
+    numberOfCells += layer->getNumberOfCells();
+  }
+
+  unsigned aderNonZeroFlops, aderHardwareFlops;
+  long long taylorNonZeroFlops, taylorHardwareFlops;
+  m_timeKernel.flopsAder(aderNonZeroFlops, aderHardwareFlops);
+  m_timeKernel.flopsTaylorExpansion(taylorNonZeroFlops, taylorHardwareFlops);
+  g_SeisSolNonZeroFlopsOther += numberOfCells * (aderNonZeroFlops + snapshots.size() * taylorNonZeroFlops);
+  g_SeisSolHardwareFlopsOther += numberOfCells * (aderHardwareFlops + snapshots.size() * taylorHardwareFlops);
+#endif // ACL_DEVICE
+}
+
 void seissol::time_stepping::TimeCluster::computeSources() {
 #ifdef ACL_DEVICE
   device.api->putProfilingMark("computeSources", device::ProfilingColors::Blue);
@@ -199,36 +308,46 @@ void seissol::time_stepping::TimeCluster::computeSources() {
 
   // Return when point sources not initialised. This might happen if there
   // are no point sources on this rank.
-  if (m_numberOfCellToPointSourcesMappings != 0) {
+  if (m_pointSourceMapping != NULL && m_pointSourceMapping->numberOfMappings != 0) {
+    const double fromTime = m_fullUpdateTime;
+    const double toTime = m_fullUpdateTime + m_timeStepWidth;
+    sourceterm::ClusterMapping const& cm = *m_pointSourceMapping;
+
+    // activate mappings whose sources start before the end of the time step
+    while (m_nextPointSourceMapping < cm.numberOfMappings
+           && cm.mappingOnsetTime[cm.mappingsByOnset[m_nextPointSourceMapping]] < toTime) {
+      m_activePointSourceMappings.push_back(cm.mappingsByOnset[m_nextPointSourceMapping]);
+      ++m_nextPointSourceMapping;
+    }
+
+    // retire mappings whose sources have ended
+    m_activePointSourceMappings.erase(
+        std::remove_if(m_activePointSourceMappings.begin(), m_activePointSourceMappings.end(),
+                       [&](unsigned mapping) { return cm.mappingEndTime[mapping] <= fromTime; }),
+        m_activePointSourceMappings.end());
+
+    const unsigned numberOfActiveMappings = m_activePointSourceMappings.size();
 #ifdef _OPENMP
   #pragma omp parallel for schedule(static)
 #endif
-    for (unsigned mapping = 0; mapping < m_numberOfCellToPointSourcesMappings; ++mapping) {
-      unsigned startSource = m_cellToPointSources[mapping].pointSourcesOffset;
-      unsigned endSource = m_cellToPointSources[mapping].pointSourcesOffset + m_cellToPointSources[mapping].numberOfPointSources;
-      if (m_pointSources->mode == sourceterm::PointSources::NRF) {
-        for (unsigned source = startSource; source < endSource; ++source) {
-          sourceterm::addTimeIntegratedPointSourceNRF( m_pointSources->mInvJInvPhisAtSources[source],
-                                                       m_pointSources->tensor[source],
-                                                       m_pointSources->A[source],
-                                                       m_pointSources->stiffnessTensor[source],
-                                                       m_pointSources->slipRates[source],
-                                                       m_fullUpdateTime,
-                                                       m_fullUpdateTime + m_timeStepWidth,
-                                                       *m_cellToPointSources[mapping].dofs );
-        }
-      } else {
-        for (unsigned source = startSource; source < endSource; ++source) {
-  
-          sourceterm::addTimeIntegratedPointSourceFSRM( m_pointSources->mInvJInvPhisAtSources[source],
-                                                        m_pointSources->tensor[source],
-                                                        m_pointSources->slipRates[source][0],
-                                                        m_fullUpdateTime,
-                                                        m_fullUpdateTime + m_timeStepWidth,
-                                                        *m_cellToPointSources[mapping].dofs );
-        }
-      }
+    for (unsigned active = 0; active < numberOfActiveMappings; ++active) {
+      sourceterm::CellToPointSourcesMapping const& mapping = cm.cellToSources[m_activePointSourceMappings[active]];
+      sourceterm::addTimeIntegratedPointSources( *m_pointSources,
+                                                 mapping.pointSourcesOffset,
+                                                 mapping.numberOfPointSources,
+                                                 fromTime,
+                                                 toTime,
+                                                 *mapping.dofs );
+    }
+
+    long long numberOfActiveSources = 0;
+    for (unsigned active = 0; active < numberOfActiveMappings; ++active) {
+      numberOfActiveSources += cm.cellToSources[m_activePointSourceMappings[active]].numberOfPointSources;
     }
+    accountComputePart(PointSource, numberOfActiveSources,
+                       g_SeisSolNonZeroFlopsSource, g_SeisSolHardwareFlopsSource, g_SeisSolBytesSource);
+    accountComputePart(PointSourceCell, numberOfActiveMappings,
+                       g_SeisSolNonZeroFlopsSource, g_SeisSolHardwareFlopsSource, g_SeisSolBytesSource);
   }
 #ifdef ACL_DEVICE
   device.api->popLastProfilingMark();
@@ -238,6 +357,7 @@ void seissol::time_stepping::TimeCluster::computeSources() {
 #ifndef ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initializers::Layer&  layerData ) {
   SCOREP_USER_REGION( "computeDynamicRupture", SCOREP_USER_REGION_TYPE_FUNCTION )
+  seissol::monitoring::TraceScope trace("dynamicRupture", m_globalClusterId);
 
   m_loopStatistics->begin(m_regionComputeDynamicRupture);
 
@@ -252,12 +372,43 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
 
   alignas(ALIGNMENT) real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
   alignas(ALIGNMENT) real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
+  alignas(ALIGNMENT) real imposedStateSlower[tensor::QInterpolated::size()];
+
+  const unsigned numberOfFaces = layerData.getNumberOfCells();
+
+  // A locked face without incoming waves is a fixed point of the friction law: zero in, zero out, no change of state.
+  const bool skipLocked = m_skipLockedDrFaces && e_interoperability.frictionLawAllowsLockedFaces();
+  LockedDrFaces& lockedFaces = m_lockedDrFaces[(layerData.getLayerType() == Interior) ? 1 : 0];
+  std::vector<unsigned> const& activeFaces = lockedFaces.activeFaces();
 
+  if (skipLocked) {
+    lockedFaces.update(numberOfFaces, timeDerivativePlus, timeDerivativeMinus, m_verifyLockedDrFaces);
+
+    if (!m_verifyLockedDrFaces && m_resetLtsBuffers) {
 #ifdef _OPENMP
-  #pragma omp parallel for schedule(static) private(QInterpolatedPlus,QInterpolatedMinus)
+      #pragma omp parallel for schedule(static)
 #endif
-  for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
-    unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
+      for (unsigned face = 0; face < numberOfFaces; ++face) {
+        if (lockedFaces.isLocked(face) && (faceInformation[face].plusSideSlower || faceInformation[face].minusSideSlower)) {
+          // the slower side restarts its accumulation of the (zero) imposed state
+          real* imposedState = faceInformation[face].plusSideSlower ? imposedStatePlus[face] : imposedStateMinus[face];
+          std::fill_n(imposedState, tensor::QInterpolated::size(), static_cast<real>(0.0));
+        }
+      }
+    }
+  }
+
+  const unsigned numberOfActiveFaces = skipLocked ? activeFaces.size() : numberOfFaces;
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) private(QInterpolatedPlus,QInterpolatedMinus,imposedStateSlower)
+#endif
+  for (unsigned index = 0; index < numberOfActiveFaces; ++index) {
+    unsigned face = skipLocked ? activeFaces[index] : index;
+    unsigned prefetchFace = (index < numberOfActiveFaces-1) ? (skipLocked ? activeFaces[index+1] : index+1) : face;
+    // the derivatives of a side in the next slower cluster are expanded at the start of its time step
+    bool plusSideSlower = faceInformation[face].plusSideSlower;
+    bool minusSideSlower = faceInformation[face].minusSideSlower;
     m_dynamicRuptureKernel.spaceTimeInterpolation(  faceInformation[face],
                                                     m_globalDataOnHost,
                                                    &godunovData[face],
@@ -266,18 +417,37 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
                                                     QInterpolatedPlus,
                                                     QInterpolatedMinus,
                                                     timeDerivativePlus[prefetchFace],
-                                                    timeDerivativeMinus[prefetchFace] );
+                                                    timeDerivativeMinus[prefetchFace],
+                                                    plusSideSlower ? m_subTimeStart : 0.0,
+                                                    minusSideSlower ? m_subTimeStart : 0.0 );
 
+    real* facePlus = plusSideSlower ? imposedStateSlower : imposedStatePlus[face];
+    real* faceMinus = minusSideSlower ? imposedStateSlower : imposedStateMinus[face];
     e_interoperability.evaluateFrictionLaw( static_cast<int>(faceInformation[face].meshFace),
                                             QInterpolatedPlus,
                                             QInterpolatedMinus,
-                                            imposedStatePlus[face],
-                                            imposedStateMinus[face],
+                                            facePlus,
+                                            faceMinus,
                                             m_fullUpdateTime,
                                             m_dynamicRuptureKernel.timePoints,
                                             m_dynamicRuptureKernel.timeWeights,
                                             waveSpeedsPlus[face],
                                             waveSpeedsMinus[face] );
+
+    if (skipLocked) {
+      const bool wasLocked = lockedFaces.isLocked(face);
+      if (!lockedFaces.classify(face, QInterpolatedPlus, QInterpolatedMinus, facePlus, faceMinus) && m_verifyLockedDrFaces && wasLocked) {
+        logError() << "Dynamic rupture face" << faceInformation[face].meshFace << "was classified as locked, but the friction law changed its imposed state.";
+      }
+    }
+
+    // the slower side integrates the imposed state over all time steps of this cluster in its time step
+    if (plusSideSlower || minusSideSlower) {
+      real* imposedState = plusSideSlower ? imposedStatePlus[face] : imposedStateMinus[face];
+      for (unsigned i = 0; i < tensor::QInterpolated::size(); ++i) {
+        imposedState[i] = m_resetLtsBuffers ? imposedStateSlower[i] : imposedState[i] + imposedStateSlower[i];
+      }
+    }
   }
 
   m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells());
@@ -287,6 +457,7 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
 void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initializers::Layer&  layerData ) {
   device.api->putProfilingMark("computeDynamicRupture", device::ProfilingColors::Cyan);
   SCOREP_USER_REGION( "computeDynamicRupture", SCOREP_USER_REGION_TYPE_FUNCTION )
+  seissol::monitoring::TraceScope trace("dynamicRupture", m_globalClusterId);
 
   m_loopStatistics->begin(m_regionComputeDynamicRupture);
 
@@ -465,6 +636,8 @@ void seissol::time_stepping::TimeCluster::receiveGhostLayer(){
       m_receiveQueue.push_back( m_meshStructure->receiveRequests + l_region );
     }
   }
+
+  m_ghostReceivePostTime = seissol::monitoring::Trace::active() && !m_receiveQueue.empty() ? seissol::monitoring::Trace::now() : -1;
 }
 
 void seissol::time_stepping::TimeCluster::sendCopyLayer(){
@@ -489,6 +662,8 @@ void seissol::time_stepping::TimeCluster::sendCopyLayer(){
       m_sendQueue.push_back(m_meshStructure->sendRequests + l_region );
     }
   }
+
+  m_copySendPostTime = seissol::monitoring::Trace::active() && !m_sendQueue.empty() ? seissol::monitoring::Trace::now() : -1;
 }
 
 bool seissol::time_stepping::TimeCluster::testForGhostLayerReceives(){
@@ -516,6 +691,8 @@ bool seissol::time_stepping::TimeCluster::testForGhostLayerReceives(){
     else                   ++l_receive;
   }
 
+  traceCommunication("ghostLayerReceive", m_ghostReceivePostTime, m_globalClusterId, m_receiveQueue.empty());
+
   // return true if the communication is finished
   return m_receiveQueue.empty();
 #endif
@@ -545,6 +722,8 @@ bool seissol::time_stepping::TimeCluster::testForCopyLayerSends(){
     else                   ++l_send;
   }
 
+  traceCommunication("copyLayerSend", m_copySendPostTime, m_globalClusterId, m_sendQueue.empty());
+
   // return true if the communication is finished
   return m_sendQueue.empty();
 #endif
@@ -567,11 +746,12 @@ void seissol::time_stepping::TimeCluster::waitForInits() {
 #endif
 
 #ifndef ACL_DEVICE
-void seissol::time_stepping::TimeCluster::computeLocalIntegration( seissol::initializers::Layer&  i_layerData ) {
-  SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
-
-  m_loopStatistics->begin(m_regionComputeLocalIntegration);
-
+template<bool t_boundary>
+void seissol::time_stepping::TimeCluster::computeLocalIntegrationCell( seissol::initializers::Layer&  i_layerData,
+                                                                       kernels::LocalData::Loader&    loader,
+                                                                       kernels::LocalTmp&             tmp,
+                                                                       BoundaryFaceLists&             boundaryFaces,
+                                                                       unsigned                       l_cell ) {
   // local integration buffer
   real l_integrationBuffer[tensor::I::size()] __attribute__((aligned(ALIGNMENT)));
 
@@ -580,80 +760,253 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration( seissol::init
 
   real** buffers = i_layerData.var(m_lts->buffers);
   real** derivatives = i_layerData.var(m_lts->derivatives);
-  CellMaterialData* materialData = i_layerData.var(m_lts->material);
+
+  auto data = loader.entry(l_cell);
+  // overwrite cell buffer
+  // TODO: Integrate this step into the kernel
+
+  bool l_buffersProvided = (data.cellInformation.ltsSetup >> 8)%2 == 1; // buffers are provided
+  bool l_resetBuffers = l_buffersProvided && ( (data.cellInformation.ltsSetup >> 10) %2 == 0 || resetLtsBuffers( (data.cellInformation.ltsSetup >> 11) % 8 ) ); // they should be reset
+
+  const unsigned boundaryCell = t_boundary ? boundaryFaces.boundaryCellId(l_cell) : BoundaryFaceLists::NoBoundaryCell;
+  if (t_boundary) {
+    // the boundary conditions are evaluated later on, hence the time integrated DOFs have to persist
+    l_bufferPointer = boundaryFaces.timeIntegrated(boundaryCell);
+  } else if (l_resetBuffers) {
+    // assert presence of the buffer
+    assert(buffers[l_cell] != nullptr);
+
+    l_bufferPointer = buffers[l_cell];
+  } else {
+    // work on local buffer
+    l_bufferPointer = l_integrationBuffer;
+  }
+
+  // the displacements of gravity faces are updated in computeBoundaryIntegration, which needs the derivatives
+  real* derivativesPointer = derivatives[l_cell];
+  if (t_boundary && derivativesPointer == nullptr) {
+    derivativesPointer = boundaryFaces.derivativesScratch(boundaryCell);
+  }
+
+  m_timeKernel.computeAder(m_timeStepWidth,
+                           data,
+                           tmp,
+                           l_bufferPointer,
+                           derivativesPointer,
+                           m_fullUpdateTime,
+                           false);
+
+  // Compute local integrals (boundary conditions follow in computeBoundaryIntegration)
+  m_localKernel.computeIntegral(l_bufferPointer,
+                                data,
+                                tmp);
+
+  for (unsigned face = 0; face < 4; ++face) {
+    auto& curFaceDisplacements = data.faceDisplacements[face];
+    // Note: Displacement for freeSurfaceGravity is computed in Time.cpp
+    if (curFaceDisplacements != nullptr
+        && data.cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity) {
+      kernel::addVelocity addVelocityKrnl;
+
+      addVelocityKrnl.V3mTo2nFace = m_globalDataOnHost->V3mTo2nFace;
+      addVelocityKrnl.selectVelocity = init::selectVelocity::Values;
+      addVelocityKrnl.faceDisplacement = data.faceDisplacements[face];
+      addVelocityKrnl.I = l_bufferPointer;
+      addVelocityKrnl.execute(face);
+    }
+  }
+
+  if (t_boundary && l_resetBuffers) {
+    assert(buffers[l_cell] != nullptr);
+    std::copy_n(l_bufferPointer, tensor::I::size(), buffers[l_cell]);
+  }
+
+  // update lts buffers if required
+  // TODO: Integrate this step into the kernel
+  if (!l_resetBuffers && l_buffersProvided) {
+    assert (buffers[l_cell] != nullptr);
+
+    for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
+      buffers[l_cell][l_dof] += l_bufferPointer[l_dof];
+    }
+  }
+}
+
+seissol::time_stepping::BoundaryFaceLists& seissol::time_stepping::TimeCluster::boundaryFaceLists( seissol::initializers::Layer&  i_layerData ) {
+  BoundaryFaceLists& boundaryFaces = (i_layerData.getLayerType() == Interior) ? m_interiorBoundaryFaces : m_copyBoundaryFaces;
+  // the boundary mappings are set up after the construction of the clusters
+  if (!boundaryFaces.isInitialized()) {
+    boundaryFaces.initialize(i_layerData.getNumberOfCells(),
+                             i_layerData.var(m_lts->cellInformation),
+                             i_layerData.var(m_lts->boundaryMapping),
+                             i_layerData.var(m_lts->material),
+                             i_layerData.var(m_lts->derivatives),
+                             i_layerData.var(m_lts->faceDisplacements));
+  }
+  return boundaryFaces;
+}
+
+void seissol::time_stepping::TimeCluster::computeBoundaryIntegration( seissol::initializers::Layer&  i_layerData,
+                                                                      BoundaryFaceLists&             boundaryFaces ) {
+  if (boundaryFaces.boundaryCells().empty()) {
+    return;
+  }
 
   kernels::LocalData::Loader loader;
   loader.load(*m_lts, i_layerData);
-  kernels::LocalTmp tmp;
+  CellMaterialData* materialData = i_layerData.var(m_lts->material);
+  CellBoundaryMapping (*boundaryMapping)[4] = i_layerData.var(m_lts->boundaryMapping);
+  std::vector<unsigned> const& boundaryCells = boundaryFaces.boundaryCells();
 
+  // displacements of all gravity faces of the layer in batches of contiguous faces
+  std::vector<GravityFace> const& gravityFaces = boundaryFaces.gravityFaces();
+  const unsigned gravityBatchSize = boundaryFaces.hasContiguousGravityDisplacements() ? GravitationalFreeSurfaceBc::BatchSize : 1;
+  const unsigned numberOfGravityBatches = (gravityFaces.size() + gravityBatchSize - 1) / gravityBatchSize;
 #ifdef _OPENMP
-  #pragma omp parallel for private(l_bufferPointer, l_integrationBuffer, tmp) schedule(static)
+  #pragma omp parallel for schedule(static)
 #endif
-  for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
-    auto data = loader.entry(l_cell);
-    // overwrite cell buffer
-    // TODO: Integrate this step into the kernel
-
-    bool l_buffersProvided = (data.cellInformation.ltsSetup >> 8)%2 == 1; // buffers are provided
-    bool l_resetBuffers = l_buffersProvided && ( (data.cellInformation.ltsSetup >> 10) %2 == 0 || m_resetLtsBuffers ); // they should be reset
-
-    if (l_resetBuffers) {
-      // assert presence of the buffer
-      assert(buffers[l_cell] != nullptr);
+  for (unsigned batch = 0; batch < numberOfGravityBatches; ++batch) {
+    const unsigned first = batch * gravityBatchSize;
+    const unsigned numberOfFaces = std::min<unsigned>(gravityBatchSize, gravityFaces.size() - first);
+    m_timeKernel.computeFreeSurfaceGravityDisplacements(m_timeStepWidth,
+                                                        gravityFaces.data() + first,
+                                                        numberOfFaces,
+                                                        boundaryFaces.gravityDisplacements(first),
+                                                        boundaryFaces.averageDisplacement(first));
+  }
 
-      l_bufferPointer = buffers[l_cell];
-    } else {
-      // work on local buffer
-      l_bufferPointer = l_integrationBuffer;
+  // one pass per face type, a cell occurs at most once per pass
+  std::vector<unsigned> const& gravityCells = boundaryFaces.cells(FaceType::freeSurfaceGravity);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned index = 0; index < gravityCells.size(); ++index) {
+    const unsigned boundaryCell = gravityCells[index];
+    const unsigned l_cell = boundaryCells[boundaryCell];
+    auto data = loader.entry(l_cell);
+    unsigned gravityFace = boundaryFaces.gravityFaceOffset(index);
+    for (unsigned face = 0; face < 4; ++face) {
+      if (data.cellInformation.faceTypes[face] == FaceType::freeSurfaceGravity) {
+        m_localKernel.computeFreeSurfaceGravityIntegral(boundaryFaces.timeIntegrated(boundaryCell),
+                                                        data,
+                                                        face,
+                                                        boundaryFaces.averageDisplacement(gravityFace),
+                                                        materialData[l_cell],
+                                                        boundaryMapping[l_cell][face]);
+        ++gravityFace;
+      }
     }
+  }
 
-    m_timeKernel.computeAder(m_timeStepWidth,
-                             data,
-                             tmp,
-                             l_bufferPointer,
-                             derivatives[l_cell],
-                             m_fullUpdateTime,
-                             true);
-
-    // Compute local integrals (including some boundary conditions)
-    CellBoundaryMapping (*boundaryMapping)[4] = i_layerData.var(m_lts->boundaryMapping);
-    m_localKernel.computeIntegral(l_bufferPointer,
-                                  data,
-                                  tmp,
-                                  &materialData[l_cell],
-                                  &boundaryMapping[l_cell],
-                                  m_fullUpdateTime,
-                                  m_timeStepWidth
-    );
+  std::vector<unsigned> const& dirichletCells = boundaryFaces.cells(FaceType::dirichlet);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned index = 0; index < dirichletCells.size(); ++index) {
+    const unsigned boundaryCell = dirichletCells[index];
+    const unsigned l_cell = boundaryCells[boundaryCell];
+    auto data = loader.entry(l_cell);
+    for (unsigned face = 0; face < 4; ++face) {
+      if (data.cellInformation.faceTypes[face] == FaceType::dirichlet) {
+        m_localKernel.computeDirichletIntegral(boundaryFaces.timeIntegrated(boundaryCell),
+                                               data,
+                                               face,
+                                               boundaryMapping[l_cell][face]);
+      }
+    }
+  }
 
+  std::vector<unsigned> const& analyticalCells = boundaryFaces.cells(FaceType::analytical);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned index = 0; index < analyticalCells.size(); ++index) {
+    const unsigned boundaryCell = analyticalCells[index];
+    const unsigned l_cell = boundaryCells[boundaryCell];
+    auto data = loader.entry(l_cell);
     for (unsigned face = 0; face < 4; ++face) {
-      auto& curFaceDisplacements = data.faceDisplacements[face];
-      // Note: Displacement for freeSurfaceGravity is computed in Time.cpp
-      if (curFaceDisplacements != nullptr
-          && data.cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity) {
-        kernel::addVelocity addVelocityKrnl;
-
-        addVelocityKrnl.V3mTo2nFace = m_globalDataOnHost->V3mTo2nFace;
-        addVelocityKrnl.selectVelocity = init::selectVelocity::Values;
-        addVelocityKrnl.faceDisplacement = data.faceDisplacements[face];
-        addVelocityKrnl.I = l_bufferPointer;
-        addVelocityKrnl.execute(face);
+      if (data.cellInformation.faceTypes[face] == FaceType::analytical) {
+        m_localKernel.computeAnalyticalIntegral(boundaryFaces.timeIntegrated(boundaryCell),
+                                                data,
+                                                face,
+                                                boundaryFaces.analyticalNodes(boundaryCell, face),
+                                                materialData[l_cell],
+                                                boundaryMapping[l_cell][face],
+                                                m_fullUpdateTime,
+                                                m_timeStepWidth);
       }
     }
+  }
+}
+
+void seissol::time_stepping::TimeCluster::computeLocalIntegration( seissol::initializers::Layer&  i_layerData ) {
+  SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-    // update lts buffers if required
-    // TODO: Integrate this step into the kernel
-    if (!l_resetBuffers && l_buffersProvided) {
-      assert (buffers[l_cell] != nullptr);
+  m_loopStatistics->begin(m_regionComputeLocalIntegration);
 
-      for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
-        buffers[l_cell][l_dof] += l_integrationBuffer[l_dof];
-      }
+  kernels::LocalData::Loader loader;
+  loader.load(*m_lts, i_layerData);
+  kernels::LocalTmp tmp;
+
+  BoundaryFaceLists& boundaryFaces = boundaryFaceLists(i_layerData);
+  std::vector<unsigned> const& regularCells = boundaryFaces.regularCells();
+  std::vector<unsigned> const& boundaryCells = boundaryFaces.boundaryCells();
+
+#ifdef _OPENMP
+  #pragma omp parallel private(tmp)
+#endif
+  {
+#ifdef _OPENMP
+    #pragma omp for schedule(static) nowait
+#endif
+    for( unsigned int l_index = 0; l_index < regularCells.size(); l_index++ ) {
+      computeLocalIntegrationCell<false>(i_layerData, loader, tmp, boundaryFaces, regularCells[l_index]);
+    }
+
+#ifdef _OPENMP
+    #pragma omp for schedule(static)
+#endif
+    for( unsigned int l_index = 0; l_index < boundaryCells.size(); l_index++ ) {
+      computeLocalIntegrationCell<true>(i_layerData, loader, tmp, boundaryFaces, boundaryCells[l_index]);
     }
   }
 
+  computeBoundaryIntegration(i_layerData, boundaryFaces);
+
   m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells());
 }
+
+void seissol::time_stepping::TimeCluster::computeFusedInteriorIntegration() {
+  SCOREP_USER_REGION( "computeFusedInteriorIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+  seissol::initializers::Layer& interior = m_clusterData->child<Interior>();
+
+  m_loopStatistics->begin(m_regionComputeFusedIntegration);
+
+  kernels::LocalData::Loader localLoader;
+  localLoader.load(*m_lts, interior);
+  kernels::NeighborData::Loader neighborLoader;
+  neighborLoader.load(*m_lts, interior);
+
+  BoundaryFaceLists& boundaryFaces = boundaryFaceLists(interior);
+
+  // every thread gets its own temporary memory, as with private(tmp) in computeLocalIntegration
+  m_fusedInterior.execute<kernels::LocalTmp>([&](unsigned cell, kernels::LocalTmp& tmp) {
+                                               if (boundaryFaces.boundaryCellId(cell) == BoundaryFaceLists::NoBoundaryCell) {
+                                                 computeLocalIntegrationCell<false>(interior, localLoader, tmp, boundaryFaces, cell);
+                                               } else {
+                                                 computeLocalIntegrationCell<true>(interior, localLoader, tmp, boundaryFaces, cell);
+                                               }
+                                             },
+                                             [&](unsigned cell) {
+                                               computeNeighboringIntegrationCell(interior, neighborLoader, cell, cell + 1);
+                                             });
+
+  // the boundary contributions are independent of the neighboring contributions
+  computeBoundaryIntegration(interior, boundaryFaces);
+
+  m_loopStatistics->end(m_regionComputeFusedIntegration, interior.getNumberOfCells());
+}
 #else // ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeLocalIntegration( seissol::initializers::Layer&  i_layerData ) {
   SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
@@ -715,10 +1068,16 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration( seissol::init
 
 #ifndef ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol::initializers::Layer&  i_layerData ) {
+  // fused cells of the interior were already updated in computeFusedInteriorIntegration
+  std::vector<unsigned> const* cells = nullptr;
+  if (m_useFusedInterior && i_layerData.getLayerType() == Interior) {
+    cells = &m_fusedInterior.remainingCells();
+  }
+
   if (usePlasticity) {
-    computeNeighboringIntegrationImplementation<true>(i_layerData);
+    computeNeighboringIntegrationImplementation<true>(i_layerData, cells);
   } else {
-    computeNeighboringIntegrationImplementation<false>(i_layerData);
+    computeNeighboringIntegrationImplementation<false>(i_layerData, cells);
   }
 }
 #else // ACL_DEVICE
@@ -744,8 +1103,10 @@ void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol
                                                                                       table,
                                                                                       plasticity);
 
-    g_SeisSolNonZeroFlopsPlasticity += i_layerData.getNumberOfCells() * m_flops_nonZero[PlasticityCheck] + numAdjustedDofs * m_flops_nonZero[PlasticityYield];
-    g_SeisSolHardwareFlopsPlasticity += i_layerData.getNumberOfCells() * m_flops_hardware[PlasticityCheck] + numAdjustedDofs * m_flops_hardware[PlasticityYield];
+    accountComputePart(PlasticityCheck, i_layerData.getNumberOfCells(),
+                       g_SeisSolNonZeroFlopsPlasticity, g_SeisSolHardwareFlopsPlasticity, g_SeisSolBytesPlasticity);
+    accountComputePart(PlasticityYield, numAdjustedDofs,
+                       g_SeisSolNonZeroFlopsPlasticity, g_SeisSolHardwareFlopsPlasticity, g_SeisSolBytesPlasticity);
   }
 
   device.api->synchDevice();
@@ -768,6 +1129,8 @@ bool seissol::time_stepping::TimeCluster::computeLocalCopy(){
   // continue only if copy layer sends are complete
   if( !testForCopyLayerSends() ) return false;
 
+  seissol::monitoring::TraceScope trace("localCopy", m_globalClusterId);
+
   // post receive requests
 #if defined(_OPENMP) && defined(USE_COMM_THREAD)
   initReceiveGhostLayer();
@@ -778,13 +1141,13 @@ bool seissol::time_stepping::TimeCluster::computeLocalCopy(){
   // MPI checks for receiver writes receivers either in the copy layer or interior
   if( m_updatable.localInterior ) {
     writeReceivers();
+    writeWaveFieldSnapshots();
   }
 
   // integrate copy layer locally
   computeLocalIntegration( m_clusterData->child<Copy>() );
 
-  g_SeisSolNonZeroFlopsLocal += m_flops_nonZero[LocalCopy];
-  g_SeisSolHardwareFlopsLocal += m_flops_hardware[LocalCopy];
+  accountComputePart(LocalCopy, 1, g_SeisSolNonZeroFlopsLocal, g_SeisSolHardwareFlopsLocal, g_SeisSolBytesLocal);
 
 #if defined(_OPENMP) && defined(USE_COMM_THREAD)
   initSendCopyLayer();
@@ -825,21 +1188,31 @@ void seissol::time_stepping::TimeCluster::computeLocalInterior(){
       << m_fullUpdateTime << m_predictionTime << m_timeStepWidth   << m_subTimeStart      << m_resetLtsBuffers;
   }
 
+  seissol::monitoring::TraceScope trace("localInterior", m_globalClusterId);
+
   // MPI checks for receiver writes receivers either in the copy layer or interior
 #ifdef USE_MPI
   if( m_updatable.localCopy ) {
     writeReceivers();
+    writeWaveFieldSnapshots();
   }
 #else
   // non-MPI checks for write in the interior
   writeReceivers();
+  writeWaveFieldSnapshots();
 #endif
 
   // integrate interior cells locally
-  computeLocalIntegration( m_clusterData->child<Interior>() );
+#ifndef ACL_DEVICE
+  if (m_useFusedInterior) {
+    computeFusedInteriorIntegration();
+  } else
+#endif
+  {
+    computeLocalIntegration( m_clusterData->child<Interior>() );
+  }
 
-  g_SeisSolNonZeroFlopsLocal += m_flops_nonZero[LocalInterior];
-  g_SeisSolHardwareFlopsLocal += m_flops_hardware[LocalInterior];
+  accountComputePart(LocalInterior, 1, g_SeisSolNonZeroFlopsLocal, g_SeisSolHardwareFlopsLocal, g_SeisSolBytesLocal);
 
 #ifdef USE_MPI
 #ifndef USE_COMM_THREAD
@@ -873,6 +1246,8 @@ bool seissol::time_stepping::TimeCluster::computeNeighboringCopy() {
   // continue only of ghost layer receives are complete
   if( !testForGhostLayerReceives() ) return false;
 
+  seissol::monitoring::TraceScope trace("neighboringCopy", m_globalClusterId);
+
 #ifndef USE_COMM_THREAD
   // continue with communication
   testForCopyLayerSends();
@@ -881,21 +1256,17 @@ bool seissol::time_stepping::TimeCluster::computeNeighboringCopy() {
   if (m_dynamicRuptureFaces == true) {
     if (m_updatable.neighboringInterior) {
       computeDynamicRupture(m_dynRupClusterData->child<Interior>());
-      g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRFrictionLawInterior];
-      g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRFrictionLawInterior];
+      accountComputePart(DRFrictionLawInterior, 1, g_SeisSolNonZeroFlopsDynamicRupture, g_SeisSolHardwareFlopsDynamicRupture, g_SeisSolBytesDynamicRupture);
     }
 
     computeDynamicRupture(m_dynRupClusterData->child<Copy>());
-    g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRFrictionLawCopy];
-    g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRFrictionLawCopy];
+    accountComputePart(DRFrictionLawCopy, 1, g_SeisSolNonZeroFlopsDynamicRupture, g_SeisSolHardwareFlopsDynamicRupture, g_SeisSolBytesDynamicRupture);
   }
 
   computeNeighboringIntegration( m_clusterData->child<Copy>() );
 
-  g_SeisSolNonZeroFlopsNeighbor += m_flops_nonZero[NeighborCopy];
-  g_SeisSolHardwareFlopsNeighbor += m_flops_hardware[NeighborCopy];
-  g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRNeighborCopy];
-  g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRNeighborCopy];
+  accountComputePart(NeighborCopy, 1, g_SeisSolNonZeroFlopsNeighbor, g_SeisSolHardwareFlopsNeighbor, g_SeisSolBytesNeighbor);
+  accountComputePart(DRNeighborCopy, 1, g_SeisSolNonZeroFlopsDynamicRupture, g_SeisSolHardwareFlopsDynamicRupture, g_SeisSolBytesDynamicRupture);
 
 #ifndef USE_COMM_THREAD
   // continue with communication
@@ -912,6 +1283,9 @@ bool seissol::time_stepping::TimeCluster::computeNeighboringCopy() {
 
     m_fullUpdateTime      += m_timeStepWidth;
     m_subTimeStart        += m_timeStepWidth;
+    for( double& l_farSubTimeStart : m_farSubTimeStarts ) {
+      l_farSubTimeStart   += m_timeStepWidth;
+    }
     m_numberOfFullUpdates += 1;
     m_numberOfTimeSteps   += 1;
   }
@@ -932,19 +1306,18 @@ void seissol::time_stepping::TimeCluster::computeNeighboringInterior() {
       << m_fullUpdateTime << m_predictionTime << m_timeStepWidth   << m_subTimeStart      << m_resetLtsBuffers;
   }
 
+  seissol::monitoring::TraceScope trace("neighboringInterior", m_globalClusterId);
+
   if (m_dynamicRuptureFaces == true && m_updatable.neighboringCopy == true) {
     computeDynamicRupture(m_dynRupClusterData->child<Interior>());
-    g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRFrictionLawInterior];
-    g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRFrictionLawInterior];
+    accountComputePart(DRFrictionLawInterior, 1, g_SeisSolNonZeroFlopsDynamicRupture, g_SeisSolHardwareFlopsDynamicRupture, g_SeisSolBytesDynamicRupture);
   }
 
   // Update all cells in the interior with the neighboring boundary contribution.
   computeNeighboringIntegration( m_clusterData->child<Interior>() );
 
-  g_SeisSolNonZeroFlopsNeighbor += m_flops_nonZero[NeighborInterior];
-  g_SeisSolHardwareFlopsNeighbor += m_flops_hardware[NeighborInterior];
-  g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[DRNeighborInterior];
-  g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[DRNeighborInterior];
+  accountComputePart(NeighborInterior, 1, g_SeisSolNonZeroFlopsNeighbor, g_SeisSolHardwareFlopsNeighbor, g_SeisSolBytesNeighbor);
+  accountComputePart(DRNeighborInterior, 1, g_SeisSolNonZeroFlopsDynamicRupture, g_SeisSolHardwareFlopsDynamicRupture, g_SeisSolBytesDynamicRupture);
 
   // compute dynamic rupture, update simulation time and statistics
   if( !m_updatable.neighboringCopy ) {
@@ -956,6 +1329,9 @@ void seissol::time_stepping::TimeCluster::computeNeighboringInterior() {
 
     m_fullUpdateTime      += m_timeStepWidth;
     m_subTimeStart        += m_timeStepWidth;
+    for( double& l_farSubTimeStart : m_farSubTimeStarts ) {
+      l_farSubTimeStart   += m_timeStepWidth;
+    }
     m_numberOfFullUpdates += 1;
     m_numberOfTimeSteps   += 1;
   }
@@ -1062,10 +1438,60 @@ void seissol::time_stepping::TimeCluster::computeFlops()
   computeDynamicRuptureFlops( m_dynRupClusterData->child<Copy>(), m_flops_nonZero[DRFrictionLawCopy], m_flops_hardware[DRFrictionLawCopy] );
   computeDynamicRuptureFlops( m_dynRupClusterData->child<Interior>(), m_flops_nonZero[DRFrictionLawInterior], m_flops_hardware[DRFrictionLawInterior] );
 
+  seissol::kernels::Plasticity::flopsYieldPreCheck( m_flops_nonZero[PlasticityPreCheck],
+                                                    m_flops_hardware[PlasticityPreCheck] );
   seissol::kernels::Plasticity::flopsPlasticity(  m_flops_nonZero[PlasticityCheck],
                                                   m_flops_hardware[PlasticityCheck],
                                                   m_flops_nonZero[PlasticityYield],
                                                   m_flops_hardware[PlasticityYield] );
+
+  // set with the point sources
+  m_flops_nonZero[PointSource] = m_flops_hardware[PointSource] = 0;
+  m_flops_nonZero[PointSourceCell] = m_flops_hardware[PointSourceCell] = 0;
+}
+
+void seissol::time_stepping::TimeCluster::computeBytes()
+{
+  std::fill(m_bytes, m_bytes + NUM_COMPUTE_PARTS, 0);
+
+  const long long localBytes = m_timeKernel.bytesAder() + m_localKernel.bytesIntegral();
+  const long long neighborBytes = m_neighborKernel.bytesNeighborsIntegral();
+  const long long derivativesBytes = sizeof(real) * yateto::computeFamilySize<tensor::dQ>();
+  const long long imposedStateBytes = sizeof(real) * tensor::QInterpolated::size();
+
+  auto neighborIntegrationBytes = [&](seissol::initializers::Layer& layer, long long& bytes, long long& drBytes) {
+    CellLocalInformation const* cellInformation = layer.var(m_lts->cellInformation);
+    bytes = 0;
+    drBytes = 0;
+    for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+      bytes += neighborBytes;
+      for (unsigned face = 0; face < 4; ++face) {
+        if (cellInformation[cell].faceTypes[face] == FaceType::dynamicRupture) {
+          drBytes += imposedStateBytes;
+        } else if ((cellInformation[cell].ltsSetup >> face) % 2 == 1
+                   && cellInformation[cell].faceTypes[face] != FaceType::outflow) {
+          // the time integral is computed from the derivatives of the neighbor
+          bytes += derivativesBytes;
+        }
+      }
+    }
+  };
+
+#ifdef USE_MPI
+  m_bytes[LocalCopy] = m_meshStructure->numberOfCopyCells * localBytes;
+  neighborIntegrationBytes(m_clusterData->child<Copy>(), m_bytes[NeighborCopy], m_bytes[DRNeighborCopy]);
+#endif
+  m_bytes[LocalInterior] = m_meshStructure->numberOfInteriorCells * localBytes;
+  neighborIntegrationBytes(m_clusterData->child<Interior>(), m_bytes[NeighborInterior], m_bytes[DRNeighborInterior]);
+
+  // derivatives of both sides and the imposed states of both sides; the friction law is not modeled
+  const long long drFaceBytes = 2 * derivativesBytes + 2 * imposedStateBytes;
+  m_bytes[DRFrictionLawCopy] = m_dynRupClusterData->child<Copy>().getNumberOfCells() * drFaceBytes;
+  m_bytes[DRFrictionLawInterior] = m_dynRupClusterData->child<Interior>().getNumberOfCells() * drFaceBytes;
+
+  // the pre-check reads the DOFs, candidates read and write the DOFs and the plastic strain
+  m_bytes[PlasticityPreCheck] = sizeof(real) * tensor::Q::size() + sizeof(PlasticityData);
+  m_bytes[PlasticityCheck] = sizeof(real) * 2 * (tensor::Q::size() + 7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS);
 }
 
 long seissol::time_stepping::TimeCluster::getNumberOfCells() const {
@@ -1073,6 +1499,18 @@ long seissol::time_stepping::TimeCluster::getNumberOfCells() const {
          m_clusterData->child<Interior>().getNumberOfCells();
 }
 
+bool seissol::time_stepping::TimeCluster::hasSlowerDynamicRuptureSides() const {
+  // faces with a side in another cluster are rank-local, hence part of the interior
+  auto& layer = m_dynRupClusterData->child<Interior>();
+  DRFaceInformation* faceInformation = layer.var(m_dynRup->faceInformation);
+  for (unsigned face = 0; face < layer.getNumberOfCells(); ++face) {
+    if (faceInformation[face].plusSideSlower || faceInformation[face].minusSideSlower) {
+      return true;
+    }
+  }
+  return false;
+}
+
 
 #if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
 void seissol::time_stepping::TimeCluster::pollForCopyLayerSends(){
@@ -1089,6 +1527,7 @@ void seissol::time_stepping::TimeCluster::pollForCopyLayerSends(){
   }
 
   if (m_sendQueue.empty()) {
+    traceCommunication("copyLayerSend", m_copySendPostTime, m_globalClusterId, true);
     g_handleSends[m_clusterId] = 0;
   }
 }
@@ -1108,6 +1547,7 @@ void seissol::time_stepping::TimeCluster::pollForGhostLayerReceives(){
   }
 
   if (m_receiveQueue.empty()) {
+    traceCommunication("ghostLayerReceive", m_ghostReceivePostTime, m_globalClusterId, true);
     g_handleRecvs[m_clusterId] = 0;
   }
 }
@@ -73,8 +73,10 @@
 
 #ifdef USE_MPI
 #include <mpi.h>
+#include <cstdint>
 #include <list>
 #endif
+#include <vector>
 
 #include <Initializer/typedefs.hpp>
 #include <SourceTerm/typedefs.hpp>
@@ -88,8 +90,12 @@
 #include <Kernels/DynamicRupture.h>
 #include <Kernels/Plasticity.h>
 #include <Solver/FreeSurfaceIntegrator.h>
+#include <Monitoring/FlopCounter.hpp>
 #include <Monitoring/LoopStatistics.h>
 #include <Kernels/TimeCommon.h>
+#include <Solver/time_stepping/WavefrontTiling.h>
+#include <Solver/time_stepping/BoundaryFaceLists.h>
+#include <Solver/time_stepping/LockedDrFaces.h>
 
 #ifdef ACL_DEVICE
 #include <device.h>
@@ -104,6 +110,10 @@ namespace seissol {
   namespace kernels {
     class ReceiverCluster;
   }
+
+  namespace writer {
+    class WaveFieldSnapshots;
+  }
 }
 
 /**
@@ -163,6 +173,10 @@ private:
 
     //! pending ghost region receives
     std::list< MPI_Request* > m_receiveQueue;
+
+    //! trace time at which the pending sends and receives were posted, -1 if not traced
+    std::int64_t m_copySendPostTime = -1;
+    std::int64_t m_ghostReceivePostTime = -1;
 #endif    
     seissol::initializers::TimeCluster* m_clusterData;
     seissol::initializers::TimeCluster* m_dynRupClusterData;
@@ -173,16 +187,30 @@ private:
     double m_timeStepWidth;
     
     //! Mapping of cells to point sources
-    sourceterm::CellToPointSourcesMapping const* m_cellToPointSources;
-
-    //! Number of mapping of cells to point sources
-    unsigned m_numberOfCellToPointSourcesMappings;
+    sourceterm::ClusterMapping const* m_pointSourceMapping;
 
     //! Point sources
     sourceterm::PointSources const* m_pointSources;
 
+    //! Position of the next mapping (in order of onset time) which is not yet active
+    unsigned m_nextPointSourceMapping;
+
+    //! Mappings with point sources which might be active in the current time step
+    std::vector<unsigned> m_activePointSourceMappings;
+
     //! true if dynamic rupture faces are present
     bool m_dynamicRuptureFaces;
+
+#ifndef ACL_DEVICE
+    //! true if the friction law is skipped on locked dynamic rupture faces without incoming waves
+    bool m_skipLockedDrFaces = false;
+
+    //! true if locked faces are evaluated anyway to verify their classification
+    bool m_verifyLockedDrFaces = false;
+
+    //! locked faces per dynamic rupture layer (copy, interior)
+    LockedDrFaces m_lockedDrFaces[2];
+#endif
     
     enum ComputePart {
       LocalInterior = 0,
@@ -195,16 +223,60 @@ private:
 #endif
       DRFrictionLawCopy,
       DRFrictionLawInterior,
+      PlasticityPreCheck,
       PlasticityCheck,
       PlasticityYield,
+      PointSource,
+      PointSourceCell,
       NUM_COMPUTE_PARTS
     };
     
     long long m_flops_nonZero[NUM_COMPUTE_PARTS];
     long long m_flops_hardware[NUM_COMPUTE_PARTS];
+    //! modeled memory traffic of the compute parts
+    long long m_bytes[NUM_COMPUTE_PARTS];
+
+    //! hardware flops and modeled bytes of this cluster since the start
+    long long m_accumulatedHardwareFlops = 0;
+    long long m_accumulatedBytes = 0;
+
+    /**
+     * Adds the flops and bytes of a compute part, performed count times, to the given global
+     * counters and to the counters of this cluster.
+     **/
+    void accountComputePart(ComputePart part,
+                            long long count,
+                            long long& nonZeroFlops,
+                            long long& hardwareFlops,
+                            long long& bytes) {
+      nonZeroFlops += count * m_flops_nonZero[part];
+      hardwareFlops += count * m_flops_hardware[part];
+      bytes += count * m_bytes[part];
+      m_accumulatedHardwareFlops += count * m_flops_hardware[part];
+      m_accumulatedBytes += count * m_bytes[part];
+    }
     
     //! Tv parameter for plasticity
     double m_tv;
+
+#ifndef ACL_DEVICE
+    //! bounds for the yield pre-check of plasticity
+    kernels::Plasticity::NodalBounds m_plasticityBounds;
+
+    //! scratch flags and list of cells which may yield, sized for the largest layer
+    std::vector<unsigned char> m_plasticityMayYield;
+    std::vector<unsigned> m_plasticityCandidates;
+
+    //! tiles of the interior layer for the fused integration
+    WavefrontTiling m_fusedInterior;
+
+    //! true if the interior layer is integrated fused
+    bool m_useFusedInterior = false;
+
+    //! cells with nodal boundary conditions of the copy and interior layer, derived at the first local integration
+    BoundaryFaceLists m_copyBoundaryFaces;
+    BoundaryFaceLists m_interiorBoundaryFaces;
+#endif
     
     //! Relax time for plasticity
     double m_oneMinusIntegratingFactor;
@@ -214,9 +286,13 @@ private:
     unsigned        m_regionComputeLocalIntegration;
     unsigned        m_regionComputeNeighboringIntegration;
     unsigned        m_regionComputeDynamicRupture;
+    unsigned        m_regionComputeFusedIntegration;
 
     kernels::ReceiverCluster* m_receiverCluster;
 
+    //! wave field snapshots recorded by this cluster (nullptr if written at synchronization points)
+    writer::WaveFieldSnapshots* m_waveFieldSnapshots;
+
 #ifdef USE_MPI
     /**
      * Receives the copy layer data from relevant neighboring MPI clusters.
@@ -261,6 +337,12 @@ private:
      **/
     void writeReceivers();
 
+    /**
+     * Records the wave field snapshots with an output time within the next time step (if applicable).
+     * The snapshots are evaluated from the Taylor expansion of the cells' time derivatives.
+     **/
+    void writeWaveFieldSnapshots();
+
     /**
      * Computes the source terms if applicable.
      **/
@@ -268,6 +350,9 @@ private:
 
     /**
      * Computes dynamic rupture.
+     *
+     * If SEISSOL_DR_SKIP_LOCKED is set, faces whose last evaluation was locked (zero Godunov state and zero
+     * imposed state) are skipped as long as the time derivatives at both sides are zero.
      **/
     void computeDynamicRupture( seissol::initializers::Layer&  layerData );
 
@@ -306,97 +391,158 @@ private:
     void computeNeighboringIntegration( seissol::initializers::Layer&  i_layerData );
 
 #ifndef ACL_DEVICE
-    template<bool usePlasticity>
-    std::pair<long, long> computeNeighboringIntegrationImplementation(seissol::initializers::Layer& i_layerData) {
-      SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
+    /**
+     * Local integration of a single cell without nodal boundary conditions, see computeLocalIntegration.
+     * If t_boundary is set, the time integrated DOFs and the time derivatives of the cell are
+     * kept for computeBoundaryIntegration.
+     **/
+    template<bool t_boundary>
+    void computeLocalIntegrationCell( seissol::initializers::Layer&  i_layerData,
+                                      kernels::LocalData::Loader&    loader,
+                                      kernels::LocalTmp&             tmp,
+                                      BoundaryFaceLists&             boundaryFaces,
+                                      unsigned                       l_cell );
 
-      m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
+    /**
+     * Returns the boundary face lists of a layer and derives them on first use.
+     **/
+    BoundaryFaceLists& boundaryFaceLists( seissol::initializers::Layer&  i_layerData );
+
+    /**
+     * Adds the nodal boundary conditions of a layer to the DOFs, one pass per face type.
+     * The displacements of the gravity faces are advanced in contiguous batches beforehand.
+     * Requires the local integration of the boundary cells of the layer.
+     **/
+    void computeBoundaryIntegration( seissol::initializers::Layer&  i_layerData,
+                                     BoundaryFaceLists&             boundaryFaces );
 
+    /**
+     * Neighboring integration of a single cell without plasticity, see computeNeighboringIntegration.
+     * The face neighbors of l_nextCell are prefetched.
+     **/
+    void computeNeighboringIntegrationCell( seissol::initializers::Layer&  i_layerData,
+                                            kernels::NeighborData::Loader& loader,
+                                            unsigned                       l_cell,
+                                            unsigned                       l_nextCell ) {
       real* (*faceNeighbors)[4] = i_layerData.var(m_lts->faceNeighbors);
       CellDRMapping (*drMapping)[4] = i_layerData.var(m_lts->drMapping);
-      CellLocalInformation* cellInformation = i_layerData.var(m_lts->cellInformation);
-      PlasticityData* plasticity = i_layerData.var(m_lts->plasticity);
-      real (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = i_layerData.var(m_lts->pstrain);
-      unsigned numberOTetsWithPlasticYielding = 0;
-
-      kernels::NeighborData::Loader loader;
-      loader.load(*m_lts, i_layerData);
 
       real *l_timeIntegrated[4];
       real *l_faceNeighbors_prefetch[4];
 
+      auto data = loader.entry(l_cell);
+      seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
+                                                     data.cellInformation.ltsSetup,
+                                                     data.cellInformation.faceTypes,
+                                                     subTimeStart( (data.cellInformation.ltsSetup >> 11) % 8 ),
+                                                     m_timeStepWidth,
+                                                     faceNeighbors[l_cell],
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch) shared(cellInformation, loader, faceNeighbors, pstrain, i_layerData, plasticity, drMapping) reduction(+:numberOTetsWithPlasticYielding)
-#endif
-      for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
-        auto data = loader.entry(l_cell);
-        seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
-                                                       data.cellInformation.ltsSetup,
-                                                       data.cellInformation.faceTypes,
-                                                       m_subTimeStart,
-                                                       m_timeStepWidth,
-                                                       faceNeighbors[l_cell],
-#ifdef _OPENMP
-                                                       *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
+                                                     *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
 #else
-            *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalData->integrationBufferLTS),
+          *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalDataOnHost->integrationBufferLTS),
 #endif
-                                                       l_timeIntegrated);
+                                                     l_timeIntegrated);
 
 #ifdef ENABLE_MATRIX_PREFETCH
-        l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][1] :
-                                      drMapping[l_cell][1].godunov;
-        l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][2] :
-                                      drMapping[l_cell][2].godunov;
-        l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][3] :
-                                      drMapping[l_cell][3].godunov;
-
-        // fourth face's prefetches
-        if (l_cell < (i_layerData.getNumberOfCells()-1) ) {
-          l_faceNeighbors_prefetch[3] = (cellInformation[l_cell+1].faceTypes[0] != FaceType::dynamicRupture) ?
-                                        faceNeighbors[l_cell+1][0] :
-                                        drMapping[l_cell+1][0].godunov;
-        } else {
-          l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
-        }
+      CellLocalInformation* cellInformation = i_layerData.var(m_lts->cellInformation);
+      l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
+                                    faceNeighbors[l_cell][1] :
+                                    drMapping[l_cell][1].godunov;
+      l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
+                                    faceNeighbors[l_cell][2] :
+                                    drMapping[l_cell][2].godunov;
+      l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
+                                    faceNeighbors[l_cell][3] :
+                                    drMapping[l_cell][3].godunov;
+
+      // fourth face's prefetches
+      if (l_nextCell < i_layerData.getNumberOfCells()) {
+        l_faceNeighbors_prefetch[3] = (cellInformation[l_nextCell].faceTypes[0] != FaceType::dynamicRupture) ?
+                                      faceNeighbors[l_nextCell][0] :
+                                      drMapping[l_nextCell][0].godunov;
+      } else {
+        l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
+      }
 #endif
 
-        m_neighborKernel.computeNeighborsIntegral( data,
-                                                   drMapping[l_cell],
+      m_neighborKernel.computeNeighborsIntegral( data,
+                                                 drMapping[l_cell],
 #ifdef ENABLE_MATRIX_PREFETCH
-                                                   l_timeIntegrated, l_faceNeighbors_prefetch
+                                                 l_timeIntegrated, l_faceNeighbors_prefetch
 #else
-            l_timeIntegrated
+          l_timeIntegrated
 #endif
-        );
-
-        if constexpr (usePlasticity) {
-          numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
-                                                                                             m_timeStepWidth,
-                                                                                             m_tv,
-                                                                                             m_globalDataOnHost,
-                                                                                             &plasticity[l_cell],
-                                                                                             data.dofs,
-                                                                                             pstrain[l_cell] );
-        }
+      );
+
 #ifdef INTEGRATE_QUANTITIES
-        seissol::SeisSol::main.postProcessor().integrateQuantities( m_timeStepWidth,
-                                                              i_layerData,
-                                                              l_cell,
-                                                              dofs[l_cell] );
+      seissol::SeisSol::main.postProcessor().integrateQuantities( m_timeStepWidth,
+                                                            i_layerData,
+                                                            l_cell,
+                                                            dofs[l_cell] );
 #endif // INTEGRATE_QUANTITIES
-      }
+    }
+
+    /**
+     * Neighboring integration of a layer, restricted to the given cells if cells is not null.
+     * Plasticity is applied to all cells of the layer afterwards.
+     **/
+    template<bool usePlasticity>
+    void computeNeighboringIntegrationImplementation(seissol::initializers::Layer& i_layerData,
+                                                     std::vector<unsigned> const* cells) {
+      SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+      m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
 
-      const long long nonZeroFlopsPlasticity = i_layerData.getNumberOfCells() * m_flops_nonZero[PlasticityCheck] + numberOTetsWithPlasticYielding * m_flops_nonZero[PlasticityYield];
-      const long long hardwareFlopsPlasticity = i_layerData.getNumberOfCells() * m_flops_hardware[PlasticityCheck] + numberOTetsWithPlasticYielding * m_flops_hardware[PlasticityYield];
+      PlasticityData* plasticity = i_layerData.var(m_lts->plasticity);
+      real (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = i_layerData.var(m_lts->pstrain);
+      unsigned numberOTetsWithPlasticYielding = 0;
+
+      kernels::NeighborData::Loader loader;
+      loader.load(*m_lts, i_layerData);
 
-      m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells());
+      const unsigned numberOfCells = (cells != nullptr) ? cells->size() : i_layerData.getNumberOfCells();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for( unsigned int l_index = 0; l_index < numberOfCells; l_index++ ) {
+        const unsigned l_cell = (cells != nullptr) ? (*cells)[l_index] : l_index;
+        const unsigned l_nextCell = (l_index + 1 < numberOfCells) ? ((cells != nullptr) ? (*cells)[l_index+1] : l_index+1)
+                                                                  : i_layerData.getNumberOfCells();
+        computeNeighboringIntegrationCell(i_layerData, loader, l_cell, l_nextCell);
+      }
+
+      if constexpr (usePlasticity) {
+        unsigned numberOfPlasticityCandidates = 0;
+        numberOTetsWithPlasticYielding = seissol::kernels::Plasticity::computePlasticityLayer( m_oneMinusIntegratingFactor,
+                                                                                               m_timeStepWidth,
+                                                                                               m_tv,
+                                                                                               m_globalDataOnHost,
+                                                                                               m_plasticityBounds,
+                                                                                               i_layerData.getNumberOfCells(),
+                                                                                               plasticity,
+                                                                                               i_layerData.var(m_lts->dofs),
+                                                                                               pstrain,
+                                                                                               m_plasticityMayYield.data(),
+                                                                                               m_plasticityCandidates.data(),
+                                                                                               numberOfPlasticityCandidates );
+        accountComputePart(PlasticityPreCheck, i_layerData.getNumberOfCells(),
+                           g_SeisSolNonZeroFlopsPlasticity, g_SeisSolHardwareFlopsPlasticity, g_SeisSolBytesPlasticity);
+        accountComputePart(PlasticityCheck, numberOfPlasticityCandidates,
+                           g_SeisSolNonZeroFlopsPlasticity, g_SeisSolHardwareFlopsPlasticity, g_SeisSolBytesPlasticity);
+        accountComputePart(PlasticityYield, numberOTetsWithPlasticYielding,
+                           g_SeisSolNonZeroFlopsPlasticity, g_SeisSolHardwareFlopsPlasticity, g_SeisSolBytesPlasticity);
+      }
 
-      return {nonZeroFlopsPlasticity, hardwareFlopsPlasticity};
+      m_loopStatistics->end(m_regionComputeNeighboringIntegration, numberOfCells);
     }
+
+    /**
+     * Local integration of the interior layer, fused with the neighboring integration of all
+     * cells which depend on interior cells only (see WavefrontTiling).
+     **/
+    void computeFusedInteriorIntegration();
 #endif // ACL_DEVICE
 
     void computeLocalIntegrationFlops(unsigned numberOfCells,
@@ -417,6 +563,12 @@ private:
                                       long long&                    hardwareFlops );
                                           
     void computeFlops();
+
+    /**
+     * Derives the modeled memory traffic of the compute parts from the per-cell byte models of
+     * the kernels, as used by the proxy.
+     **/
+    void computeBytes();
     
     //! Update relax time for plasticity
     void updateRelaxTime() {
@@ -461,6 +613,23 @@ private:
      */
     double m_subTimeStart;
 
+    /*
+     * Sub start times and buffer resets with respect to the clusters two or more levels larger (index: difference of the cluster ids - 2).
+     * Only present in the interior of the local domain, see LtsLayout::enforceMaximumDifference.
+     */
+    double m_farSubTimeStarts[MaximumLtsClusterDifference-1];
+    volatile bool m_farResetLtsBuffers[MaximumLtsClusterDifference-1];
+
+    //! sub start time with respect to the cluster i_difference levels larger
+    double subTimeStart( unsigned int i_difference ) const {
+      return i_difference < 2 ? m_subTimeStart : m_farSubTimeStarts[i_difference-2];
+    }
+
+    //! true if buffers shared with the cluster i_difference levels larger have to be reset
+    bool resetLtsBuffers( unsigned int i_difference ) const {
+      return i_difference < 2 ? m_resetLtsBuffers : m_farResetLtsBuffers[i_difference-2];
+    }
+
     //! number of full updates the cluster has performed since the last synchronization
     unsigned int m_numberOfFullUpdates;
 
@@ -527,18 +696,20 @@ private:
     /**
      * Sets the pointer to the cluster's point sources
      * 
-     * @param i_cellToPointSources Contains mappings of 1 cell offset to m point sources
-     * @param i_numberOfCellToPointSourcesMappings Size of i_cellToPointSources
+     * @param i_pointSourceMapping Contains mappings of 1 cell offset to m point sources, sorted by onset time
      * @param i_pointSources pointer to all point sources used on this cluster
      */
-    void setPointSources( sourceterm::CellToPointSourcesMapping const* i_cellToPointSources,
-                          unsigned i_numberOfCellToPointSourcesMappings,
+    void setPointSources( sourceterm::ClusterMapping const* i_pointSourceMapping,
                           sourceterm::PointSources const* i_pointSources );
 
     void setReceiverCluster( kernels::ReceiverCluster* receiverCluster) {
       m_receiverCluster = receiverCluster;
     }
 
+    void setWaveFieldSnapshots( writer::WaveFieldSnapshots* waveFieldSnapshots ) {
+      m_waveFieldSnapshots = waveFieldSnapshots;
+    }
+
     /**
      * Set Tv constant for plasticity.
      */
@@ -594,6 +765,27 @@ private:
      */
     long getNumberOfCells() const;
 
+    /**
+     * True if dynamic rupture faces of this cluster connect to cells of the next slower
+     * cluster. These cells read the imposed state only after the full update of this cluster.
+     */
+    bool hasSlowerDynamicRuptureSides() const;
+
+    //! Number of full time steps performed by this cluster so far
+    unsigned long getNumberOfTimeSteps() const {
+      return m_numberOfTimeSteps;
+    }
+
+    //! Hardware flops performed by this cluster so far
+    long long getAccumulatedHardwareFlops() const {
+      return m_accumulatedHardwareFlops;
+    }
+
+    //! Modeled bytes moved by this cluster so far
+    long long getAccumulatedBytes() const {
+      return m_accumulatedBytes;
+    }
+
 #if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
     /**
      * Tests for pending ghost layer communication, active when using communication thread 
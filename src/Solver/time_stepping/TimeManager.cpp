@@ -45,6 +45,9 @@
 #include <Initializer/preProcessorMacros.fpp>
 #include <Initializer/time_stepping/common.hpp>
 #include "SeisSol.h"
+#include <ResultWriter/WaveFieldSnapshots.h>
+#include <ResultWriter/WaveFieldWriter.h>
+#include <Monitoring/Trace.hpp>
 
 #if defined(_OPENMP) && defined(USE_MPI) && defined(USE_COMM_THREAD)
 #include <Parallel/Pin.h>
@@ -55,14 +58,17 @@ volatile unsigned int* volatile g_handleSends;
 pthread_t g_commThread;
 #endif
 
+#include <algorithm>
 #include <chrono>
+#include <vector>
 
 seissol::time_stepping::TimeManager::TimeManager():
-  m_logUpdates(std::numeric_limits<unsigned int>::max())
+  m_logUpdates(std::numeric_limits<unsigned int>::max()), m_waitTime(0.0), m_waveFieldSnapshots(nullptr)
 {
   m_loopStatistics.addRegion("computeLocalIntegration");
   m_loopStatistics.addRegion("computeNeighboringIntegration");
   m_loopStatistics.addRegion("computeDynamicRupture");
+  m_loopStatistics.addRegion("computeFusedIntegration");
 }
 
 seissol::time_stepping::TimeManager::~TimeManager() {
@@ -129,50 +135,70 @@ void seissol::time_stepping::TimeManager::stopCommunicationThread() {
 #endif
 }
 
+bool seissol::time_stepping::TimeManager::areClustersCoupled( unsigned int i_localClusterId,
+                                                              unsigned int i_otherLocalClusterId ) const {
+  if( i_localClusterId == i_otherLocalClusterId ) {
+    return false;
+  }
+
+  // adjacent local clusters are always coupled
+  if( i_localClusterId + 1 == i_otherLocalClusterId || i_otherLocalClusterId + 1 == i_localClusterId ) {
+    return true;
+  }
+
+  unsigned int l_globalClusterId      = m_timeStepping.clusterIds[i_localClusterId];
+  unsigned int l_otherGlobalClusterId = m_timeStepping.clusterIds[i_otherLocalClusterId];
+  return std::max( l_globalClusterId, l_otherGlobalClusterId ) - std::min( l_globalClusterId, l_otherGlobalClusterId ) <= m_timeStepping.maximumClusterDifference;
+}
+
 void seissol::time_stepping::TimeManager::updateClusterDependencies( unsigned int i_localClusterId ) {
   SCOREP_USER_REGION( "updateClusterDependencies", SCOREP_USER_REGION_TYPE_FUNCTION )
 
   // get time tolerance
   double l_timeTolerance = getTimeTolerance();
 
-  // derive relevant clusters
-  unsigned int l_lowerCluster = i_localClusterId;
-  unsigned int l_upperCluster = i_localClusterId;
-
-  if( i_localClusterId != 0 ) {
-    l_lowerCluster--;
-  }
-  if( i_localClusterId < m_timeStepping.numberOfLocalClusters-1 ) {
-    l_upperCluster++;
-  }
-
   // iterate over the clusters
-  for( unsigned int l_cluster = l_lowerCluster; l_cluster <= l_upperCluster; l_cluster++ ) {
+  for( unsigned int l_cluster = 0; l_cluster < m_timeStepping.numberOfLocalClusters; l_cluster++ ) {
+    if( l_cluster != i_localClusterId && !areClustersCoupled( l_cluster, i_localClusterId ) ) {
+      continue;
+    }
+
     // get the relevant times
-    double l_previousPredictionTime     = std::numeric_limits<double>::max();
+    double l_previousImposedStateTime   = std::numeric_limits<double>::max();
     double l_previousFullUpdateTime     = std::numeric_limits<double>::max();
     double l_predictionTime             = m_clusters[l_cluster]->m_predictionTime;
     double l_fullUpdateTime             = m_clusters[l_cluster]->m_fullUpdateTime;
     double l_nextPredictionTime         = std::numeric_limits<double>::max();
     double l_nextUpcomingFullUpdateTime = std::numeric_limits<double>::max();
 
-    if( l_cluster > 0 ) {
-      l_previousPredictionTime = m_clusters[l_cluster-1]->m_predictionTime;
-      l_previousFullUpdateTime = m_clusters[l_cluster-1]->m_fullUpdateTime;
-    }
+    // the previous and next clusters are the slowest ones among the coupled clusters
+    for( unsigned int l_other = 0; l_other < m_timeStepping.numberOfLocalClusters; l_other++ ) {
+      if( !areClustersCoupled( l_cluster, l_other ) ) {
+        continue;
+      }
 
-    if( l_cluster < m_timeStepping.numberOfLocalClusters - 1 ) {
-      l_nextPredictionTime             = m_clusters[l_cluster+1]->m_predictionTime;
-      l_nextUpcomingFullUpdateTime     = m_clusters[l_cluster+1]->m_fullUpdateTime + m_clusters[l_cluster+1]->timeStepWidth();
+      if( l_other < l_cluster ) {
+        // dynamic rupture faces to the previous cluster are evaluated in its full update
+        bool l_imposedStateInFullUpdate = l_other + 1 == l_cluster && m_slowerDynamicRuptureSides[l_cluster];
+        l_previousImposedStateTime = std::min( l_previousImposedStateTime, l_imposedStateInFullUpdate ? m_clusters[l_other]->m_fullUpdateTime
+                                                                                                       : m_clusters[l_other]->m_predictionTime );
+        l_previousFullUpdateTime   = std::min( l_previousFullUpdateTime, m_clusters[l_other]->m_fullUpdateTime );
+      }
+      else {
+        l_nextPredictionTime         = std::min( l_nextPredictionTime, m_clusters[l_other]->m_predictionTime );
+        l_nextUpcomingFullUpdateTime = std::min( l_nextUpcomingFullUpdateTime, m_clusters[l_other]->m_fullUpdateTime + m_clusters[l_other]->timeStepWidth() );
+      }
     }
 
     /*
      * Check if the cluster is eligible for a full update.
+     * Previous and next clusters are all smaller and larger clusters coupled to the current one, see areClustersCoupled.
      *
      * Requirements for a full update:
      *  1) Cluster isn't queued already.
      *  2) Synchronization time isn't reached by now.
      *  3) Prediction time of the previous cluster is equal to the one of the current cluster.
+     *     With dynamic rupture faces between both clusters, the full update time is used instead.
      *  4) Prediction time of the cluster is equal to the desired time step width.
      *  5) Prediction time of the next cluster is greater or equal to the one of the current cluster.
      * _____________________________________________ _ _ _ _ _ _ _   _
@@ -193,7 +219,7 @@ void seissol::time_stepping::TimeManager::updateClusterDependencies( unsigned in
      */
      if( !m_clusters[l_cluster]->m_updatable.neighboringCopy && !m_clusters[l_cluster]->m_updatable.neighboringInterior                 &&  // 1)
           std::abs( l_fullUpdateTime - m_timeStepping.synchronizationTime )                        > l_timeTolerance                    &&  // 2)
-          l_previousPredictionTime                                                                 > l_predictionTime - l_timeTolerance &&  // 3)
+          l_previousImposedStateTime                                                               > l_predictionTime - l_timeTolerance &&  // 3)
           std::abs( l_predictionTime - l_fullUpdateTime )                                          > l_timeTolerance                    &&  // 4)
           l_nextPredictionTime                                                                     > l_predictionTime - l_timeTolerance ) { // 5)
        // enqueue the cluster
@@ -257,6 +283,20 @@ void seissol::time_stepping::TimeManager::updateClusterDependencies( unsigned in
           m_clusters[l_cluster]->m_resetLtsBuffers       = false;
         }
 
+        // buffers shared with clusters more than one level larger are reset at the start of their time steps
+        unsigned int l_farTimeStepRate = m_timeStepping.globalTimeStepRates[l_globalClusterId];
+        for( unsigned int l_difference = 2; l_difference <= m_timeStepping.maximumClusterDifference &&
+                                            l_globalClusterId + l_difference < m_timeStepping.numberOfGlobalClusters; l_difference++ ) {
+          l_farTimeStepRate *= m_timeStepping.globalTimeStepRates[l_globalClusterId + l_difference - 1];
+          if( m_clusters[l_cluster]->m_numberOfFullUpdates % l_farTimeStepRate == 0 ) {
+            m_clusters[l_cluster]->m_farResetLtsBuffers[l_difference-2] = true;
+            m_clusters[l_cluster]->m_farSubTimeStarts[l_difference-2]   = 0;
+          }
+          else {
+            m_clusters[l_cluster]->m_farResetLtsBuffers[l_difference-2] = false;
+          }
+        }
+
 #ifdef USE_MPI
         // TODO please check if this ifdef is correct
 
@@ -280,11 +320,22 @@ void seissol::time_stepping::TimeManager::updateClusterDependencies( unsigned in
 void seissol::time_stepping::TimeManager::advanceInTime( const double &i_synchronizationTime ) {
   SCOREP_USER_REGION( "advanceInTime", SCOREP_USER_REGION_TYPE_FUNCTION )
 
+  seissol::monitoring::Trace::setSimulationTime(m_clusters[0]->m_fullUpdateTime);
+  seissol::monitoring::TraceScope trace("advanceInTime");
+
   // asssert we are not moving back in time
   assert( m_timeStepping.synchronizationTime <= i_synchronizationTime );
 
   m_timeStepping.synchronizationTime = i_synchronizationTime;
 
+  // the dynamic rupture faces are known after the initialization of the cell local matrices
+  if( m_slowerDynamicRuptureSides.empty() ) {
+    m_slowerDynamicRuptureSides.resize( m_timeStepping.numberOfLocalClusters, false );
+    for( unsigned int l_cluster = 1; l_cluster < m_timeStepping.numberOfLocalClusters; l_cluster++ ) {
+      m_slowerDynamicRuptureSides[l_cluster] = m_clusters[l_cluster-1]->hasSlowerDynamicRuptureSides();
+    }
+  }
+
   // iterate over all clusters and set default values
   for( unsigned int l_cluster = 0; l_cluster < m_timeStepping.numberOfLocalClusters; l_cluster++ ) {
 #ifdef USE_MPI
@@ -297,6 +348,10 @@ void seissol::time_stepping::TimeManager::advanceInTime( const double &i_synchro
     m_clusters[l_cluster]->m_resetLtsBuffers               = true;
     m_clusters[l_cluster]->setTimeStepWidth(0.);
     m_clusters[l_cluster]->m_subTimeStart                  = 0;
+    for( unsigned int l_difference = 0; l_difference < MaximumLtsClusterDifference-1; l_difference++ ) {
+      m_clusters[l_cluster]->m_farResetLtsBuffers[l_difference] = true;
+      m_clusters[l_cluster]->m_farSubTimeStarts[l_difference]   = 0;
+    }
     m_clusters[l_cluster]->m_numberOfFullUpdates           = 0;
   }
 
@@ -321,11 +376,23 @@ void seissol::time_stepping::TimeManager::advanceInTime( const double &i_synchro
       timeoutMinimum, timeoutFromCells);
   auto lastUpdateTime = std::chrono::steady_clock::now();
 
+  // the metrics need the wait time and the live simulated time, skip the bookkeeping otherwise
+  auto& metricsExporter = seissol::SeisSol::main.metricsExporter();
+  const bool recordMetrics = metricsExporter.isEnabled();
 
   // iterate until all queues are empty and the next synchronization point in time is reached
   while( !( m_localCopyQueue.empty()       && m_localInteriorQueue.empty() &&
             m_neighboringCopyQueue.empty() && m_neighboringInteriorQueue.empty() ) ) {
     bool wasSomethingUpdated = false;
+    std::chrono::steady_clock::time_point iterationStart{};
+    if (recordMetrics) {
+      iterationStart = std::chrono::steady_clock::now();
+      metricsExporter.setSimulationTime(m_clusters[0]->m_fullUpdateTime);
+    }
+
+    // the fastest cluster determines whether the trace window is open
+    seissol::monitoring::Trace::setSimulationTime(m_clusters[0]->m_fullUpdateTime);
+
 #ifdef USE_MPI
     const auto currentTime = std::chrono::steady_clock::now();
     const auto timeSinceLastUpdate = currentTime - lastUpdateTime;
@@ -386,15 +453,36 @@ void seissol::time_stepping::TimeManager::advanceInTime( const double &i_synchro
                          << " @ "                  << m_clusters[m_timeStepping.numberOfLocalClusters-1]->m_fullUpdateTime;
     }
 
+    // write the wave field snapshots which all ranks recorded in the meantime
+    if (m_waveFieldSnapshots != nullptr) {
+      m_waveFieldSnapshots->progress();
+    }
+
     if (wasSomethingUpdated) {
       lastUpdateTime = std::chrono::steady_clock::now();
+    } else if (recordMetrics) {
+      m_waitTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - iterationStart).count();
     }
   }
+
+  // the other modules might use collective operations at the synchronization point, hence all
+  // pending snapshots until this point have to be written first
+  if (m_waveFieldSnapshots != nullptr) {
+    m_waveFieldSnapshots->synchronize(i_synchronizationTime, getTimeTolerance());
+  }
 #ifdef ACL_DEVICE
   device.api->popLastProfilingMark();
 #endif
 }
 
+std::vector<double> seissol::time_stepping::TimeManager::getCellUpdates() const {
+  std::vector<double> cellUpdates(m_timeStepping.numberOfGlobalClusters, 0.0);
+  for (auto* cluster : m_clusters) {
+    cellUpdates[cluster->m_globalClusterId] += static_cast<double>(cluster->getNumberOfTimeSteps()) * cluster->getNumberOfCells();
+  }
+  return cellUpdates;
+}
+
 void seissol::time_stepping::TimeManager::printComputationTime()
 {
 #ifdef USE_MPI
@@ -403,6 +491,33 @@ void seissol::time_stepping::TimeManager::printComputationTime()
   m_loopStatistics.writeSamples();
 }
 
+void seissol::time_stepping::TimeManager::printClusterPerformance()
+{
+  const int rank = MPI::mpi.rank();
+  const unsigned numberOfClusters = m_timeStepping.numberOfGlobalClusters;
+
+  // hardware flops and bytes per global cluster
+  std::vector<double> counters(2 * numberOfClusters, 0.0);
+  for (auto* cluster : m_clusters) {
+    counters[2 * cluster->m_globalClusterId] += cluster->getAccumulatedHardwareFlops();
+    counters[2 * cluster->m_globalClusterId + 1] += cluster->getAccumulatedBytes();
+  }
+#ifdef USE_MPI
+  std::vector<double> totalCounters(counters.size());
+  MPI_Reduce(counters.data(), totalCounters.data(), counters.size(), MPI_DOUBLE, MPI_SUM, 0, MPI::mpi.comm());
+#else
+  std::vector<double>& totalCounters = counters;
+#endif
+
+  logInfo(rank) << "Modeled HW-GFLOP, GB and arithmetic intensity per time cluster:";
+  for (unsigned cluster = 0; cluster < numberOfClusters; ++cluster) {
+    const double flops = totalCounters[2 * cluster];
+    const double bytes = totalCounters[2 * cluster + 1];
+    logInfo(rank) << " Cluster" << cluster << ":" << flops * 1.e-9 << "HW-GFLOP," << bytes * 1.e-9 << "GB,"
+                  << ((bytes > 0.0) ? flops / bytes : 0.0) << "FLOP/byte";
+  }
+}
+
 double seissol::time_stepping::TimeManager::getTimeTolerance() {
   return 1E-5 * m_timeStepping.globalCflTimeStepWidths[0];
 }
@@ -410,9 +525,7 @@ double seissol::time_stepping::TimeManager::getTimeTolerance() {
 void seissol::time_stepping::TimeManager::setPointSourcesForClusters( sourceterm::ClusterMapping const* cms, sourceterm::PointSources const* pointSources )
 {
   for (unsigned cluster = 0; cluster < m_clusters.size(); ++cluster) {
-    m_clusters[cluster]->setPointSources( cms[cluster].cellToSources,
-                                          cms[cluster].numberOfMappings,
-                                          &pointSources[cluster] );
+    m_clusters[cluster]->setPointSources( &cms[cluster], &pointSources[cluster] );
   }
 }
 
@@ -423,9 +536,26 @@ void seissol::time_stepping::TimeManager::setReceiverClusters(writer::ReceiverWr
   }
 }
 
+void seissol::time_stepping::TimeManager::setWaveFieldSnapshots(writer::WaveFieldWriter& waveFieldWriter, unsigned numberOfCells)
+{
+  m_waveFieldSnapshots = waveFieldWriter.snapshots();
+  if (m_waveFieldSnapshots == nullptr) {
+    return;
+  }
+
+  m_waveFieldSnapshots->initialize(m_clusters.size(), numberOfCells);
+  for (unsigned cluster = 0; cluster < m_clusters.size(); ++cluster) {
+    m_clusters[cluster]->setWaveFieldSnapshots(m_waveFieldSnapshots);
+  }
+}
+
 void seissol::time_stepping::TimeManager::setInitialTimes( double i_time ) {
   assert( i_time >= 0 );
 
+  if (m_waveFieldSnapshots != nullptr) {
+    m_waveFieldSnapshots->setStartTime(i_time);
+  }
+
   for( unsigned int l_cluster = 0; l_cluster < m_clusters.size(); l_cluster++ ) {
     m_clusters[l_cluster]->m_predictionTime = i_time;
     m_clusters[l_cluster]->m_fullUpdateTime = i_time;
@@ -451,6 +581,8 @@ void seissol::time_stepping::TimeManager::pollForCommunication() {
   device::DeviceInstance::getInstance().api->setDevice(MPI::mpi.getDeviceID());
 #endif // ACL_DEVICE
 
+  seissol::monitoring::Trace::setThreadName("communication");
+
   //logInfo(0) << "Launching communication thread on OS core id:" << l_numberOfHWThreads;
 
   // now let's enter the polling loop
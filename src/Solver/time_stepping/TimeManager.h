@@ -60,6 +60,11 @@ namespace seissol {
   namespace time_stepping {
     class TimeManager;
   }
+
+  namespace writer {
+    class WaveFieldWriter;
+    class WaveFieldSnapshots;
+  }
 }
 
 /**
@@ -85,6 +90,9 @@ class seissol::time_stepping::TimeManager {
     //! all LTS clusters, which are under control of this time manager
     std::vector< TimeCluster* > m_clusters;
 
+    //! true if the previous cluster has dynamic rupture faces with a side in this cluster
+    std::vector<bool> m_slowerDynamicRuptureSides;
+
     //! queue of clusters, which are allowed to update their copy layer locally
     std::list< TimeCluster* > m_localCopyQueue;
 
@@ -99,6 +107,12 @@ class seissol::time_stepping::TimeManager {
     
     //! Stopwatch
     LoopStatistics m_loopStatistics;
+
+    //! wall time of the iterations in which no cluster could progress
+    double m_waitTime;
+
+    //! wave field snapshots recorded by the clusters (nullptr if written at synchronization points)
+    writer::WaveFieldSnapshots* m_waveFieldSnapshots;
     
     /**
      * Checks if the time stepping restrictions for this cluster and its neighbors changed.
@@ -117,11 +131,23 @@ class seissol::time_stepping::TimeManager {
      * A time cluster with id n is a neighbor of time clusters n-1 and n+1.
      * By performing a full time step update or providing a new time predicion in cluster n
      * clusters n-1 or n or n+1 migh now be allowed to perform a full update or a new prediction.
+     * With larger differences of the cluster ids of face neighbors, all coupled clusters are considered.
      *
      * @param i_localClusterId local cluster id of the cluster, which changed its status.
      **/
     void updateClusterDependencies( unsigned int i_localClusterId );
 
+    /**
+     * Checks if two time clusters might exchange buffers or derivatives.
+     * Adjacent local clusters are always coupled, others if the difference of the global ids does not exceed the maximum cluster difference.
+     *
+     * @param i_localClusterId local id of the first cluster.
+     * @param i_otherLocalClusterId local id of the second cluster.
+     * @return true if the clusters are coupled.
+     **/
+    bool areClustersCoupled( unsigned int i_localClusterId,
+                             unsigned int i_otherLocalClusterId ) const;
+
   public:
     /**
      * Construct a new time manager.
@@ -181,6 +207,15 @@ class seissol::time_stepping::TimeManager {
      */
     void setReceiverClusters(writer::ReceiverWriter& receiverWriter); 
 
+    /**
+     * Lets the clusters record the wave field snapshots if the wave field output is decoupled
+     * from the synchronization points.
+     *
+     * @param waveFieldWriter the wave field writer.
+     * @param numberOfCells number of cells with DOFs in the LTS tree.
+     */
+    void setWaveFieldSnapshots(writer::WaveFieldWriter& waveFieldWriter, unsigned numberOfCells);
+
     /**
      * Set Tv constant for plasticity.
      */
@@ -203,7 +238,23 @@ class seissol::time_stepping::TimeManager {
     }
 #endif
 
+    //! Wall time in seconds in which no cluster could progress, e.g. waiting for MPI
+    double getWaitTime() const {
+      return m_waitTime;
+    }
+
+    /**
+     * Returns the cell updates of every global time cluster on this rank so far.
+     **/
+    std::vector<double> getCellUpdates() const;
+
     void printComputationTime();
+
+    /**
+     * Prints the hardware flops, the modeled bytes and the arithmetic intensity of every
+     * global time cluster, summed over all ranks.
+     **/
+    void printClusterPerformance();
 };
 
 #endif
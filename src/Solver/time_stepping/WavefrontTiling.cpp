@@ -0,0 +1,127 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Wavefront-ordered tiles of a layer for fused local and neighboring integration.
+ **/
+
+#include "WavefrontTiling.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+void seissol::time_stepping::WavefrontTiling::initialize( unsigned                    numberOfCells,
+                                                          CellLocalInformation const* cellInformation,
+                                                          real*                     (*faceNeighbors)[4],
+                                                          real* const*                buffers,
+                                                          real* const*                derivatives,
+                                                          unsigned                    tileSize ) {
+  tileSize = std::max(tileSize, 1u);
+  const unsigned numTiles = (numberOfCells + tileSize - 1) / tileSize;
+
+  // cell of the layer which produces the time integrated data behind a face neighbor pointer
+  std::unordered_map<real const*, unsigned> producers;
+  producers.reserve(2 * numberOfCells);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    if (buffers[cell] != nullptr) {
+      producers[buffers[cell]] = cell;
+    }
+    if (derivatives[cell] != nullptr) {
+      producers[derivatives[cell]] = cell;
+    }
+  }
+
+  m_tileOffsets.assign(1, 0);
+  m_fusedOffsets.assign(1, 0);
+  m_dependencyOffsets.assign(1, 0);
+  m_fusedCells.clear();
+  m_dependencies.clear();
+  m_remainingCells.clear();
+
+  std::vector<unsigned> tileDependencies;
+  for (unsigned tile = 0; tile < numTiles; ++tile) {
+    const unsigned begin = tile * tileSize;
+    const unsigned end = std::min(begin + tileSize, numberOfCells);
+
+    tileDependencies.clear();
+    for (unsigned cell = begin; cell < end; ++cell) {
+      bool fused = true;
+      unsigned neighborTiles[4];
+      unsigned numNeighborTiles = 0;
+      for (unsigned face = 0; face < 4 && fused; ++face) {
+        const FaceType faceType = cellInformation[cell].faceTypes[face];
+        // same faces as in TimeCommon::computeIntegrals
+        if (faceType == FaceType::outflow) {
+          continue;
+        }
+        // requires the friction law to be evaluated first
+        if (faceType == FaceType::dynamicRupture) {
+          fused = false;
+          break;
+        }
+        auto producer = producers.find(faceNeighbors[cell][face]);
+        if (producer == producers.end()) {
+          // data of the copy layer, the ghost layer or another cluster
+          fused = false;
+        } else {
+          neighborTiles[numNeighborTiles++] = producer->second / tileSize;
+        }
+      }
+
+      if (fused) {
+        m_fusedCells.push_back(cell);
+        for (unsigned neighbor = 0; neighbor < numNeighborTiles; ++neighbor) {
+          if (neighborTiles[neighbor] != tile) {
+            tileDependencies.push_back(neighborTiles[neighbor]);
+          }
+        }
+      } else {
+        m_remainingCells.push_back(cell);
+      }
+    }
+
+    std::sort(tileDependencies.begin(), tileDependencies.end());
+    tileDependencies.erase(std::unique(tileDependencies.begin(), tileDependencies.end()), tileDependencies.end());
+    m_dependencies.insert(m_dependencies.end(), tileDependencies.begin(), tileDependencies.end());
+
+    m_tileOffsets.push_back(end);
+    m_fusedOffsets.push_back(m_fusedCells.size());
+    m_dependencyOffsets.push_back(m_dependencies.size());
+  }
+
+  m_localDone = std::make_unique<std::atomic<unsigned>[]>(numTiles);
+  for (unsigned tile = 0; tile < numTiles; ++tile) {
+    m_localDone[tile].store(0, std::memory_order_relaxed);
+  }
+  m_step = 0;
+}
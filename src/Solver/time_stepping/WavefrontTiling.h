@@ -0,0 +1,186 @@
+/**
+ * @file
+ * This file is part of SeisSol.
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, SeisSol Group
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Wavefront-ordered tiles of a layer for fused local and neighboring integration.
+ **/
+
+#ifndef WAVEFRONTTILING_H_
+#define WAVEFRONTTILING_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <Initializer/typedefs.hpp>
+
+namespace seissol {
+  namespace time_stepping {
+    class WavefrontTiling;
+  }
+}
+
+/**
+ * Splits a layer into tiles of consecutive cells.
+ *
+ * A cell is fused if all time integrated data read by its neighboring integration
+ * is produced by local integrations of cells in the same layer. The neighboring
+ * integration of the fused cells of a tile runs as soon as the local integration of
+ * all tiles it depends on is finished, while their buffers are still in cache.
+ * All other cells of the layer are left to the regular neighboring integration.
+ **/
+class seissol::time_stepping::WavefrontTiling {
+  private:
+    //! first cell of every tile (numberOfTiles + 1 entries)
+    std::vector<unsigned> m_tileOffsets;
+
+    //! fused cells of every tile in CSR format
+    std::vector<unsigned> m_fusedOffsets;
+    std::vector<unsigned> m_fusedCells;
+
+    //! tiles whose local integration a tile waits for in CSR format
+    std::vector<unsigned> m_dependencyOffsets;
+    std::vector<unsigned> m_dependencies;
+
+    //! cells which are not fused, in ascending order
+    std::vector<unsigned> m_remainingCells;
+
+    //! time step in which the local integration of a tile was completed last
+    std::unique_ptr<std::atomic<unsigned>[]> m_localDone;
+    unsigned m_step = 0;
+
+    bool isReady(unsigned tile, unsigned step) const {
+      for (unsigned dep = m_dependencyOffsets[tile]; dep < m_dependencyOffsets[tile+1]; ++dep) {
+        if (m_localDone[m_dependencies[dep]].load(std::memory_order_acquire) != step) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+  public:
+    /**
+     * Classifies the cells and derives the tiles and their dependencies.
+     *
+     * @param numberOfCells number of cells in the layer.
+     * @param cellInformation cell local information of the layer.
+     * @param faceNeighbors time integrated data read by the neighboring integration.
+     * @param buffers time buffers of the layer.
+     * @param derivatives time derivatives of the layer.
+     * @param tileSize number of cells per tile.
+     **/
+    void initialize( unsigned                    numberOfCells,
+                     CellLocalInformation const* cellInformation,
+                     real*                     (*faceNeighbors)[4],
+                     real* const*                buffers,
+                     real* const*                derivatives,
+                     unsigned                    tileSize );
+
+    unsigned numberOfTiles() const {
+      return m_tileOffsets.empty() ? 0 : m_tileOffsets.size() - 1;
+    }
+
+    unsigned numberOfFusedCells() const {
+      return m_fusedCells.size();
+    }
+
+    std::vector<unsigned> const& remainingCells() const {
+      return m_remainingCells;
+    }
+
+    /**
+     * Runs local(cell, state) for all cells and neighbor(cell) for all fused cells.
+     * Every thread processes a contiguous range of tiles; neighboring integrations of tiles
+     * which depend on tiles of other threads are deferred until they are available.
+     * Every thread creates one ThreadState, e.g. the temporary memory of the local integration.
+     **/
+    template<typename ThreadState, typename LocalFunction, typename NeighborFunction>
+    void execute(LocalFunction&& local, NeighborFunction&& neighbor) {
+      const unsigned step = ++m_step;
+      const unsigned numTiles = numberOfTiles();
+
+#ifdef _OPENMP
+      #pragma omp parallel
+#endif
+      {
+#ifdef _OPENMP
+        const unsigned numThreads = omp_get_num_threads();
+        const unsigned thread = omp_get_thread_num();
+#else
+        const unsigned numThreads = 1;
+        const unsigned thread = 0;
+#endif
+        const unsigned firstTile = static_cast<unsigned long>(numTiles) * thread / numThreads;
+        const unsigned lastTile = static_cast<unsigned long>(numTiles) * (thread+1) / numThreads;
+
+        auto neighborTile = [&](unsigned tile) {
+          for (unsigned fused = m_fusedOffsets[tile]; fused < m_fusedOffsets[tile+1]; ++fused) {
+            neighbor(m_fusedCells[fused]);
+          }
+        };
+
+        ThreadState state;
+        std::vector<unsigned> pending;
+        for (unsigned tile = firstTile; tile < lastTile; ++tile) {
+          for (unsigned cell = m_tileOffsets[tile]; cell < m_tileOffsets[tile+1]; ++cell) {
+            local(cell, state);
+          }
+          m_localDone[tile].store(step, std::memory_order_release);
+          pending.push_back(tile);
+
+          unsigned numPending = 0;
+          for (unsigned pendingTile : pending) {
+            if (isReady(pendingTile, step)) {
+              neighborTile(pendingTile);
+            } else {
+              pending[numPending++] = pendingTile;
+            }
+          }
+          pending.resize(numPending);
+        }
+
+#ifdef _OPENMP
+        #pragma omp barrier
+#endif
+        for (unsigned pendingTile : pending) {
+          neighborTile(pendingTile);
+        }
+      }
+    }
+};
+
+#endif
@@ -71,6 +71,7 @@
 #include "Parallel/MPI.h"
 
 #include "Manager.h"
+#include "SeisSol.h"
 #include "NRFReader.h"
 #include "PointSource.h"
 #include "Numerical_aux/Transformation.h"
@@ -81,7 +82,10 @@
 #include <Initializer/PointMapper.h>
 #include <Solver/Interoperability.h>
 #include <utils/logger.h>
+#include <algorithm>
 #include <cstring>
+#include <limits>
+#include <vector>
 
 template<typename T>
 class index_sort_by_value
@@ -95,6 +99,40 @@ public:
     }
 };
 
+/**
+ * Finds the cells which contain the point sources. The cells only depend on the mesh and the
+ * positions of the sources, hence a previous run of the same configuration may have cached them.
+ */
+static void findPointSourceCells( Eigen::Vector3d const*  centres,
+                                  MeshReader const&       mesh,
+                                  unsigned                numberOfSources,
+                                  short*                  contained,
+                                  unsigned*               meshIds ) {
+  const int rank = seissol::MPI::mpi.rank();
+
+  auto& setupCache = seissol::SeisSol::main.setupCache();
+  if (setupCache.enabled()) {
+    setupCache.addData(centres, numberOfSources * sizeof(Eigen::Vector3d));
+  }
+  const std::vector<seissol::initializers::SetupCache::Block> cachedCells{
+    {contained, numberOfSources * sizeof(short)},
+    {meshIds, numberOfSources * sizeof(unsigned)}};
+  if (setupCache.read("point-source-cells", cachedCells)) {
+    logInfo(rank) << "Point source cells restored from the setup cache.";
+    return;
+  }
+
+  logInfo(rank) << "Finding meshIds for point sources...";
+  seissol::initializers::findMeshIds(centres, mesh, numberOfSources, contained, meshIds);
+
+#ifdef USE_MPI
+  logInfo(rank) << "Cleaning possible double occurring point sources for MPI...";
+  seissol::initializers::cleanDoubles(contained, numberOfSources);
+#endif
+
+  setupCache.write("point-source-cells", cachedCells);
+}
+
 /**
  * Computes mInvJInvPhisAtSources[i] = |J|^-1 * M_ii^-1 * phi_i(xi, eta, zeta),
  * where xi, eta, zeta is the point in the reference tetrahedron corresponding to x, y, z.
@@ -176,6 +214,27 @@ void seissol::sourceterm::transformNRFSourceToInternalSource( Eigen::Vector3d co
                                         subfault.timestep,
                                         &pointSources.slipRates[index][sr] );
   }
+
+  computeNRFMoments(faultBasis, pointSources.A[index], pointSources.stiffnessTensor[index], pointSources.nrfMoments[index].data());
+}
+
+void seissol::sourceterm::Manager::setMemberWeights(PointSources& pointSources,
+                                                    ClusterMapping const& clusterMapping,
+                                                    unsigned const* originalIndex)
+{
+#ifdef MULTIPLE_SIMULATIONS
+  auto const& ensemble = seissol::SeisSol::main.ensemble();
+  if (!ensemble.isConfigured()) {
+    return;
+  }
+
+  pointSources.memberWeights.resize(clusterMapping.numberOfSources);
+  for (unsigned clusterSource = 0; clusterSource < clusterMapping.numberOfSources; ++clusterSource) {
+    auto& weights = pointSources.memberWeights[clusterSource].values;
+    std::fill(std::begin(weights), std::end(weights), 0.0);
+    ensemble.sourceWeights(originalIndex[clusterMapping.sources[clusterSource]], weights);
+  }
+#endif
 }
 
 void seissol::sourceterm::Manager::freeSources()
@@ -186,6 +245,40 @@ void seissol::sourceterm::Manager::freeSources()
   sources = NULL;
 }
 
+void seissol::sourceterm::Manager::computeActiveWindows(unsigned numberOfClusters)
+{
+  for (unsigned cluster = 0; cluster < numberOfClusters; ++cluster) {
+    PointSources& pointSources = sources[cluster];
+    pointSources.onsetTime.resize(pointSources.numberOfSources);
+    pointSources.endTime.resize(pointSources.numberOfSources);
+    for (unsigned source = 0; source < pointSources.numberOfSources; ++source) {
+      double onsetTime = std::numeric_limits<double>::max();
+      double endTime = std::numeric_limits<double>::lowest();
+      for (auto const& slipRate : pointSources.slipRates[source]) {
+        double srOnsetTime, srEndTime;
+        computePwLFSupport(slipRate, srOnsetTime, srEndTime);
+        onsetTime = std::min(onsetTime, srOnsetTime);
+        endTime = std::max(endTime, srEndTime);
+      }
+      pointSources.onsetTime[source] = onsetTime;
+      pointSources.endTime[source] = endTime;
+    }
+
+    ClusterMapping& cm = cmps[cluster];
+    cm.mappingOnsetTime.resize(cm.numberOfMappings);
+    cm.mappingEndTime.resize(cm.numberOfMappings);
+    cm.mappingsByOnset.resize(cm.numberOfMappings);
+    for (unsigned mapping = 0; mapping < cm.numberOfMappings; ++mapping) {
+      unsigned first = cm.cellToSources[mapping].pointSourcesOffset;
+      unsigned last = first + cm.cellToSources[mapping].numberOfPointSources;
+      cm.mappingOnsetTime[mapping] = *std::min_element(pointSources.onsetTime.data() + first, pointSources.onsetTime.data() + last);
+      cm.mappingEndTime[mapping] = *std::max_element(pointSources.endTime.data() + first, pointSources.endTime.data() + last);
+      cm.mappingsByOnset[mapping] = mapping;
+    }
+    std::sort(cm.mappingsByOnset.begin(), cm.mappingsByOnset.end(), index_sort_by_value<double>(cm.mappingOnsetTime.data()));
+  }
+}
+
 void seissol::sourceterm::Manager::mapPointSourcesToClusters( unsigned const*                 meshIds,
                                                               unsigned                        numberOfSources,
                                                               seissol::initializers::LTSTree* ltsTree,
@@ -285,14 +378,7 @@ void seissol::sourceterm::Manager::loadSourcesFromFSRM( double const*
     centres3[source](2) = centres[3*source + 2];
   }
 
-  logInfo(rank) << "Finding meshIds for point sources...";
-
-  initializers::findMeshIds(centres3, mesh, numberOfSources, contained, meshIds);
-
-#ifdef USE_MPI
-  logInfo(rank) << "Cleaning possible double occurring point sources for MPI...";
-  initializers::cleanDoubles(contained, numberOfSources);
-#endif
+  findPointSourceCells(centres3, mesh, numberOfSources, contained, meshIds);
 
   unsigned* originalIndex = new unsigned[numberOfSources];
   unsigned numSources = 0;
@@ -368,11 +454,13 @@ void seissol::sourceterm::Manager::loadSourcesFromFSRM( double const*
                                           timestep,
                                           &sources[cluster].slipRates[clusterSource][0] );
     }
+    setMemberWeights(sources[cluster], cmps[cluster], originalIndex);
   }
   delete[] originalIndex;
   delete[] meshIds;
   delete[] centres3;
 
+  computeActiveWindows(ltsTree->numChildren());
   timeManager.setPointSourcesForClusters(cmps, sources);
   
   logInfo(rank) << ".. finished point source initialization.";
@@ -402,13 +490,7 @@ void seissol::sourceterm::Manager::loadSourcesFromNRF(  char const*
   short* contained = new short[nrf.source];
   unsigned* meshIds = new unsigned[nrf.source];
 
-  logInfo(rank) << "Finding meshIds for point sources...";
-  initializers::findMeshIds(nrf.centres, mesh, nrf.source, contained, meshIds);
-
-#ifdef USE_MPI
-  logInfo(rank) << "Cleaning possible double occurring point sources for MPI...";
-  initializers::cleanDoubles(contained, nrf.source);
-#endif
+  findPointSourceCells(nrf.centres, mesh, nrf.source, contained, meshIds);
 
   unsigned* originalIndex = new unsigned[nrf.source];
   unsigned numSources = 0;
@@ -450,6 +532,7 @@ void seissol::sourceterm::Manager::loadSourcesFromNRF(  char const*
     sources[cluster].A.resize(cmps[cluster].numberOfSources);
     sources[cluster].stiffnessTensor.resize(cmps[cluster].numberOfSources);
     sources[cluster].slipRates.resize(cmps[cluster].numberOfSources);
+    sources[cluster].nrfMoments.resize(cmps[cluster].numberOfSources);
 
     for (unsigned clusterSource = 0; clusterSource < cmps[cluster].numberOfSources; ++clusterSource) {
       unsigned sourceIndex = cmps[cluster].sources[clusterSource];
@@ -465,10 +548,12 @@ void seissol::sourceterm::Manager::loadSourcesFromNRF(  char const*
                                           sources[cluster],
                                           clusterSource );
     }
+    setMemberWeights(sources[cluster], cmps[cluster], originalIndex);
   }
   delete[] originalIndex;
   delete[] meshIds;
 
+  computeActiveWindows(ltsTree->numChildren());
   timeManager.setPointSourcesForClusters(cmps, sources);
   
   logInfo(rank) << ".. finished point source initialization.";
@@ -76,6 +76,12 @@ private:
 
   void freeSources();
 
+  /** Determines the active windows of all point sources and mappings and sorts the mappings by onset. */
+  void computeActiveWindows(unsigned numberOfClusters);
+
+  /** Sets the weights of the sources of a cluster in the fused simulations from the ensemble description. */
+  void setMemberWeights(PointSources& pointSources, ClusterMapping const& clusterMapping, unsigned const* originalIndex);
+
 public:
   Manager() : cmps(NULL), sources(NULL) {}
   ~Manager() { freeSources(); }
@@ -42,6 +42,7 @@
 #include "PointSource.h"
 #include <cmath>
 #include <algorithm>
+#include <limits>
 #include <generated_code/kernel.h>
 #include <generated_code/init.h>
 #include <iostream>
@@ -119,6 +120,19 @@ void seissol::sourceterm::transformMomentTensor(real const i_localMomentTensor[3
 #endif
 }
 
+void seissol::sourceterm::computePwLFSupport(PiecewiseLinearFunction1D const& i_pwLF,
+                                             double& o_onsetTime,
+                                             double& o_endTime)
+{
+  if (i_pwLF.numberOfPieces == 0) {
+    o_onsetTime = std::numeric_limits<double>::max();
+    o_endTime = std::numeric_limits<double>::lowest();
+  } else {
+    o_onsetTime = i_pwLF.onsetTime;
+    o_endTime = i_pwLF.onsetTime + i_pwLF.numberOfPieces * static_cast<double>(i_pwLF.samplingInterval);
+  }
+}
+
 real seissol::sourceterm::computePwLFTimeIntegral(PiecewiseLinearFunction1D const& i_pwLF,
                                                double i_fromTime,
                                                double i_toTime)
@@ -147,6 +161,44 @@ real seissol::sourceterm::computePwLFTimeIntegral(PiecewiseLinearFunction1D cons
    return l_integral;
 }
 
+void seissol::sourceterm::computeNRFMoments( real const faultBasis[9],
+                                             real A,
+                                             std::array<real, 81> const& stiffnessTensor,
+                                             real o_moments[3 * PointSources::TensorSize] )
+{
+  // A source at a point with phi = (1, 0, ..., 0) writes its moment to the first basis function
+  alignas(ALIGNMENT) real unitPhi[tensor::mInvJInvPhisAtSources::size()] = {};
+  unitPhi[0] = 1.0;
+  alignas(ALIGNMENT) real dofs[tensor::Q::size()];
+  auto dofsView = init::Q::view::create(dofs);
+
+  std::fill(o_moments, o_moments + 3 * PointSources::TensorSize, 0.0);
+  for (unsigned i = 0; i < 3; ++i) {
+    std::fill(dofs, dofs + tensor::Q::size(), 0.0);
+
+    kernel::sourceNRF krnl;
+    krnl.Q = dofs;
+    krnl.mInvJInvPhisAtSources = unitPhi;
+    krnl.stiffnessTensor = stiffnessTensor.data();
+    krnl.mSlip = faultBasis + 3*i;
+    krnl.mNormal = faultBasis + 6;
+    krnl.mArea = -A;
+    krnl.momentToNRF = init::momentToNRF::Values;
+#ifdef MULTIPLE_SIMULATIONS
+    krnl.oneSimToMultSim = init::oneSimToMultSim::Values;
+#endif
+    krnl.execute();
+
+    for (unsigned q = 0; q < NUMBER_OF_QUANTITIES; ++q) {
+#ifdef MULTIPLE_SIMULATIONS
+      o_moments[i * PointSources::TensorSize + q] = dofsView(0, 0, q);
+#else
+      o_moments[i * PointSources::TensorSize + q] = dofsView(0, q);
+#endif
+    }
+  }
+}
+
 void seissol::sourceterm::addTimeIntegratedPointSourceNRF( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
                                                            real const faultBasis[9],
                                                            real A,
@@ -201,3 +253,79 @@ void seissol::sourceterm::addTimeIntegratedPointSourceFSRM( real const i_mInvJIn
 #endif
   krnl.execute();
 }
+
+void seissol::sourceterm::addTimeIntegratedPointSources( PointSources const& sources,
+                                                         unsigned firstSource,
+                                                         unsigned numberOfSources,
+                                                         double i_fromTime,
+                                                         double i_toTime,
+                                                         real o_dofUpdate[tensor::Q::size()] )
+{
+  constexpr unsigned BatchSize = 16;
+  constexpr unsigned TensorSize = PointSources::TensorSize;
+  static_assert(tensor::momentFSRM::size() <= TensorSize, "Moments do not fit into the tensor of a point source.");
+
+  unsigned batch[BatchSize];
+  real slip[BatchSize][3];
+  alignas(ALIGNMENT) real moments[BatchSize][TensorSize];
+
+  const unsigned endSource = firstSource + numberOfSources;
+  for (unsigned batchStart = firstSource; batchStart < endSource; batchStart += BatchSize) {
+    const unsigned batchEnd = std::min(batchStart + BatchSize, endSource);
+
+    // select the sources which are active in [fromTime, toTime]
+    unsigned numActive = 0;
+    for (unsigned source = batchStart; source < batchEnd; ++source) {
+      if (sources.onsetTime[source] < i_toTime && sources.endTime[source] > i_fromTime) {
+        batch[numActive++] = source;
+      }
+    }
+
+    // time integrals of the slip rates
+    for (unsigned b = 0; b < numActive; ++b) {
+      auto const& slipRates = sources.slipRates[batch[b]];
+      for (unsigned i = 0; i < 3; ++i) {
+        slip[b][i] = (slipRates[i].numberOfPieces > 0) ? computePwLFTimeIntegral(slipRates[i], i_fromTime, i_toTime) : 0.0;
+      }
+    }
+
+    // moments of the sources
+    if (sources.mode == PointSources::NRF) {
+      for (unsigned b = 0; b < numActive; ++b) {
+        real const* nrfMoments = sources.nrfMoments[batch[b]].data();
+#pragma omp simd
+        for (unsigned q = 0; q < TensorSize; ++q) {
+          moments[b][q] = slip[b][0] * nrfMoments[q]
+                        + slip[b][1] * nrfMoments[TensorSize + q]
+                        + slip[b][2] * nrfMoments[2*TensorSize + q];
+        }
+      }
+    } else {
+      for (unsigned b = 0; b < numActive; ++b) {
+        real const* forceComponents = sources.tensor[batch[b]];
+#pragma omp simd
+        for (unsigned q = 0; q < TensorSize; ++q) {
+          moments[b][q] = slip[b][0] * forceComponents[q];
+        }
+      }
+    }
+
+    // rank-1 updates of the cell's DOFs
+    kernel::sourceFSRM krnl;
+    krnl.Q = o_dofUpdate;
+    krnl.stfIntegral = 1.0;
+#ifdef MULTIPLE_SIMULATIONS
+    krnl.oneSimToMultSim = init::oneSimToMultSim::Values;
+#endif
+    for (unsigned b = 0; b < numActive; ++b) {
+      krnl.mInvJInvPhisAtSources = sources.mInvJInvPhisAtSources[batch[b]];
+      krnl.momentFSRM = moments[b];
+#ifdef MULTIPLE_SIMULATIONS
+      if (!sources.memberWeights.empty()) {
+        krnl.oneSimToMultSim = sources.memberWeights[batch[b]].values;
+      }
+#endif
+      krnl.execute();
+    }
+  }
+}
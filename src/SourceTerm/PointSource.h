@@ -123,11 +123,24 @@ namespace seissol {
       }
     }
 
+    /** Returns the time window [o_onsetTime, o_endTime] outside of which i_pwLF vanishes.
+     *  The window is empty (o_onsetTime > o_endTime) if i_pwLF has no pieces. */
+    void computePwLFSupport(PiecewiseLinearFunction1D const& i_pwLF,
+                            double& o_onsetTime,
+                            double& o_endTime);
+
     /** Returns integral_fromTime^toTime i_pwLF dt. */
     real computePwLFTimeIntegral(PiecewiseLinearFunction1D const& i_pwLF,
                                  double i_fromTime,
                                  double i_toTime);
 
+    /** Computes the moments of unit slip in the directions of the fault basis,
+     *  i.e. the NRF moment is linear in the slip with these moments as coefficients. */
+    void computeNRFMoments( real const faultBasis[9],
+                            real A,
+                            std::array<real, 81> const& stiffnessTensor,
+                            real o_moments[3 * PointSources::TensorSize] );
+
     void addTimeIntegratedPointSourceNRF( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
                                           real const faultBasis[9],
                                           real A,
@@ -150,6 +163,19 @@ namespace seissol {
                                            double i_fromTime,
                                            double i_toTime,
                                            real o_dofUpdate[tensor::Q::size()] );
+
+    /**
+     * Adds the contribution of the point sources [firstSource, firstSource + numberOfSources),
+     * which must lie in the same cell, in the time interval [i_fromTime, i_toTime].
+     * Sources outside of their active window are skipped. The slip rate integrals and the moments
+     * of the active sources are evaluated in batches before the DOFs are updated.
+     **/
+    void addTimeIntegratedPointSources( PointSources const& sources,
+                                        unsigned firstSource,
+                                        unsigned numberOfSources,
+                                        double i_fromTime,
+                                        double i_toTime,
+                                        real o_dofUpdate[tensor::Q::size()] );
   }
 }
 
@@ -91,6 +91,24 @@ namespace seissol {
        * FSRM: 0: slip rate (all directions) */
       std::vector<std::array<PiecewiseLinearFunction1D, 3>> slipRates;
 
+      /** NRF: Moment of unit slip in Tan1, Tan2, and Normal direction (scaled with the area),
+       * such that the moment of a source is sum_i slip_i * nrfMoments[i*TensorSize + :]. */
+      std::vector<std::array<real, 3 * TensorSize>> nrfMoments;
+
+#ifdef MULTIPLE_SIMULATIONS
+      struct alignas(ALIGNMENT) MemberWeights {
+        real values[tensor::oneSimToMultSim::Size];
+      };
+
+      /** Weight of every source in each fused simulation, empty if all sources act on all
+       *  simulations with unit weight. */
+      std::vector<MemberWeights> memberWeights;
+#endif
+
+      /** All slip rates of a source vanish outside of [onsetTime, endTime]. */
+      std::vector<double> onsetTime;
+      std::vector<double> endTime;
+
       /** Number of point sources in this struct. */
       unsigned numberOfSources;
 
@@ -118,6 +136,13 @@ namespace seissol {
       unsigned                   numberOfSources;
       CellToPointSourcesMapping* cellToSources;
       unsigned                   numberOfMappings;
+
+      /** Union of the active windows of the point sources of every mapping. */
+      std::vector<double>        mappingOnsetTime;
+      std::vector<double>        mappingEndTime;
+
+      /** Mappings in ascending order of mappingOnsetTime. */
+      std::vector<unsigned>      mappingsByOnset;
       
       ClusterMapping() : sources(NULL), numberOfSources(0), cellToSources(NULL), numberOfMappings(0) {}
       ~ClusterMapping() { delete[] sources; numberOfSources = 0; delete[] cellToSources; numberOfMappings = 0; }
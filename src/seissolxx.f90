@@ -198,6 +198,12 @@ domain%IO%UNIT%maxThisDom              = 69999                        ! Obere Gr
        OptionalFields = domain%OptionalFields    , &  
        IO             = domain%IO                , &
        programTitle   = domain%programTitle        )
+
+  ! the memory dry run ends after the setup, SeisSol is finalized by the caller
+  IF (c_interoperability_isSetupStopped()) THEN
+    RETURN
+  ENDIF
+
 domain%IO%MPIPickCleaningDone = 0
 
     logInfo0(*) '<--------------------------------------------------------->'  !
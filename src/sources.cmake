@@ -12,6 +12,8 @@ src/Initializer/time_stepping/LtsLayout.cpp
 src/Initializer/tree/Lut.cpp
 src/Initializer/MemoryManager.cpp
 src/Initializer/InitialFieldProjection.cpp
+src/Initializer/Ensemble.cpp
+src/Initializer/SetupCache.cpp
 src/Modules/Modules.cpp
 src/Modules/ModulesC.cpp
 src/Model/common.cpp
@@ -25,6 +27,9 @@ src/Solver/Interoperability.cpp
 src/Solver/time_stepping/MiniSeisSol.cpp
 src/Solver/time_stepping/TimeCluster.cpp
 src/Solver/time_stepping/TimeManager.cpp
+src/Solver/time_stepping/WavefrontTiling.cpp
+src/Solver/time_stepping/BoundaryFaceLists.cpp
+src/Solver/time_stepping/LockedDrFaces.cpp
 src/Solver/Pipeline/DrTuner.cpp
 src/Kernels/DynamicRupture.cpp
 src/Kernels/Plasticity.cpp
@@ -44,6 +49,9 @@ src/Geometry/MeshReaderFBinding.cpp
 src/Geometry/MeshTools.cpp
 src/Monitoring/FlopCounter.cpp
 src/Monitoring/LoopStatistics.cpp
+src/Monitoring/Metrics.cpp
+src/Monitoring/Roofline.cpp
+src/Monitoring/Trace.cpp
 src/Reader/readparC.cpp
 #Reader/StressReaderC.cpp
 src/Checkpoint/Manager.cpp
@@ -64,6 +72,7 @@ src/ResultWriter/ReceiverWriter.cpp
 src/ResultWriter/FaultWriterExecutor.cpp
 src/ResultWriter/FaultWriter.cpp
 src/ResultWriter/WaveFieldWriter.cpp
+src/ResultWriter/WaveFieldSnapshots.cpp
 src/ResultWriter/FreeSurfaceWriter.cpp
 
 # Fortran:
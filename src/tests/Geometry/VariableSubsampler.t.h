@@ -1,6 +1,8 @@
 #include <array>
 #include <iostream>
 #include <iomanip>
+#include <limits>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -50,6 +52,62 @@ TEST_CASE("Variable Subsampler") {
     for (int i = 0; i < 36; i++) {
       REQUIRE(outDofs[i] == AbsApprox(expectedDOFs[i]).epsilon(epsilon));
     }
+
+    // all variables in a single pass
+    std::fill(std::begin(outDofs), std::end(outDofs), 0);
+    std::vector<int> variables;
+    std::vector<real*> outBuffers;
+    for (unsigned var = 0; var < 9; var++) {
+      variables.push_back(var);
+      outBuffers.push_back(&outDofs[var * 4]);
+    }
+    REQUIRE(subsampler.get(dofs.data(), cellMap, variables, outBuffers.data()));
+    for (int i = 0; i < 36; i++) {
+      REQUIRE(outDofs[i] == AbsApprox(expectedDOFs[i]).epsilon(epsilon));
+    }
+
+    dofs[0] = std::numeric_limits<real>::quiet_NaN();
+    REQUIRE(!subsampler.get(dofs.data(), cellMap, variables, outBuffers.data()));
+  };
+
+  SUBCASE("Fused simulations") {
+    constexpr unsigned numSimulations = 3;
+    seissol::refinement::DivideTetrahedronBy4<double> refineBy4;
+    seissol::refinement::VariableSubsampler<double> subsampler(1, refineBy4, 3, 9, 12);
+    // The DOFs of the simulations are interleaved, i.e. (simulation, basis function, quantity)
+    seissol::refinement::VariableSubsampler<double> fusedSubsampler(
+        1, refineBy4, 3, 9, numSimulations * 10, numSimulations);
+
+    std::array<std::array<real, 108>, numSimulations> dofs{};
+    std::array<real, numSimulations * 90> fusedDofs{};
+    for (unsigned sim = 0; sim < numSimulations; sim++) {
+      for (unsigned var = 0; var < 9; var++) {
+        for (unsigned basis = 0; basis < 10; basis++) {
+          dofs[sim][var * 12 + basis] = (real)std::rand() / RAND_MAX;
+          fusedDofs[sim + numSimulations * (basis + 10 * var)] = dofs[sim][var * 12 + basis];
+        }
+      }
+    }
+    unsigned int cellMap[1] = {0};
+
+    std::vector<int> variables;
+    std::vector<real*> outBuffers;
+    std::array<real, numSimulations * 36> fusedOutDofs{};
+    for (unsigned var = 0; var < numSimulations * 9; var++) {
+      variables.push_back(var);
+      outBuffers.push_back(&fusedOutDofs[var * 4]);
+    }
+    REQUIRE(fusedSubsampler.get(fusedDofs.data(), cellMap, variables, outBuffers.data()));
+
+    for (unsigned sim = 0; sim < numSimulations; sim++) {
+      real outDofs[36];
+      for (unsigned var = 0; var < 9; var++) {
+        subsampler.get(dofs[sim].data(), cellMap, var, &outDofs[var * 4]);
+      }
+      for (int i = 0; i < 36; i++) {
+        REQUIRE(fusedOutDofs[sim * 36 + i] == AbsApprox(outDofs[i]).epsilon(epsilon));
+      }
+    }
   };
 };
 
@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Initializer/SetupCache.h"
+
+namespace seissol::unit_test {
+
+namespace {
+void writeFile(const char* fileName, std::string const& content) {
+  std::ofstream file(fileName, std::ios::trunc);
+  file << content;
+}
+
+initializers::SetupCache createSetupCache(std::uint64_t value) {
+  initializers::SetupCache setupCache;
+  setupCache.init();
+  setupCache.addEasiFile("setupCacheMaterial.yaml");
+  setupCache.addValue(value);
+  return setupCache;
+}
+} // namespace
+
+TEST_CASE("Setup cache keys are invalidated by changed inputs") {
+  setenv("SEISSOL_SETUP_CACHE", ".", 1);
+  writeFile("setupCacheMaterial.yaml", "!Switch\n"
+                                       "[rho]: !Include setupCacheLayer.yaml # a comment\n"
+                                       "[mu, lambda]: !ASAGI\n"
+                                       "  file: setupCacheGrid.nc\n"
+                                       "  parameters: [mu, lambda]\n");
+  writeFile("setupCacheLayer.yaml", "!ConstantMap\nmap:\n  rho: 2500\n");
+  writeFile("setupCacheGrid.nc", "grid");
+
+  std::vector<double> stored{1.0, 2.0, 3.0};
+  std::vector<double> restored(stored.size(), 0.0);
+  const std::vector<initializers::SetupCache::Block> storedBlocks{{stored.data(), stored.size() * sizeof(double)}};
+  const std::vector<initializers::SetupCache::Block> restoredBlocks{{restored.data(), restored.size() * sizeof(double)}};
+
+  createSetupCache(1).write("test", storedBlocks);
+  const auto cacheFile = createSetupCache(1).fileName("test");
+
+  SUBCASE("Same key") {
+    REQUIRE(createSetupCache(1).read("test", restoredBlocks));
+    REQUIRE(restored == stored);
+  }
+
+  SUBCASE("Different size") {
+    REQUIRE(!createSetupCache(1).read("test", {{restored.data(), 2 * sizeof(double)}}));
+  }
+
+  SUBCASE("Different data of the setup") {
+    REQUIRE(!createSetupCache(2).read("test", restoredBlocks));
+  }
+
+  SUBCASE("Changed include") {
+    writeFile("setupCacheLayer.yaml", "!ConstantMap\nmap:\n  rho: 2600\n");
+    REQUIRE(!createSetupCache(1).read("test", restoredBlocks));
+  }
+
+  SUBCASE("Changed grid") {
+    writeFile("setupCacheGrid.nc", "changed grid");
+    REQUIRE(!createSetupCache(1).read("test", restoredBlocks));
+  }
+
+  SUBCASE("Changed comment") {
+    // comments are part of the file content, and hence of the key
+    writeFile("setupCacheMaterial.yaml", "!Switch\n"
+                                         "[rho]: !Include setupCacheLayer.yaml # another comment\n"
+                                         "[mu, lambda]: !ASAGI\n"
+                                         "  file: setupCacheGrid.nc\n"
+                                         "  parameters: [mu, lambda]\n");
+    REQUIRE(!createSetupCache(1).read("test", restoredBlocks));
+  }
+
+  std::remove(cacheFile.c_str());
+  for (const char* fileName : {"setupCacheMaterial.yaml", "setupCacheLayer.yaml", "setupCacheGrid.nc"}) {
+    std::remove(fileName);
+  }
+  unsetenv("SEISSOL_SETUP_CACHE");
+}
+
+} // namespace seissol::unit_test
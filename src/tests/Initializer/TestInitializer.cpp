@@ -2,4 +2,6 @@
 #include "tests/TestHelper.h"
 
 #include "time_stepping/LTSWeights.t.h"
-#include "PointMapper.t.h"
\ No newline at end of file
+#include "time_stepping/LtsSetup.t.h"
+#include "PointMapper.t.h"
+#include "SetupCache.t.h"
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include <algorithm>
+
+#include "Initializer/time_stepping/common.hpp"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Single LTS buffer of a cell") {
+  using namespace seissol::initializers::time_stepping;
+
+  SUBCASE("No larger face neighbor") {
+    const unsigned int neighboringClusterIds[4] = {2, 1, 0, 2};
+    REQUIRE(getBufferClusterId(2, neighboringClusterIds) == 2);
+  }
+
+  SUBCASE("Smallest larger face neighbor") {
+    const unsigned int neighboringClusterIds[4] = {5, 3, 4, 1};
+    REQUIRE(getBufferClusterId(2, neighboringClusterIds) == 3);
+  }
+
+  SUBCASE("Lowered face neighbors share the cluster of the buffer") {
+    // lowering as in LtsLayout::enforceSingleBuffer
+    unsigned int neighboringClusterIds[4] = {7, 0, 4, 6};
+    const unsigned int bufferClusterId = getBufferClusterId(0, neighboringClusterIds);
+    REQUIRE(bufferClusterId == 4);
+    for (auto& neighboringClusterId : neighboringClusterIds) {
+      neighboringClusterId = std::min(neighboringClusterId, bufferClusterId);
+    }
+    REQUIRE(getBufferClusterId(0, neighboringClusterIds) == bufferClusterId);
+
+    const FaceType faceTypes[4] = {FaceType::regular, FaceType::regular, FaceType::regular, FaceType::regular};
+    const unsigned int faceNeighborIds[4] = {0, 0, 0, 0};
+    const unsigned short ltsSetup = getLtsSetup(0, neighboringClusterIds, faceTypes, faceNeighborIds);
+    REQUIRE((ltsSetup >> 11) % 8 == 4);
+    REQUIRE((ltsSetup & 0xF) == 0b1101);
+  }
+}
+
+TEST_CASE("LTS setup encodes the cluster difference") {
+  using namespace seissol::initializers::time_stepping;
+
+  const unsigned int localClusterId = 1;
+  const unsigned int faceNeighborIds[4] = {0, 0, 0, 0};
+
+  for (unsigned int difference = 0; difference <= MaximumLtsClusterDifference; ++difference) {
+    CAPTURE(difference);
+    const bool lts = difference > 0;
+
+    {
+      // larger, smaller and GTS face neighbors
+      unsigned int neighboringClusterIds[4] = {localClusterId + difference, localClusterId + difference, localClusterId - 1, localClusterId};
+      const FaceType faceTypes[4] = {FaceType::regular, FaceType::regular, FaceType::regular, FaceType::periodic};
+      const unsigned short ltsSetup = getLtsSetup(localClusterId, neighboringClusterIds, faceTypes, faceNeighborIds);
+
+      REQUIRE((ltsSetup >> 11) % 8 == difference);
+      // the larger face neighbors deliver derivatives
+      REQUIRE((ltsSetup & 0xF) == (lts ? 0b0011 : 0b0000));
+      REQUIRE(((ltsSetup >> 4) & 0xF) == (lts ? 0b1000 : 0b1011));
+      // buffer for the larger and GTS neighbors, derivatives for the smaller neighbor
+      REQUIRE((ltsSetup >> 8) % 2 == 1);
+      REQUIRE((ltsSetup >> 9) % 2 == 1);
+      REQUIRE((ltsSetup >> 10) % 2 == (lts ? 1 : 0));
+    }
+
+    {
+      // larger face neighbors only
+      unsigned int neighboringClusterIds[4] = {localClusterId + difference, localClusterId + difference, localClusterId + difference, 0};
+      const FaceType faceTypes[4] = {FaceType::regular, FaceType::regular, FaceType::regular, FaceType::outflow};
+      const unsigned short ltsSetup = getLtsSetup(localClusterId, neighboringClusterIds, faceTypes, faceNeighborIds);
+
+      REQUIRE((ltsSetup >> 11) % 8 == difference);
+      REQUIRE((ltsSetup & 0xF) == (lts ? 0b0111 : 0b0000));
+      REQUIRE(((ltsSetup >> 4) & 0xF) == (lts ? 0b0000 : 0b0111));
+      // a buffer only, which is reset on request in LTS fashion
+      REQUIRE((ltsSetup >> 8) % 2 == 1);
+      REQUIRE((ltsSetup >> 9) % 2 == 0);
+      REQUIRE((ltsSetup >> 10) % 2 == (lts ? 1 : 0));
+    }
+
+    {
+      // larger face neighbor next to a GTS face neighbor
+      unsigned int neighboringClusterIds[4] = {localClusterId + difference, localClusterId, 0, 0};
+      const FaceType faceTypes[4] = {FaceType::regular, FaceType::regular, FaceType::outflow, FaceType::outflow};
+      const unsigned short ltsSetup = getLtsSetup(localClusterId, neighboringClusterIds, faceTypes, faceNeighborIds);
+
+      REQUIRE((ltsSetup >> 11) % 8 == difference);
+      REQUIRE((ltsSetup & 0xF) == (lts ? 0b0001 : 0b0000));
+      REQUIRE((ltsSetup >> 8) % 2 == 1);
+      // the GTS neighbor requires derivatives if the buffer is used in LTS fashion
+      REQUIRE((ltsSetup >> 9) % 2 == (lts ? 1 : 0));
+      REQUIRE((ltsSetup >> 10) % 2 == (lts ? 1 : 0));
+    }
+  }
+}
+
+} // namespace seissol::unit_test
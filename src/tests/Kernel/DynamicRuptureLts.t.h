@@ -0,0 +1,70 @@
+#include <random>
+
+#include "Kernels/DynamicRupture.h"
+#include "Kernels/Time.h"
+#include "generated_code/tensor.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Slower dynamic rupture side under LTS agrees with GTS") {
+  // The slower side of a fault face spans two time steps of the faster cluster. With GTS, both sides
+  // are in the slower cluster and the friction law evaluates the slower side once per time step.
+  constexpr double TimeStepWidth = 1.0e-3;
+  constexpr std::size_t DerivativesSize = yateto::computeFamilySize<tensor::dQ>();
+
+  std::mt19937 generator(20230415);
+  std::uniform_real_distribution<real> distribution(-1.0, 1.0);
+
+  alignas(ALIGNMENT) real derivatives[DerivativesSize];
+  for (auto& value : derivatives) {
+    value = distribution(generator);
+  }
+
+  kernels::Time timeKernel;
+  kernels::DynamicRupture gtsKernel;
+  kernels::DynamicRupture ltsKernel;
+  gtsKernel.setTimeStepWidth(2.0 * TimeStepWidth);
+  ltsKernel.setTimeStepWidth(TimeStepWidth);
+
+  alignas(ALIGNMENT) real gtsEvaluated[tensor::Q::size()];
+  alignas(ALIGNMENT) real ltsEvaluated[tensor::Q::size()];
+
+  // time integral of the slower side over the time step of the slower cluster
+  real gtsIntegral[tensor::Q::size()] = {};
+  for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
+    timeKernel.computeTaylorExpansion(gtsKernel.timePoints[point], 0.0, derivatives, gtsEvaluated);
+    for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+      gtsIntegral[i] += gtsKernel.timeWeights[point] * gtsEvaluated[i];
+    }
+  }
+
+  // the faster cluster shifts the expansion by its sub time start and accumulates the sub steps,
+  // see TimeCluster::computeDynamicRupture
+  real ltsIntegral[tensor::Q::size()];
+  for (unsigned subStep = 0; subStep < 2; ++subStep) {
+    const double subTimeStart = subStep * TimeStepWidth;
+    const bool resetLtsBuffers = subStep == 0;
+
+    real subStepIntegral[tensor::Q::size()] = {};
+    for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
+      timeKernel.computeTaylorExpansion(ltsKernel.timePoints[point], -subTimeStart, derivatives, ltsEvaluated);
+      timeKernel.computeTaylorExpansion(subTimeStart + ltsKernel.timePoints[point], 0.0, derivatives, gtsEvaluated);
+      for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+        // the shifted expansion evaluates the slower side at the same time as GTS
+        REQUIRE(ltsEvaluated[i] == doctest::Approx(gtsEvaluated[i]));
+        subStepIntegral[i] += ltsKernel.timeWeights[point] * ltsEvaluated[i];
+      }
+    }
+
+    for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+      ltsIntegral[i] = resetLtsBuffers ? subStepIntegral[i] : ltsIntegral[i] + subStepIntegral[i];
+    }
+  }
+
+  // the Gauss-Legendre quadrature is exact for the Taylor expansion in both cases
+  for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+    REQUIRE(ltsIntegral[i] == doctest::Approx(gtsIntegral[i]));
+  }
+}
+
+} // namespace seissol::unit_test
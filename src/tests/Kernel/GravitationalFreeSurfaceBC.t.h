@@ -0,0 +1,107 @@
+#include <random>
+#include <vector>
+
+#include "Equations/elastic/Kernels/GravitationalFreeSurfaceBC.h"
+#include "generated_code/tensor.h"
+
+namespace seissol::unit_test {
+
+namespace {
+//! Projection to the face nodes which depends on the order, the face and its data only
+struct MockProjectionKernel {
+  real* Tinv = nullptr;
+  real* INodal = nullptr;
+  const real* derivatives[yateto::numFamilyMembers<tensor::dQ>()] = {};
+
+  const real*& dQ(unsigned i) {
+    return derivatives[i];
+  }
+
+  void execute(unsigned derivative, unsigned face) {
+    for (unsigned i = 0; i < tensor::INodal::size(); ++i) {
+      INodal[i] = Tinv[0] * derivatives[derivative][i % tensor::dQ::size(derivative)] + face;
+    }
+  }
+};
+
+struct MockTimeKernel {
+  unsigned derivativesOffsets[yateto::numFamilyMembers<tensor::dQ>()];
+
+  unsigned* getDerivativesOffsets() {
+    return derivativesOffsets;
+  }
+};
+} // namespace
+
+TEST_CASE("Batched and per-face gravity boundary evaluation agree") {
+  // a full and a partial batch
+  constexpr unsigned NumberOfFaces = GravitationalFreeSurfaceBc::BatchSize + 5;
+  constexpr std::size_t DerivativesSize = yateto::computeFamilySize<tensor::dQ>();
+  constexpr double TimeStepWidth = 1.0e-3;
+
+  std::mt19937 generator(20230412);
+  std::uniform_real_distribution<real> distribution(-1.0, 1.0);
+
+  MockTimeKernel timeKernel;
+  unsigned offset = 0;
+  for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::dQ>(); ++i) {
+    timeKernel.derivativesOffsets[i] = offset;
+    offset += tensor::dQ::size(i);
+  }
+
+  std::vector<real> derivatives(NumberOfFaces * DerivativesSize);
+  std::vector<real> Tinv(NumberOfFaces);
+  for (auto& value : derivatives) {
+    value = distribution(generator);
+  }
+  for (auto& value : Tinv) {
+    value = distribution(generator);
+  }
+
+  std::vector<GravityFace> faces(NumberOfFaces);
+  for (unsigned face = 0; face < NumberOfFaces; ++face) {
+    for (unsigned i = 0; i < init::displacementRotationMatrix::Size; ++i) {
+      faces[face].rotateDisplacementToFaceNormal[i] = distribution(generator);
+      faces[face].rotateDisplacementToGlobal[i] = distribution(generator);
+    }
+    faces[face].TinvData = &Tinv[face];
+    faces[face].derivatives = derivatives.data() + face * DerivativesSize;
+    faces[face].face = face % 4;
+    faces[face].rho = 2500.0 + face;
+    faces[face].impedance = 1.0e7 + 1.0e5 * face;
+  }
+
+  alignas(ALIGNMENT) real batchedDisplacements[NumberOfFaces * tensor::faceDisplacement::size()];
+  alignas(ALIGNMENT) real perFaceDisplacements[NumberOfFaces * tensor::faceDisplacement::size()];
+  alignas(ALIGNMENT) real batchedIntegrals[NumberOfFaces * tensor::averageNormalDisplacement::size()];
+  alignas(ALIGNMENT) real perFaceIntegrals[NumberOfFaces * tensor::averageNormalDisplacement::size()];
+  for (unsigned i = 0; i < NumberOfFaces * tensor::faceDisplacement::size(); ++i) {
+    batchedDisplacements[i] = perFaceDisplacements[i] = distribution(generator);
+  }
+
+  GravitationalFreeSurfaceBc::evaluateBatch(MockProjectionKernel(),
+                                            timeKernel,
+                                            faces.data(),
+                                            NumberOfFaces,
+                                            batchedDisplacements,
+                                            batchedIntegrals,
+                                            TimeStepWidth);
+  for (unsigned face = 0; face < NumberOfFaces; ++face) {
+    GravitationalFreeSurfaceBc::evaluateBatch(MockProjectionKernel(),
+                                              timeKernel,
+                                              &faces[face],
+                                              1,
+                                              perFaceDisplacements + face * tensor::faceDisplacement::size(),
+                                              perFaceIntegrals + face * tensor::averageNormalDisplacement::size(),
+                                              TimeStepWidth);
+  }
+
+  for (unsigned i = 0; i < NumberOfFaces * tensor::faceDisplacement::size(); ++i) {
+    REQUIRE(batchedDisplacements[i] == doctest::Approx(perFaceDisplacements[i]));
+  }
+  for (unsigned i = 0; i < NumberOfFaces * tensor::averageNormalDisplacement::size(); ++i) {
+    REQUIRE(batchedIntegrals[i] == doctest::Approx(perFaceIntegrals[i]));
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <random>
+
+#include "Kernels/Plasticity.h"
+#include "generated_code/init.h"
+#include "generated_code/tensor.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Plasticity yield pre-check is conservative") {
+  real v[tensor::v::size()] __attribute__((aligned(ALIGNMENT)));
+  real vInv[tensor::vInv::size()] __attribute__((aligned(ALIGNMENT)));
+  std::copy_n(init::v::Values, tensor::v::size(), v);
+  std::copy_n(init::vInv::Values, tensor::vInv::size(), vInv);
+
+  GlobalData global{};
+  global.vandermondeMatrix = v;
+  global.vandermondeMatrixInverse = vInv;
+  const auto bounds = seissol::kernels::Plasticity::computeNodalBounds(&global);
+
+  PlasticityData plasticity{};
+  plasticity.initialLoading[0] = -5.0e7;
+  plasticity.initialLoading[1] = -6.0e7;
+  plasticity.initialLoading[2] = -7.0e7;
+  plasticity.cohesionTimesCosAngularFriction = 1.0e6;
+  plasticity.sinAngularFriction = 0.5;
+  plasticity.mufactor = 1.0 / (2.0 * 3.0e10);
+
+  SUBCASE("Quiescent cell is skipped") {
+    real dofs[tensor::Q::size()] __attribute__((aligned(ALIGNMENT))) = {};
+    REQUIRE(!seissol::kernels::Plasticity::mayYield(bounds, &plasticity, dofs));
+  }
+
+  SUBCASE("Skipped cells do not yield") {
+    std::mt19937 gen(1234);
+    for (double amplitude : {1.0e5, 1.0e6, 1.0e7, 3.0e7}) {
+      std::uniform_real_distribution<real> dist(-amplitude, amplitude);
+      for (unsigned sample = 0; sample < 50; ++sample) {
+        real dofs[tensor::Q::size()] __attribute__((aligned(ALIGNMENT))) = {};
+        real pstrain[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] __attribute__((aligned(ALIGNMENT))) = {};
+        for (unsigned p = 0; p < 6; ++p) {
+          for (unsigned l = 0; l < NUMBER_OF_BASIS_FUNCTIONS; ++l) {
+            dofs[p * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS + l] = dist(gen) / (l + 1);
+          }
+        }
+        if (!seissol::kernels::Plasticity::mayYield(bounds, &plasticity, dofs)) {
+          REQUIRE(seissol::kernels::Plasticity::computePlasticity(
+                      0.5, 1.0e-3, 0.05, &global, &plasticity, dofs, pstrain) == 0);
+        }
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test
@@ -2,4 +2,14 @@
 
 #ifdef USE_POROELASTIC
 #include "STP.t.h"
-#endif // USE_POROELASTIC
\ No newline at end of file
+#endif // USE_POROELASTIC
+
+#ifndef MULTIPLE_SIMULATIONS
+#include "Plasticity.t.h"
+#endif // MULTIPLE_SIMULATIONS
+
+#if !defined(MULTIPLE_SIMULATIONS) && (defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2) || defined(USE_POROELASTIC))
+#include "GravitationalFreeSurfaceBC.t.h"
+#endif
+
+#include "DynamicRuptureLts.t.h"
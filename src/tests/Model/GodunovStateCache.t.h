@@ -0,0 +1,94 @@
+#include <Equations/datastructures.hpp>
+#include <Equations/Setup.h>
+#include <Initializer/GodunovStateCache.h>
+
+#include "values.h"
+
+namespace seissol::unit_test {
+
+#ifdef USE_ANISOTROPIC
+using CachedMaterial = model::AnisotropicMaterial;
+constexpr int NumberOfCachedMaterialVals = 22;
+#elif defined USE_POROELASTIC
+using CachedMaterial = model::PoroElasticMaterial;
+constexpr int NumberOfCachedMaterialVals = 10;
+#elif defined USE_VISCOELASTIC || defined USE_VISCOELASTIC2
+using CachedMaterial = model::ViscoElasticMaterial;
+constexpr int NumberOfCachedMaterialVals = 3 + NUMBER_OF_RELAXATION_MECHANISMS * 4;
+#else
+using CachedMaterial = model::ElasticMaterial;
+constexpr int NumberOfCachedMaterialVals = 3;
+#endif
+
+void test_cached_state(initializers::GodunovStateCache<CachedMaterial>& cache,
+                       CachedMaterial const& local,
+                       CachedMaterial const& neighbor,
+                       FaceType faceType) {
+  real directLocalData[tensor::QgodLocal::size()];
+  real directNeighborData[tensor::QgodNeighbor::size()];
+  auto directLocal = init::QgodLocal::view::create(directLocalData);
+  auto directNeighbor = init::QgodNeighbor::view::create(directNeighborData);
+  model::getTransposedGodunovState(local, neighbor, faceType, directLocal, directNeighbor);
+
+  // the first call computes the state, the second one restores it
+  for (unsigned repetition = 0; repetition < 2; ++repetition) {
+    real cachedLocalData[tensor::QgodLocal::size()];
+    real cachedNeighborData[tensor::QgodNeighbor::size()];
+    cache.getTransposedGodunovState(local, neighbor, faceType, cachedLocalData, cachedNeighborData);
+    for (unsigned i = 0; i < tensor::QgodLocal::size(); ++i) {
+      // NaN entries (free surface neighbor) have to be NaN in both
+      REQUIRE((cachedLocalData[i] == directLocalData[i] ||
+               (std::isnan(cachedLocalData[i]) && std::isnan(directLocalData[i]))));
+    }
+    for (unsigned i = 0; i < tensor::QgodNeighbor::size(); ++i) {
+      REQUIRE((cachedNeighborData[i] == directNeighborData[i] ||
+               (std::isnan(cachedNeighborData[i]) && std::isnan(directNeighborData[i]))));
+    }
+  }
+}
+
+TEST_CASE("Cached Godunov states equal the computed ones") {
+  const CachedMaterial material1(materialVal_1, NumberOfCachedMaterialVals);
+  const CachedMaterial material2(materialVal_2, NumberOfCachedMaterialVals);
+
+  initializers::GodunovStateCache<CachedMaterial> cache;
+
+  // a heterogeneous pair and its mirror have different states
+  test_cached_state(cache, material1, material2, FaceType::regular);
+  test_cached_state(cache, material2, material1, FaceType::regular);
+  test_cached_state(cache, material1, material1, FaceType::regular);
+  test_cached_state(cache, material1, material1, FaceType::freeSurface);
+
+  if constexpr (initializers::GodunovStateCache<CachedMaterial>::Enabled) {
+    REQUIRE(cache.isActive());
+    REQUIRE(cache.size() == 4);
+  }
+}
+
+TEST_CASE("Godunov state cache falls back to the direct computation") {
+  using Cache = initializers::GodunovStateCache<CachedMaterial>;
+  if constexpr (Cache::Enabled) {
+    Cache cache;
+    double materialVal[NumberOfCachedMaterialVals];
+    std::copy_n(materialVal_1, NumberOfCachedMaterialVals, materialVal);
+    const CachedMaterial neighbor(materialVal_2, NumberOfCachedMaterialVals);
+
+    real QgodLocalData[tensor::QgodLocal::size()];
+    real QgodNeighborData[tensor::QgodNeighbor::size()];
+    // every face has a distinct material, as for smoothly varying materials
+    for (std::size_t face = 0; face < Cache::ProbeFaces; ++face) {
+      materialVal[0] = materialVal_1[0] + face;
+      const CachedMaterial local(materialVal, NumberOfCachedMaterialVals);
+      cache.getTransposedGodunovState(local, neighbor, FaceType::regular, QgodLocalData, QgodNeighborData);
+      REQUIRE(cache.size() <= Cache::MaxStates);
+    }
+    REQUIRE(!cache.isActive());
+    REQUIRE(cache.size() == 0);
+
+    // states are still computed correctly
+    const CachedMaterial local(materialVal_1, NumberOfCachedMaterialVals);
+    test_cached_state(cache, local, neighbor, FaceType::regular);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -1,3 +1,4 @@
 #include "doctest.h"
 
 #include "GodunovState.t.h"
+#include "GodunovStateCache.t.h"
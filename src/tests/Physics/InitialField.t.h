@@ -0,0 +1,112 @@
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Physics/InitialField.h"
+
+namespace seissol::unit_test {
+
+namespace {
+constexpr unsigned InitialFieldElements = 3;
+constexpr unsigned InitialFieldPointsPerElement = 5;
+
+//! Forwards evaluate only, such that evaluateBatch is the default implementation of InitialField
+class PerElementField : public physics::InitialField {
+  public:
+  explicit PerElementField(std::shared_ptr<physics::InitialField> field) : m_field(std::move(field)) {}
+
+  void evaluate(double time,
+                std::vector<std::array<double, 3>> const& points,
+                const CellMaterialData& materialData,
+                yateto::DenseTensorView<2, real, unsigned>& dofsQP) const override {
+    m_field->evaluate(time, points, materialData, dofsQP);
+  }
+
+  private:
+  std::shared_ptr<physics::InitialField> m_field;
+};
+
+CellMaterialData makeMaterial(double rho, double mu, double lambda) {
+  CellMaterialData materialData;
+  materialData.local.rho = rho;
+  materialData.local.mu = mu;
+  materialData.local.lambda = lambda;
+  return materialData;
+}
+
+/**
+ * Evaluates the field for a block of elements at once and for every point on its own, using the
+ * material of the element of the point.
+ */
+void testEvaluateBatch(physics::InitialField const& field,
+                       std::vector<CellMaterialData> const& materials,
+                       std::vector<std::array<double, 3>> const& points,
+                       double time) {
+  std::vector<CellMaterialData const*> materialData;
+  for (auto const& material : materials) {
+    materialData.push_back(&material);
+  }
+
+  std::vector<real> batchedData(points.size() * NUMBER_OF_QUANTITIES);
+  auto batched = yateto::DenseTensorView<2, real, unsigned>(batchedData.data(),
+                                                            {static_cast<unsigned>(points.size()), NUMBER_OF_QUANTITIES});
+  field.evaluateBatch(time, points, materialData, batched);
+
+  std::vector<real> pointData(NUMBER_OF_QUANTITIES);
+  auto point = yateto::DenseTensorView<2, real, unsigned>(pointData.data(), {1, NUMBER_OF_QUANTITIES});
+  for (unsigned i = 0; i < points.size(); ++i) {
+    CAPTURE(i);
+    field.evaluate(time, {points[i]}, materials[i / InitialFieldPointsPerElement], point);
+    for (unsigned j = 0; j < NUMBER_OF_QUANTITIES; ++j) {
+      REQUIRE(batched(i, j) == doctest::Approx(point(0, j)));
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("Batched initial field evaluation matches the evaluation per point") {
+  std::mt19937 generator(20230418);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  std::vector<std::array<double, 3>> points(InitialFieldElements * InitialFieldPointsPerElement);
+  for (auto& point : points) {
+    for (auto& coordinate : point) {
+      coordinate = distribution(generator);
+    }
+  }
+  const double time = 0.3;
+
+  // elements with different materials, the last one is acoustic
+  const std::vector<CellMaterialData> materials{
+      makeMaterial(2.7, 32.0, 32.0), makeMaterial(2.6, 10.0, 20.0), makeMaterial(1.0, 0.0, 2.25)};
+
+  TravellingWaveParameters travellingWaveParameters;
+  travellingWaveParameters.origin = {0.1, -0.2, 0.3};
+  travellingWaveParameters.kVec = {1.5, 0.5, -1.0};
+  travellingWaveParameters.varField = {1, 8};
+  travellingWaveParameters.ampField = {1.0, 0.5};
+
+  std::vector<std::shared_ptr<physics::InitialField>> fields{
+      std::make_shared<physics::Planarwave>(materials[0], 0.5),
+      std::make_shared<physics::SuperimposedPlanarwave>(materials[0], 0.5),
+      std::make_shared<physics::TravellingWave>(materials[0], travellingWaveParameters),
+      std::make_shared<physics::ScholteWave>(),
+      std::make_shared<physics::SnellsLaw>(),
+      std::make_shared<physics::ScaledField>(std::make_shared<physics::SnellsLaw>(), 0.5)};
+  for (unsigned f = 0; f < fields.size(); ++f) {
+    CAPTURE(f);
+    testEvaluateBatch(*fields[f], materials, points, time);
+    testEvaluateBatch(PerElementField(fields[f]), materials, points, time);
+  }
+
+  // the ocean scenario requires acoustic materials
+  const std::vector<CellMaterialData> acousticMaterials{
+      makeMaterial(1.0, 0.0, 2.25), makeMaterial(1.1, 0.0, 2.0), makeMaterial(0.9, 0.0, 2.5)};
+  for (int mode = 0; mode < 3; ++mode) {
+    CAPTURE(mode);
+    testEvaluateBatch(physics::Ocean(mode, 9.81e-3), acousticMaterials, points, time);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,5 @@
+#include "doctest.h"
+
+#ifdef USE_ELASTIC
+#include "InitialField.t.h"
+#endif
@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Solver/time_stepping/LockedDrFaces.h"
+#include "generated_code/tensor.h"
+
+#include <yateto.h>
+
+namespace seissol::unit_test {
+
+namespace {
+constexpr unsigned NumberOfDrFaces = 6;
+constexpr unsigned NumberOfDrSteps = 12;
+constexpr std::size_t DrDerivativesSize = yateto::computeFamilySize<tensor::dQ>();
+constexpr unsigned QInterpolatedSize = tensor::QInterpolated::size();
+
+/**
+ * Friction law per entry of the interpolated state, modelled after Eval_friction_law:
+ * FL 0 passes the Godunov state through, FL 2 is a linear slip weakening law.
+ */
+class MockFrictionLaw {
+  public:
+  MockFrictionLaw(int frictionLaw, std::vector<double> initialShear)
+      : m_frictionLaw(frictionLaw), m_initialShear(std::move(initialShear)),
+        m_slip(NumberOfDrFaces * QInterpolatedSize, 0.0),
+        m_mu(NumberOfDrFaces * QInterpolatedSize, MuS) {}
+
+  void evaluate(unsigned face,
+                real const QInterpolatedPlus[CONVERGENCE_ORDER][QInterpolatedSize],
+                real const QInterpolatedMinus[CONVERGENCE_ORDER][QInterpolatedSize],
+                real* imposedStatePlus,
+                real* imposedStateMinus) {
+    for (unsigned i = 0; i < QInterpolatedSize; ++i) {
+      const unsigned point = face * QInterpolatedSize + i;
+      double imposedState = 0.0;
+      for (unsigned timePoint = 0; timePoint < CONVERGENCE_ORDER; ++timePoint) {
+        const double godunovState = 0.5 * (QInterpolatedPlus[timePoint][i] + QInterpolatedMinus[timePoint][i]);
+        double traction = godunovState;
+        if (m_frictionLaw == 2) {
+          const double shear = m_initialShear[point] + godunovState;
+          const double slipRate = std::max(0.0, (std::abs(shear) - m_mu[point] * NormalStress) / Eta);
+          traction = godunovState - Eta * slipRate * (shear < 0.0 ? -1.0 : 1.0);
+          m_slip[point] += slipRate * TimeWeight;
+          m_mu[point] = MuS - (MuS - MuD) * std::min(m_slip[point] / Dc, 1.0);
+        }
+        imposedState += TimeWeight * traction;
+      }
+      imposedStatePlus[i] = imposedState;
+      imposedStateMinus[i] = -imposedState;
+    }
+  }
+
+  std::vector<double> const& slip() const { return m_slip; }
+  std::vector<double> const& mu() const { return m_mu; }
+
+  private:
+  static constexpr double MuS = 0.6;
+  static constexpr double MuD = 0.4;
+  static constexpr double Dc = 0.4;
+  static constexpr double NormalStress = 1.0;
+  static constexpr double Eta = 2.0;
+  static constexpr double TimeWeight = 0.1;
+
+  int m_frictionLaw;
+  std::vector<double> m_initialShear;
+  std::vector<double> m_slip;
+  std::vector<double> m_mu;
+};
+
+/**
+ * Time derivatives of the sides of the faces in a time step.
+ * Face 0 never sees a wave, faces 1 to 4 see a wave in some steps, face 5 sees a wave in every step.
+ */
+void setDrDerivatives(unsigned step, std::vector<real>& derivativesPlus, std::vector<real>& derivativesMinus) {
+  std::fill(derivativesPlus.begin(), derivativesPlus.end(), 0.0);
+  std::fill(derivativesMinus.begin(), derivativesMinus.end(), 0.0);
+  for (unsigned face = 1; face < NumberOfDrFaces; ++face) {
+    const bool wave = (face == NumberOfDrFaces - 1) || (step >= 2 * face && step < 2 * face + 3);
+    if (wave) {
+      std::vector<real>& derivatives = (face % 2 == 0) ? derivativesPlus : derivativesMinus;
+      for (std::size_t i = 0; i < DrDerivativesSize; ++i) {
+        derivatives[face * DrDerivativesSize + i] = 0.01 * ((i + step + face) % 7) - 0.03;
+      }
+    }
+  }
+}
+
+//! Interpolation to the fault, which is zero if the derivatives are zero
+void interpolateDr(real const* derivatives, real QInterpolated[CONVERGENCE_ORDER][QInterpolatedSize]) {
+  for (unsigned timePoint = 0; timePoint < CONVERGENCE_ORDER; ++timePoint) {
+    for (unsigned i = 0; i < QInterpolatedSize; ++i) {
+      QInterpolated[timePoint][i] = (timePoint + 1) * derivatives[i % DrDerivativesSize];
+    }
+  }
+}
+
+void testLockedDrFaces(int frictionLaw, bool includeLocked) {
+  std::vector<double> initialShear(NumberOfDrFaces * QInterpolatedSize);
+  for (unsigned point = 0; point < initialShear.size(); ++point) {
+    initialShear[point] = 0.1 * (point % 5);
+  }
+  if (frictionLaw == 2) {
+    // the initial shear stress of face 0 exceeds the strength, it slips without incoming waves
+    initialShear[0] = 0.8;
+  }
+
+  MockFrictionLaw reference(frictionLaw, initialShear);
+  MockFrictionLaw skipping(frictionLaw, initialShear);
+  time_stepping::LockedDrFaces lockedFaces;
+
+  std::vector<real> derivativesPlus(NumberOfDrFaces * DrDerivativesSize);
+  std::vector<real> derivativesMinus(NumberOfDrFaces * DrDerivativesSize);
+  std::vector<real const*> timeDerivativePlus(NumberOfDrFaces);
+  std::vector<real const*> timeDerivativeMinus(NumberOfDrFaces);
+  for (unsigned face = 0; face < NumberOfDrFaces; ++face) {
+    timeDerivativePlus[face] = derivativesPlus.data() + face * DrDerivativesSize;
+    timeDerivativeMinus[face] = derivativesMinus.data() + face * DrDerivativesSize;
+  }
+
+  std::vector<real> referencePlus(NumberOfDrFaces * QInterpolatedSize, 0.0);
+  std::vector<real> referenceMinus(NumberOfDrFaces * QInterpolatedSize, 0.0);
+  std::vector<real> skippingPlus(NumberOfDrFaces * QInterpolatedSize, 0.0);
+  std::vector<real> skippingMinus(NumberOfDrFaces * QInterpolatedSize, 0.0);
+
+  real QInterpolatedPlus[CONVERGENCE_ORDER][QInterpolatedSize];
+  real QInterpolatedMinus[CONVERGENCE_ORDER][QInterpolatedSize];
+
+  unsigned numberOfSkippedFaces = 0;
+  for (unsigned step = 0; step < NumberOfDrSteps; ++step) {
+    setDrDerivatives(step, derivativesPlus, derivativesMinus);
+
+    // existing implementation: the friction law is evaluated on all faces
+    for (unsigned face = 0; face < NumberOfDrFaces; ++face) {
+      interpolateDr(timeDerivativePlus[face], QInterpolatedPlus);
+      interpolateDr(timeDerivativeMinus[face], QInterpolatedMinus);
+      reference.evaluate(face, QInterpolatedPlus, QInterpolatedMinus,
+                         &referencePlus[face * QInterpolatedSize], &referenceMinus[face * QInterpolatedSize]);
+    }
+
+    // locked faces are skipped as in TimeCluster::computeDynamicRupture
+    lockedFaces.update(NumberOfDrFaces, timeDerivativePlus.data(), timeDerivativeMinus.data(), includeLocked);
+    numberOfSkippedFaces += NumberOfDrFaces - lockedFaces.activeFaces().size();
+    for (unsigned face : lockedFaces.activeFaces()) {
+      const bool wasLocked = lockedFaces.isLocked(face);
+      interpolateDr(timeDerivativePlus[face], QInterpolatedPlus);
+      interpolateDr(timeDerivativeMinus[face], QInterpolatedMinus);
+      skipping.evaluate(face, QInterpolatedPlus, QInterpolatedMinus,
+                        &skippingPlus[face * QInterpolatedSize], &skippingMinus[face * QInterpolatedSize]);
+      const bool locked = lockedFaces.classify(face, QInterpolatedPlus, QInterpolatedMinus,
+                                               &skippingPlus[face * QInterpolatedSize], &skippingMinus[face * QInterpolatedSize]);
+      // a verified locked face stays locked
+      REQUIRE((!wasLocked || locked));
+    }
+
+    REQUIRE(skippingPlus == referencePlus);
+    REQUIRE(skippingMinus == referenceMinus);
+    REQUIRE(skipping.slip() == reference.slip());
+    REQUIRE(skipping.mu() == reference.mu());
+  }
+
+  if (includeLocked) {
+    REQUIRE(numberOfSkippedFaces == 0);
+  } else {
+    REQUIRE(numberOfSkippedFaces > 0);
+  }
+  if (frictionLaw == 2) {
+    // the slipping face is never locked
+    REQUIRE(!lockedFaces.isLocked(0));
+  }
+}
+} // namespace
+
+TEST_CASE("Skipping locked dynamic rupture faces agrees with the full evaluation") {
+  for (const int frictionLaw : {0, 2}) {
+    CAPTURE(frictionLaw);
+    testLockedDrFaces(frictionLaw, false);
+    testLockedDrFaces(frictionLaw, true);
+  }
+}
+
+} // namespace seissol::unit_test
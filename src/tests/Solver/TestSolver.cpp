@@ -0,0 +1,4 @@
+#include "doctest.h"
+
+#include "LockedDrFaces.t.h"
+#include "WavefrontTiling.t.h"
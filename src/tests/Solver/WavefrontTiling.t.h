@@ -0,0 +1,150 @@
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Solver/time_stepping/WavefrontTiling.h"
+
+namespace seissol::unit_test {
+
+namespace {
+constexpr unsigned NumberOfTilingCells = 211;
+constexpr unsigned TilingBufferSize = 4;
+
+/**
+ * Layer with buffers for all cells and derivatives for every third cell. Some cells have dynamic
+ * rupture faces, outflow faces or read data which is not produced in the layer.
+ **/
+struct TilingLayer {
+  std::vector<CellLocalInformation> cellInformation;
+  std::vector<real> data;
+  std::vector<real> external;
+  std::vector<real*> buffers;
+  std::vector<real*> derivatives;
+  std::vector<std::array<real*, 4>> faceNeighbors;
+  //! producing cell of every face, NumberOfTilingCells if there is none
+  std::vector<std::array<unsigned, 4>> producers;
+  std::vector<unsigned> expectedRemainingCells;
+
+  TilingLayer()
+      : cellInformation(NumberOfTilingCells), data(2 * NumberOfTilingCells * TilingBufferSize),
+        external(NumberOfTilingCells * TilingBufferSize), buffers(NumberOfTilingCells),
+        derivatives(NumberOfTilingCells), faceNeighbors(NumberOfTilingCells),
+        producers(NumberOfTilingCells) {
+    for (unsigned cell = 0; cell < NumberOfTilingCells; ++cell) {
+      buffers[cell] = &data[2 * cell * TilingBufferSize];
+      derivatives[cell] = (cell % 3 == 0) ? &data[(2 * cell + 1) * TilingBufferSize] : nullptr;
+    }
+
+    for (unsigned cell = 0; cell < NumberOfTilingCells; ++cell) {
+      bool fused = true;
+      for (unsigned face = 0; face < 4; ++face) {
+        // near and far neighbors, such that tiles depend on preceding and following tiles
+        const unsigned neighbor = (face % 2 == 0) ? (cell + 1 + face) % NumberOfTilingCells
+                                                  : (cell * 7 + face * 13 + 5) % NumberOfTilingCells;
+        cellInformation[cell].faceTypes[face] = FaceType::regular;
+        producers[cell][face] = neighbor;
+        faceNeighbors[cell][face] = (derivatives[neighbor] != nullptr && face % 2 == 1) ? derivatives[neighbor] : buffers[neighbor];
+
+        if (face == 0 && cell % 17 == 0) {
+          cellInformation[cell].faceTypes[face] = FaceType::dynamicRupture;
+          fused = false;
+        } else if (face == 1 && cell % 11 == 0) {
+          cellInformation[cell].faceTypes[face] = FaceType::outflow;
+          faceNeighbors[cell][face] = nullptr;
+          producers[cell][face] = NumberOfTilingCells;
+        } else if (face == 2 && cell % 13 == 0) {
+          // e.g. a buffer of the copy layer
+          faceNeighbors[cell][face] = &external[cell * TilingBufferSize];
+          producers[cell][face] = NumberOfTilingCells;
+          fused = false;
+        }
+      }
+      if (!fused) {
+        expectedRemainingCells.push_back(cell);
+      }
+    }
+  }
+};
+
+//! Counts its instances, which the tiling creates once per thread
+struct ThreadState {
+  static std::atomic<unsigned> instances;
+  ThreadState() { ++instances; }
+};
+std::atomic<unsigned> ThreadState::instances{0};
+} // namespace
+
+TEST_CASE("Wavefront tiles visit every cell once in dependency order") {
+  TilingLayer layer;
+
+  for (const unsigned tileSize : {1u, 7u, 32u, 1000u}) {
+    CAPTURE(tileSize);
+    time_stepping::WavefrontTiling tiling;
+    tiling.initialize(NumberOfTilingCells,
+                      layer.cellInformation.data(),
+                      reinterpret_cast<real*(*)[4]>(layer.faceNeighbors.data()),
+                      layer.buffers.data(),
+                      layer.derivatives.data(),
+                      tileSize);
+
+    REQUIRE(tiling.numberOfTiles() == (NumberOfTilingCells + tileSize - 1) / tileSize);
+    REQUIRE(tiling.remainingCells() == layer.expectedRemainingCells);
+    REQUIRE(tiling.numberOfFusedCells() + tiling.remainingCells().size() == NumberOfTilingCells);
+
+    auto localSteps = std::make_unique<std::atomic<unsigned>[]>(NumberOfTilingCells);
+    auto localVisits = std::make_unique<std::atomic<unsigned>[]>(NumberOfTilingCells);
+    auto neighborVisits = std::make_unique<std::atomic<unsigned>[]>(NumberOfTilingCells);
+    std::atomic<unsigned> orderViolations{0};
+
+    // repeated time steps reuse the completion flags of the tiles
+    for (unsigned step = 1; step <= 3; ++step) {
+      CAPTURE(step);
+      for (unsigned cell = 0; cell < NumberOfTilingCells; ++cell) {
+        localVisits[cell] = 0;
+        neighborVisits[cell] = 0;
+      }
+      orderViolations = 0;
+      ThreadState::instances = 0;
+
+      tiling.execute<ThreadState>(
+          [&](unsigned cell, ThreadState&) {
+            ++localVisits[cell];
+            localSteps[cell].store(step, std::memory_order_release);
+          },
+          [&](unsigned cell) {
+            ++neighborVisits[cell];
+            // the local integrations of the cell and of all producers of its neighbor data are finished
+            if (localSteps[cell].load(std::memory_order_acquire) != step) {
+              ++orderViolations;
+            }
+            for (unsigned face = 0; face < 4; ++face) {
+              const unsigned producer = layer.producers[cell][face];
+              if (producer < NumberOfTilingCells && localSteps[producer].load(std::memory_order_acquire) != step) {
+                ++orderViolations;
+              }
+            }
+          });
+
+      REQUIRE(orderViolations == 0);
+#ifdef _OPENMP
+      REQUIRE(ThreadState::instances <= static_cast<unsigned>(omp_get_max_threads()));
+#else
+      REQUIRE(ThreadState::instances == 1);
+#endif
+      unsigned remaining = 0;
+      for (unsigned cell = 0; cell < NumberOfTilingCells; ++cell) {
+        CAPTURE(cell);
+        REQUIRE(localVisits[cell] == 1);
+        // the remaining cells are left to the regular neighboring integration
+        const bool isRemaining = remaining < layer.expectedRemainingCells.size() && layer.expectedRemainingCells[remaining] == cell;
+        if (isRemaining) {
+          ++remaining;
+        }
+        REQUIRE(neighborVisits[cell] == (isRemaining ? 0 : 1));
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test
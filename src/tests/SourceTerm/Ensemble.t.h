@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include "Initializer/Ensemble.h"
+#include "SourceTerm/PointSource.h"
+#include "generated_code/init.h"
+#include "generated_code/tensor.h"
+
+namespace seissol::unit_test {
+
+namespace {
+constexpr unsigned NumberOfEnsembleSources = 2;
+
+void writeEnsembleFile(const char* fileName) {
+  // member 0 sees source 0, member 1 sees source 1 with twice its amplitude, the others see source 0
+  std::ofstream file(fileName, std::ios::trunc);
+  file << "members:\n";
+  for (unsigned m = 0; m < initializers::Ensemble::NumberOfMembers; ++m) {
+    if (m == 1) {
+      file << "  - sources: [1]\n    sourceScale: 2.0\n";
+    } else {
+      file << "  - sources: [0]\n";
+    }
+  }
+}
+
+void initPointSources(sourceterm::PointSources& sources) {
+  std::mt19937 generator(20230417);
+  std::uniform_real_distribution<real> distribution(-1.0, 1.0);
+
+  sources.mode = sourceterm::PointSources::FSRM;
+  sources.numberOfSources = NumberOfEnsembleSources;
+  posix_memalign(reinterpret_cast<void**>(&sources.mInvJInvPhisAtSources),
+                 ALIGNMENT,
+                 NumberOfEnsembleSources * sizeof(*sources.mInvJInvPhisAtSources));
+  posix_memalign(reinterpret_cast<void**>(&sources.tensor), ALIGNMENT, NumberOfEnsembleSources * sizeof(*sources.tensor));
+  sources.slipRates.resize(NumberOfEnsembleSources);
+  sources.onsetTime.resize(NumberOfEnsembleSources);
+  sources.endTime.resize(NumberOfEnsembleSources);
+
+  for (unsigned source = 0; source < NumberOfEnsembleSources; ++source) {
+    for (unsigned i = 0; i < tensor::mInvJInvPhisAtSources::size(); ++i) {
+      sources.mInvJInvPhisAtSources[source][i] = distribution(generator);
+    }
+    for (unsigned i = 0; i < sourceterm::PointSources::TensorSize; ++i) {
+      sources.tensor[source][i] = distribution(generator);
+    }
+    const real samples[] = {0.0, distribution(generator), distribution(generator), 0.0};
+    sourceterm::samplesToPiecewiseLinearFunction1D(samples, 4, 0.0, 0.5, &sources.slipRates[source][0]);
+    sources.onsetTime[source] = 0.0;
+    sources.endTime[source] = 1.5;
+  }
+}
+} // namespace
+
+TEST_CASE("Ensemble members with different sources are independent") {
+  setenv("SEISSOL_ENSEMBLE_FILE", "ensembleMembers.yaml", 1);
+  writeEnsembleFile("ensembleMembers.yaml");
+  initializers::Ensemble ensemble;
+  ensemble.init();
+  REQUIRE(ensemble.isConfigured());
+
+  sourceterm::PointSources sources;
+  initPointSources(sources);
+
+  // every source on its own acts on all members with unit weight
+  alignas(ALIGNMENT) real single[NumberOfEnsembleSources][tensor::Q::size()] = {};
+  for (unsigned source = 0; source < NumberOfEnsembleSources; ++source) {
+    sourceterm::addTimeIntegratedPointSources(sources, source, 1, 0.2, 1.2, single[source]);
+  }
+
+  // both sources with the weights of the ensemble, as set up by the source term manager
+  sources.memberWeights.resize(NumberOfEnsembleSources);
+  for (unsigned source = 0; source < NumberOfEnsembleSources; ++source) {
+    auto& weights = sources.memberWeights[source].values;
+    std::fill(std::begin(weights), std::end(weights), 0.0);
+    ensemble.sourceWeights(source, weights);
+  }
+  alignas(ALIGNMENT) real fused[tensor::Q::size()] = {};
+  sourceterm::addTimeIntegratedPointSources(sources, 0, NumberOfEnsembleSources, 0.2, 1.2, fused);
+
+  auto fusedView = init::Q::view::create(fused);
+  auto source0 = init::Q::view::create(single[0]);
+  auto source1 = init::Q::view::create(single[1]);
+  bool nonZero = false;
+  for (unsigned k = 0; k < fusedView.shape(1); ++k) {
+    for (unsigned p = 0; p < fusedView.shape(2); ++p) {
+      // member 0 does not see source 1 and member 1 does not see source 0
+      REQUIRE(fusedView(0, k, p) == doctest::Approx(source0(0, k, p)));
+      REQUIRE(fusedView(1, k, p) == doctest::Approx(2.0 * source1(1, k, p)));
+      for (unsigned m = 2; m < initializers::Ensemble::NumberOfMembers; ++m) {
+        REQUIRE(fusedView(m, k, p) == doctest::Approx(source0(m, k, p)));
+      }
+      nonZero = nonZero || (source0(0, k, p) != 0.0 && source1(1, k, p) != 0.0);
+    }
+  }
+  REQUIRE(nonZero);
+
+  unsetenv("SEISSOL_ENSEMBLE_FILE");
+  std::remove("ensembleMembers.yaml");
+}
+
+TEST_CASE("Ensemble members without sources key see all sources, empty lists select none") {
+  {
+    // member 0 sees no source, member 1 all sources, the others source 1
+    std::ofstream file("ensembleSelection.yaml", std::ios::trunc);
+    file << "members:\n";
+    for (unsigned m = 0; m < initializers::Ensemble::NumberOfMembers; ++m) {
+      if (m == 0) {
+        file << "  - sources: []\n";
+      } else if (m == 1) {
+        file << "  - sourceScale: 3.0\n";
+      } else {
+        file << "  - sources: [1]\n";
+      }
+    }
+  }
+  setenv("SEISSOL_ENSEMBLE_FILE", "ensembleSelection.yaml", 1);
+  initializers::Ensemble ensemble;
+  ensemble.init();
+
+  for (unsigned source = 0; source < NumberOfEnsembleSources; ++source) {
+    CAPTURE(source);
+    real weights[initializers::Ensemble::NumberOfMembers];
+    ensemble.sourceWeights(source, weights);
+    REQUIRE(weights[0] == 0.0);
+    REQUIRE(weights[1] == 3.0);
+    for (unsigned m = 2; m < initializers::Ensemble::NumberOfMembers; ++m) {
+      REQUIRE(weights[m] == (source == 1 ? 1.0 : 0.0));
+    }
+  }
+
+  unsetenv("SEISSOL_ENSEMBLE_FILE");
+  std::remove("ensembleSelection.yaml");
+}
+
+} // namespace seissol::unit_test
@@ -141,4 +141,101 @@ TEST_CASE("Compute PwLFTimeIntegral") {
               .epsilon(4 * epsilon));
 }
 
+TEST_CASE("Batched point sources") {
+  constexpr double epsilon = 1000 * std::numeric_limits<real>::epsilon();
+  constexpr unsigned numberOfSources = 3;
+  constexpr unsigned TensorSize = seissol::sourceterm::PointSources::TensorSize;
+
+  seissol::sourceterm::PointSources sources;
+  sources.numberOfSources = numberOfSources;
+  REQUIRE(posix_memalign(reinterpret_cast<void**>(&sources.mInvJInvPhisAtSources), ALIGNMENT,
+                         numberOfSources * tensor::mInvJInvPhisAtSources::size() * sizeof(real)) == 0);
+  REQUIRE(posix_memalign(reinterpret_cast<void**>(&sources.tensor), ALIGNMENT,
+                         numberOfSources * TensorSize * sizeof(real)) == 0);
+  sources.A.resize(numberOfSources);
+  sources.stiffnessTensor.resize(numberOfSources);
+  sources.slipRates.resize(numberOfSources);
+  sources.nrfMoments.resize(numberOfSources);
+  sources.onsetTime.resize(numberOfSources);
+  sources.endTime.resize(numberOfSources);
+
+  const real samples[] = {1.0, 3.0, -1.0, 2.0, 2.5};
+  // the last source starts after the time interval
+  const real onsetTimes[] = {0.9, 1.0, 2.0};
+  for (unsigned s = 0; s < numberOfSources; ++s) {
+    for (unsigned k = 0; k < tensor::mInvJInvPhisAtSources::size(); ++k) {
+      sources.mInvJInvPhisAtSources[s][k] = 1.0 / (1.0 + k + s);
+    }
+    for (unsigned q = 0; q < TensorSize; ++q) {
+      sources.tensor[s][q] = 0.0;
+    }
+    // orthonormal fault basis
+    sources.tensor[s][0] = 1.0;
+    sources.tensor[s][4] = 1.0;
+    sources.tensor[s][8] = 1.0;
+    sources.A[s] = 2.0 + s;
+    for (unsigned i = 0; i < 81; ++i) {
+      sources.stiffnessTensor[s][i] = (i * 7 + s) % 11;
+    }
+    for (unsigned i = 0; i < 3; ++i) {
+      seissol::sourceterm::samplesToPiecewiseLinearFunction1D(
+          samples, sizeof(samples) / sizeof(real) - i, onsetTimes[s], 0.05, &sources.slipRates[s][i]);
+    }
+    sources.onsetTime[s] = onsetTimes[s];
+    sources.endTime[s] = onsetTimes[s] + 0.2;
+  }
+
+  const double fromTime = 1.02;
+  const double toTime = 1.12;
+
+  SUBCASE("Support of piecewise linear function") {
+    double onsetTime, endTime;
+    seissol::sourceterm::computePwLFSupport(sources.slipRates[0][0], onsetTime, endTime);
+    REQUIRE(onsetTime == AbsApprox(0.9).epsilon(epsilon));
+    REQUIRE(endTime == AbsApprox(1.1).epsilon(epsilon));
+  }
+
+  SUBCASE("NRF") {
+    sources.mode = seissol::sourceterm::PointSources::NRF;
+    for (unsigned s = 0; s < numberOfSources; ++s) {
+      seissol::sourceterm::computeNRFMoments(sources.tensor[s], sources.A[s], sources.stiffnessTensor[s],
+                                             sources.nrfMoments[s].data());
+    }
+
+    alignas(ALIGNMENT) real reference[tensor::Q::size()] = {};
+    for (unsigned s = 0; s < numberOfSources; ++s) {
+      seissol::sourceterm::addTimeIntegratedPointSourceNRF(
+          sources.mInvJInvPhisAtSources[s], sources.tensor[s], sources.A[s], sources.stiffnessTensor[s],
+          sources.slipRates[s], fromTime, toTime, reference);
+    }
+    alignas(ALIGNMENT) real batched[tensor::Q::size()] = {};
+    seissol::sourceterm::addTimeIntegratedPointSources(sources, 0, numberOfSources, fromTime, toTime, batched);
+
+    for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+      REQUIRE(batched[i] == AbsApprox(reference[i]).epsilon(epsilon));
+    }
+  }
+
+  SUBCASE("FSRM") {
+    sources.mode = seissol::sourceterm::PointSources::FSRM;
+    for (unsigned s = 0; s < numberOfSources; ++s) {
+      for (unsigned q = 0; q < TensorSize; ++q) {
+        sources.tensor[s][q] = q + 1.0 + s;
+      }
+    }
+
+    alignas(ALIGNMENT) real reference[tensor::Q::size()] = {};
+    for (unsigned s = 0; s < numberOfSources; ++s) {
+      seissol::sourceterm::addTimeIntegratedPointSourceFSRM(
+          sources.mInvJInvPhisAtSources[s], sources.tensor[s], sources.slipRates[s][0], fromTime, toTime, reference);
+    }
+    alignas(ALIGNMENT) real batched[tensor::Q::size()] = {};
+    seissol::sourceterm::addTimeIntegratedPointSources(sources, 0, numberOfSources, fromTime, toTime, batched);
+
+    for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+      REQUIRE(batched[i] == AbsApprox(reference[i]).epsilon(epsilon));
+    }
+  }
+}
+
 } // namespace seissol::unit_test
\ No newline at end of file
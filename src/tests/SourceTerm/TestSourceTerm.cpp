@@ -2,3 +2,7 @@
 #include "tests/TestHelper.h"
 
 #include "PointSource.t.h"
+
+#ifdef MULTIPLE_SIMULATIONS
+#include "Ensemble.t.h"
+#endif